@@ -57,6 +57,7 @@ const CN_PROGMEM char CN_device                   [] = "device";
 const CN_PROGMEM char CN_dhcp                     [] = "dhcp";
 const CN_PROGMEM char CN_Dotfseq                  [] = ".fseq";
 const CN_PROGMEM char CN_Dotpl                    [] = ".pl";
+const CN_PROGMEM char CN_doublebuffer             [] = "doublebuffer";
 const CN_PROGMEM char CN_duration                 [] = "duration";
 const CN_PROGMEM char CN_effect                   [] = "effect";
 const CN_PROGMEM char CN_effect_list              [] = "effect_list";
@@ -95,6 +96,7 @@ const CN_PROGMEM char CN_group_size               [] = "group_size";
 const CN_PROGMEM char CN_Heap_colon               [] = "Heap: ";
 const CN_PROGMEM char CN_hadisco                  [] = "hadisco";
 const CN_PROGMEM char CN_haprefix                 [] = "haprefix";
+const CN_PROGMEM char CN_highrefresh              [] = "highrefresh";
 const CN_PROGMEM char CN_HostName                 [] = "HostName";
 const CN_PROGMEM char CN_hostname                 [] = "hostname";
 const CN_PROGMEM char CN_hv                       [] = "hv";
@@ -106,12 +108,16 @@ const CN_PROGMEM char CN_inv                      [] = "inv";
 const CN_PROGMEM char CN_ip                       [] = "ip";
 const CN_PROGMEM char CN_input                    [] = "input";
 const CN_PROGMEM char CN_input_config             [] = "input_config";
+const CN_PROGMEM char CN_interarrival             [] = "interarrival";
+const CN_PROGMEM char CN_keepalive                [] = "keepalive";
 const CN_PROGMEM char CN_last_clientIP            [] = "last_clientIP";
+const CN_PROGMEM char CN_lateuniverses            [] = "lateuniverses";
 const CN_PROGMEM char CN_lwt                      [] = "lwt";
 const CN_PROGMEM char CN_mac                      [] = "mac";
 const CN_PROGMEM char CN_mdc_pin                  [] = "mdc_pin";
 const CN_PROGMEM char CN_mdio_pin                 [] = "mdio_pin";
 const CN_PROGMEM char CN_Max                      [] = "Max";
+const CN_PROGMEM char CN_merge                    [] = "merge";
 const CN_PROGMEM char CN_Min                      [] = "Min";
 const CN_PROGMEM char CN_minussigns               [] = "-----";
 const CN_PROGMEM char CN_mirror                   [] = "mirror";
@@ -128,6 +134,7 @@ const CN_PROGMEM char CN_num_chan                 [] = "num_chan";
 const CN_PROGMEM char CN_num_packets              [] = "num_packets";
 const CN_PROGMEM char CN_output                   [] = "output";
 const CN_PROGMEM char CN_output_config            [] = "output_config";
+const CN_PROGMEM char CN_outputlatency            [] = "outputlatency";
 const CN_PROGMEM char CN_packet_errors            [] = "packet_errors";
 const CN_PROGMEM char CN_passphrase               [] = "passphrase";
 const CN_PROGMEM char CN_password                 [] = "password";
@@ -142,9 +149,11 @@ const CN_PROGMEM char CN_polarity                 [] = "polarity";
 const CN_PROGMEM char CN_port                     [] = "port";
 const CN_PROGMEM char CN_power_pin                [] = "power_pin";
 const CN_PROGMEM char CN_prependnullcount         [] = "prependnullcount";
+const CN_PROGMEM char CN_priority                 [] = "priority";
 const CN_PROGMEM char CN_pwm                      [] = "pwm";
 const CN_PROGMEM char CN_r                        [] = "r";
 const CN_PROGMEM char CN_remote                   [] = "remote";
+const CN_PROGMEM char CN_rendertask               [] = "rendertask";
 const CN_PROGMEM char CN_rev                      [] = "rev";
 const CN_PROGMEM char CN_reverse                  [] = "reverse";
 const CN_PROGMEM char CN_RMT                      [] = "RMT";
@@ -156,6 +165,7 @@ const CN_PROGMEM char CN_seconds_remaining        [] = "seconds_remaining";
 const CN_PROGMEM char CN_sequence_filename        [] = "sequence_filename";
 const CN_PROGMEM char CN_slashset                 [] = "/set";
 const CN_PROGMEM char CN_slashstatus              [] = "/status";
+const CN_PROGMEM char CN_sources                  [] = "sources";
 const CN_PROGMEM char CN_speed                    [] = "speed";
 const CN_PROGMEM char CN_ssid                     [] = "ssid";
 const CN_PROGMEM char CN_sta_timeout              [] = "sta_timeout";
@@ -165,7 +175,11 @@ const CN_PROGMEM char CN_status                   [] = "status";
 const CN_PROGMEM char CN_status_name              [] = "status_name";
 const CN_PROGMEM char CN_StayInApMode             [] = "StayInApMode";
 const CN_PROGMEM char CN_subnet                   [] = "subnet";
+const CN_PROGMEM char CN_syncaddress              [] = "syncaddress";
+const CN_PROGMEM char CN_syncedframes             [] = "syncedframes";
 const CN_PROGMEM char CN_SyncOffset               [] = "SyncOffset";
+const CN_PROGMEM char CN_syncstart                [] = "syncstart";
+const CN_PROGMEM char CN_synctimeouts             [] = "synctimeouts";
 const CN_PROGMEM char CN_system                   [] = "system";
 const CN_PROGMEM char CN_textSLASHplain           [] = "text/plain";
 const CN_PROGMEM char CN_time                     [] = "time";
@@ -188,6 +202,7 @@ const CN_PROGMEM char CN_updateinterval           [] = "updateinterval";
 const CN_PROGMEM char CN_user                     [] = "user";
 const CN_PROGMEM char CN_version                  [] = "version";
 const CN_PROGMEM char CN_Version                  [] = "Version";
+const CN_PROGMEM char CN_waitforpush              [] = "waitforpush";
 const CN_PROGMEM char CN_weus                     [] = "weus";
 const CN_PROGMEM char CN_wifi                     [] = "wifi";
 const CN_PROGMEM char CN_WiFiDrv                  [] = "WiFiDrv";
@@ -66,6 +66,7 @@ extern const CN_PROGMEM char CN_device [];
 extern const CN_PROGMEM char CN_dhcp[];
 extern const CN_PROGMEM char CN_Dotfseq[];
 extern const CN_PROGMEM char CN_Dotpl[];
+extern const CN_PROGMEM char CN_doublebuffer[];
 extern const CN_PROGMEM char CN_duration[];
 extern const CN_PROGMEM char CN_effect[];
 extern const CN_PROGMEM char CN_effect_list[];
@@ -103,6 +104,7 @@ extern const CN_PROGMEM char CN_gid[];
 extern const CN_PROGMEM char CN_group_size[];
 extern const CN_PROGMEM char CN_hadisco[];
 extern const CN_PROGMEM char CN_haprefix[];
+extern const CN_PROGMEM char CN_highrefresh[];
 extern const CN_PROGMEM char CN_Heap_colon [];
 extern const CN_PROGMEM char CN_HostName [];
 extern const CN_PROGMEM char CN_hostname [];
@@ -115,12 +117,16 @@ extern const CN_PROGMEM char CN_inv[];
 extern const CN_PROGMEM char CN_ip[];
 extern const CN_PROGMEM char CN_input[];
 extern const CN_PROGMEM char CN_input_config[];
+extern const CN_PROGMEM char CN_interarrival[];
+extern const CN_PROGMEM char CN_keepalive[];
 extern const CN_PROGMEM char CN_last_clientIP[];
+extern const CN_PROGMEM char CN_lateuniverses[];
 extern const CN_PROGMEM char CN_lwt[];
 extern const CN_PROGMEM char CN_mac[];
 extern const CN_PROGMEM char CN_mdc_pin[];
 extern const CN_PROGMEM char CN_mdio_pin[];
 extern const CN_PROGMEM char CN_Max[];
+extern const CN_PROGMEM char CN_merge[];
 extern const CN_PROGMEM char CN_Min[];
 extern const CN_PROGMEM char CN_minussigns[];
 extern const CN_PROGMEM char CN_mirror [];
@@ -137,6 +143,7 @@ extern const CN_PROGMEM char CN_num_chan[];
 extern const CN_PROGMEM char CN_num_packets[];
 extern const CN_PROGMEM char CN_output[];
 extern const CN_PROGMEM char CN_output_config[];
+extern const CN_PROGMEM char CN_outputlatency[];
 extern const CN_PROGMEM char CN_packet_errors[];
 extern const CN_PROGMEM char CN_passphrase[];
 extern const CN_PROGMEM char CN_password[];
@@ -151,8 +158,10 @@ extern const CN_PROGMEM char CN_playlist [];
 extern const CN_PROGMEM char CN_plussigns [];
 extern const CN_PROGMEM char CN_power_pin[];
 extern const CN_PROGMEM char CN_prependnullcount [];
+extern const CN_PROGMEM char CN_priority[];
 extern const CN_PROGMEM char CN_pwm [];
 extern const CN_PROGMEM char CN_remote[];
+extern const CN_PROGMEM char CN_rendertask[];
 extern const CN_PROGMEM char CN_r[];
 extern const CN_PROGMEM char CN_rev[];
 extern const CN_PROGMEM char CN_reverse[];
@@ -165,6 +174,7 @@ extern const CN_PROGMEM char CN_seconds_remaining[];
 extern const CN_PROGMEM char CN_sequence_filename[];
 extern const CN_PROGMEM char CN_slashset[];
 extern const CN_PROGMEM char CN_slashstatus[];
+extern const CN_PROGMEM char CN_sources[];
 extern const CN_PROGMEM char CN_speed[];
 extern const CN_PROGMEM char CN_ssid [];
 extern const CN_PROGMEM char CN_sta_timeout [];
@@ -174,7 +184,11 @@ extern const CN_PROGMEM char CN_status [];
 extern const CN_PROGMEM char CN_status_name[];
 extern const CN_PROGMEM char CN_StayInApMode [];
 extern const CN_PROGMEM char CN_subnet[];
+extern const CN_PROGMEM char CN_syncaddress[];
+extern const CN_PROGMEM char CN_syncedframes[];
 extern const CN_PROGMEM char CN_SyncOffset[];
+extern const CN_PROGMEM char CN_syncstart[];
+extern const CN_PROGMEM char CN_synctimeouts[];
 extern const CN_PROGMEM char CN_system[];
 extern const CN_PROGMEM char CN_textSLASHplain[];
 extern const CN_PROGMEM char CN_time[];
@@ -197,6 +211,7 @@ extern const CN_PROGMEM char CN_updateinterval[];
 extern const CN_PROGMEM char CN_user[];
 extern const CN_PROGMEM char CN_version[];
 extern const CN_PROGMEM char CN_Version[];
+extern const CN_PROGMEM char CN_waitforpush[];
 extern const CN_PROGMEM char CN_weus[];
 extern const CN_PROGMEM char CN_wifi[];
 extern const CN_PROGMEM char CN_WiFiDrv[];
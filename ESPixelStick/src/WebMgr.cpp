@@ -600,6 +600,14 @@ void c_WebMgr::ProcessXseriesRequests (AsyncWebSocketClient * client)
             break;
         } // end case SimpleMessage::GET_ADMIN:
 
+        case SimpleMessage::RESET_TIMING_STATS:
+        {
+            // DEBUG_V ("");
+            InputMgr.ResetTimingStats ();
+            client->text (F ("XR"));
+            break;
+        } // end case SimpleMessage::RESET_TIMING_STATS:
+
         case SimpleMessage::DO_RESET:
         {
             // DEBUG_V ("");
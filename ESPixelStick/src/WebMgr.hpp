@@ -70,6 +70,7 @@ private:
         DO_RESET = '6',
         DO_FACTORYRESET = '7',
         PING = 'P',
+        RESET_TIMING_STATS = 'R',
     };
 
     void init ();
@@ -18,8 +18,11 @@
 */
 
 #include "InputArtnet.hpp"
+#include "InputPacketRing.hpp"
 #include "../network/NetworkMgr.hpp"
 
+static const uint8_t ArtnetId[8] = { 'A', 'r', 't', '-', 'N', 'e', 't', 0x00 };
+
 //-----------------------------------------------------------------------------
 c_InputArtnet::c_InputArtnet (c_InputMgr::e_InputChannelIds NewInputChannelId,
                               c_InputMgr::e_InputType       NewChannelType,
@@ -30,6 +33,10 @@ c_InputArtnet::c_InputArtnet (c_InputMgr::e_InputChannelIds NewInputChannelId,
     // DEBUG_START;
     // DEBUG_V ("BufferSize: " + String (BufferSize));
     memset ((void*)UniverseArray, 0x00, sizeof (UniverseArray));
+
+    // sync mode times out even if no more packets arrive
+    InputPacketRing.AddTimerInput (this);
+
     // DEBUG_END;
 } // c_InputArtnet
 
@@ -38,6 +45,24 @@ c_InputArtnet::~c_InputArtnet()
 {
     // DEBUG_START;
 
+    if (nullptr != udp)
+    {
+        // stop the receive callbacks before the queued packets are flushed
+        udp->close ();
+    }
+
+    // the drain task may still hold packets for us. A queued poll replies through udp
+    InputPacketRing.RemoveTimerInput (this);
+    InputPacketRing.Flush (this);
+
+    if (nullptr != udp)
+    {
+        delete udp;
+        udp = nullptr;
+    }
+
+    FreeSyncBuffer ();
+
     // DEBUG_END;
 
 } // ~c_InputArtnet
@@ -95,15 +120,32 @@ void c_InputArtnet::GetStatus (JsonObject & jsonStatus)
     ArtnetStatus[CN_num_packets]      = num_packets;
     ArtnetStatus[CN_packet_errors] = packet_errors;
     ArtnetStatus[CN_last_clientIP] = LastRemoteIP.toString ();
+    ArtnetStatus[CN_syncedframes]  = SyncedFrames;
+    ArtnetStatus[CN_synctimeouts]  = SyncTimeouts;
+
+    JsonObject LatencyStatus = ArtnetStatus.createNestedObject (F ("latency"));
+    LatencyStatus[F ("avg")] = (num_packets) ? uint32_t (LatencyTotalInMicroSec / num_packets) : 0;
+    LatencyStatus[F ("max")] = LatencyMaxInMicroSec;
+
+    JsonObject OutputLatencyStatus = ArtnetStatus.createNestedObject (CN_outputlatency);
+    LatencyStats.GetStatus (OutputLatencyStatus);
 
     JsonArray ArtnetUniverseStatus = ArtnetStatus.createNestedArray (CN_channels);
 
+    uint32_t NumUniversesInUse = uint32_t (LastUniverse - startUniverse) + 1;
+    uint32_t UniverseIndex = 0;
     for (auto & CurrentUniverse : UniverseArray)
     {
         JsonObject ArtnetCurrentUniverseStatus = ArtnetUniverseStatus.createNestedObject ();
 
         ArtnetCurrentUniverseStatus[CN_errors] = CurrentUniverse.SequenceErrorCounter;
         ArtnetCurrentUniverseStatus[CN_num_packets] = CurrentUniverse.num_packets;
+
+        if (UniverseIndex++ < NumUniversesInUse)
+        {
+            JsonObject ArrivalStatus = ArtnetCurrentUniverseStatus.createNestedObject (CN_interarrival);
+            CurrentUniverse.ArrivalStats.GetStatus (ArrivalStatus);
+        }
     }
 
     // DEBUG_END;
@@ -111,25 +153,186 @@ void c_InputArtnet::GetStatus (JsonObject & jsonStatus)
 } // GetStatus
 
 //-----------------------------------------------------------------------------
-void c_InputArtnet::Process ()
+void c_InputArtnet::ResetTimingStats ()
 {
     // DEBUG_START;
-    if ((nullptr != pArtnet) && (NetworkMgr.IsConnected ()))
+
+    for (auto & CurrentUniverse : UniverseArray)
     {
-        // DEBUG_V ("");
-        pArtnet->read ();
+        CurrentUniverse.ArrivalStats.RequestReset ();
     }
+    LatencyStats.RequestReset ();
+
+    // DEBUG_END;
+
+} // ResetTimingStats
+
+//-----------------------------------------------------------------------------
+void c_InputArtnet::Process ()
+{
+    // DEBUG_START;
+
+    // Packets are processed in the UDP receive callback
 
     // DEBUG_END;
 
 } // process
 
+//-----------------------------------------------------------------------------
+void c_InputArtnet::ProcessReceivedUdpPacket (AsyncUDPPacket Packet)
+{
+    // DEBUG_START;
+
+    InputPacketRing.Push (this, Packet.data (), Packet.length (), Packet.remoteIP ());
+
+    // DEBUG_END;
+
+} // ProcessReceivedUdpPacket
+
+//-----------------------------------------------------------------------------
+void c_InputArtnet::ProcessArtnetPacket (uint8_t * Data, uint32_t Length, IPAddress RemoteIP, uint32_t ArrivalTimeInMicroSec)
+{
+    // DEBUG_START;
+
+    ApplyLayoutChange ();
+
+    CurrentArrivalTimeInMicroSec = ArrivalTimeInMicroSec;
+
+    do // once
+    {
+        if ((Length < ARTNET_HEADER_LEN) || (0 != memcmp (Data, ArtnetId, sizeof (ArtnetId))))
+        {
+            // DEBUG_V ("Not an Art-Net packet");
+            ++packet_errors;
+            break;
+        }
+
+        uint16_t OpCode = uint16_t (Data[8]) | (uint16_t (Data[9]) << 8);
+        switch (OpCode)
+        {
+            case ARTNET_OP_DMX:
+            {
+                if (Length < ARTNET_DMX_HEADER_LEN)
+                {
+                    ++packet_errors;
+                    break;
+                }
+
+                uint16_t UniverseId = uint16_t (Data[14]) | (uint16_t (Data[15] & 0x7f) << 8);
+                uint32_t DmxLength  = (uint32_t (Data[16]) << 8) | uint32_t (Data[17]);
+                onDmxFrame (UniverseId,
+                            min (DmxLength, Length - ARTNET_DMX_HEADER_LEN),
+                            Data[12],
+                            &Data[ARTNET_DMX_HEADER_LEN],
+                            RemoteIP,
+                            ArrivalTimeInMicroSec);
+                break;
+            }
+
+            case ARTNET_OP_SYNC:
+            {
+                onSync (RemoteIP);
+                break;
+            }
+
+            case ARTNET_OP_POLL:
+            {
+                SendPollReply (RemoteIP);
+                break;
+            }
+
+            default:
+            {
+                // DEBUG_V (String ("Ignoring OpCode: 0x") + String (OpCode, HEX));
+                break;
+            }
+        }
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // ProcessArtnetPacket
+
+//-----------------------------------------------------------------------------
+/*
+    All of the ports in one reply share the Net and Sub-Net of the reply.
+    Our universes are sent in groups of up to four ports that do not cross
+    a sixteen universe boundary. Art-Net 4 numbers the replies with BindIndex.
+*/
+void c_InputArtnet::SendPollReply (IPAddress remoteIP)
+{
+    // DEBUG_START;
+
+    ArtPollReply_t Reply;
+    memset ((void*)&Reply, 0x00, sizeof (Reply));
+
+    IPAddress LocalIp = NetworkMgr.GetlocalIP ();
+    String    Hostname;
+    NetworkMgr.GetHostname (Hostname);
+
+    memcpy (Reply.Id, ArtnetId, sizeof (Reply.Id));
+    Reply.OpCode = ARTNET_OP_POLL_REPLY;
+    for (uint32_t Index = 0; Index < sizeof (Reply.IpAddress); ++Index)
+    {
+        Reply.IpAddress[Index] = LocalIp[Index];
+        Reply.BindIp[Index]    = LocalIp[Index];
+    }
+    Reply.Port       = ARTNET_PORT;
+    Reply.Status2    = 0x08; // 15 bit Port-Address
+    strncpy (Reply.ShortName, String (CN_ESPixelStick).c_str (), sizeof (Reply.ShortName) - 1);
+    strncpy (Reply.LongName, Hostname.c_str (), sizeof (Reply.LongName) - 1);
+    snprintf (Reply.NodeReport, sizeof (Reply.NodeReport), "#0001 [%04u] Ok", unsigned (++PollReplyCount % 10000));
+    WiFi.macAddress (Reply.Mac);
+
+    uint32_t NumUniverses = min (uint32_t (LastUniverse - startUniverse + 1), uint32_t (MAX_NUM_UNIVERSES));
+    uint32_t UniverseIndex = 0;
+    uint8_t  BindIndex = 0;
+
+    while (UniverseIndex < NumUniverses)
+    {
+        uint16_t FirstUniverseId = uint16_t (startUniverse + UniverseIndex);
+        Reply.NetSwitch  = uint8_t ((FirstUniverseId >> 8) & 0x7f);
+        Reply.SubSwitch  = uint8_t ((FirstUniverseId >> 4) & 0x0f);
+        Reply.BindIndex  = ++BindIndex;
+        memset (Reply.PortTypes,  0x00, sizeof (Reply.PortTypes));
+        memset (Reply.GoodOutput, 0x00, sizeof (Reply.GoodOutput));
+        memset (Reply.SwOut,      0x00, sizeof (Reply.SwOut));
+
+        uint32_t NumPorts = 0;
+        while ((NumPorts < ARTNET_POLL_REPLY_NUM_PORTS) && (UniverseIndex < NumUniverses))
+        {
+            uint16_t UniverseId = uint16_t (startUniverse + UniverseIndex);
+            if ((UniverseId & 0x7ff0) != (FirstUniverseId & 0x7ff0))
+            {
+                // DEBUG_V ("The next universe is in another Sub-Net");
+                break;
+            }
+
+            Reply.PortTypes[NumPorts]  = 0x80; // can output DMX512 data from the network
+            Reply.GoodOutput[NumPorts] = (UniverseArray[UniverseIndex].num_packets) ? 0x80 : 0x00;
+            Reply.SwOut[NumPorts]      = uint8_t (UniverseId & 0x0f);
+            ++NumPorts;
+            ++UniverseIndex;
+        }
+        Reply.NumPortsLo = uint8_t (NumPorts);
+
+        AsyncUDPMessage UDPresponse;
+        UDPresponse.write ((const uint8_t*)&Reply, sizeof (Reply));
+        udp->sendTo (UDPresponse, remoteIP, ARTNET_PORT);
+    }
+
+    // DEBUG_END;
+
+} // SendPollReply
+
 //-----------------------------------------------------------------------------
 void c_InputArtnet::onDmxFrame (uint16_t  CurrentUniverseId,
                                 uint32_t    length,
                                 uint8_t   SequenceNumber,
                                 uint8_t * data,
-                                IPAddress remoteIP)
+                                IPAddress remoteIP,
+                                uint32_t  ArrivalTimeInMicroSec)
 {
     // DEBUG_START;
 
@@ -151,13 +354,33 @@ void c_InputArtnet::onDmxFrame (uint16_t  CurrentUniverseId,
         ++CurrentUniverse.SequenceNumber;
         ++CurrentUniverse.num_packets;
         ++num_packets;
+        CurrentUniverse.ArrivalStats.PacketArrived (ArrivalTimeInMicroSec);
 
         // DEBUG_V (String ("data[0]: ") + String (data[0], HEX));
 
         lastData = data[0];
-        OutputMgr.WriteChannelData( CurrentUniverse.DestinationOffset,
-                                 min(CurrentUniverse.BytesToCopy, length),
-                                 &data[CurrentUniverse.SourceDataOffset]);
+
+        ProcessQueuedTimer ();
+
+        // the first universe can start part way into the packet
+        uint32_t BytesToCopy = (length > CurrentUniverse.SourceDataOffset) ? (length - CurrentUniverse.SourceDataOffset) : 0;
+        BytesToCopy = min (CurrentUniverse.BytesToCopy, BytesToCopy);
+
+        if (SyncModeIsActive)
+        {
+            StageUniverse (CurrentUniverse, BytesToCopy, &data[CurrentUniverse.SourceDataOffset]);
+        }
+        else
+        {
+            OutputMgr.WriteChannelData( CurrentUniverse.DestinationOffset,
+                                     BytesToCopy,
+                                     &data[CurrentUniverse.SourceDataOffset]);
+            LatencyStats.DataWritten (ArrivalTimeInMicroSec);
+        }
+
+        uint32_t LatencyInMicroSec = micros () - ArrivalTimeInMicroSec;
+        LatencyMaxInMicroSec    = max (LatencyMaxInMicroSec, LatencyInMicroSec);
+        LatencyTotalInMicroSec += LatencyInMicroSec;
 /*
         memcpy(CurrentUniverse.Destination,
                &data[CurrentUniverse.SourceDataOffset],
@@ -170,7 +393,185 @@ void c_InputArtnet::onDmxFrame (uint16_t  CurrentUniverseId,
         // DEBUG_V ("Not interested in this universe");
     }
     // DEBUG_END;
-}
+} // onDmxFrame
+
+//-----------------------------------------------------------------------------
+/*
+    Called by the input packet ring in the same context as the packets and
+    before each ArtDmx packet. Drops back to immediate output once the
+    sender stops sending ArtSync.
+*/
+void c_InputArtnet::ProcessQueuedTimer ()
+{
+    // DEBUG_START;
+
+    ApplyLayoutChange ();
+
+    if (SyncModeIsActive && ((millis () - LastSyncTimeMS) > ARTNET_SYNC_TIMEOUT_MS))
+    {
+        // DEBUG_V ("The sender stopped sending ArtSync");
+        ++SyncTimeouts;
+        PresentStagedUniverses ();
+        SyncModeIsActive = false;
+    }
+
+    // DEBUG_END;
+
+} // ProcessQueuedTimer
+
+//-----------------------------------------------------------------------------
+/*
+    Called in the packet context. The config path only flags a change of the
+    universe layout. The staged data is dropped here so that it cannot be
+    freed while a packet is using it.
+*/
+void c_InputArtnet::ApplyLayoutChange ()
+{
+    // DEBUG_START;
+
+    if (LayoutChanged)
+    {
+        LayoutChanged = false;
+        FreeSyncBuffer ();
+    }
+
+    // DEBUG_END;
+
+} // ApplyLayoutChange
+
+//-----------------------------------------------------------------------------
+void c_InputArtnet::onSync (IPAddress remoteIP)
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if (remoteIP != LastRemoteIP)
+        {
+            // Art-Net 4: only the source of the ArtDmx data may sync it
+            break;
+        }
+
+        if (!SyncModeIsActive)
+        {
+            // DEBUG_V ("Switching to synchronous output");
+            SyncModeIsActive = true;
+        }
+        else if (0 != NumStagedUniverses)
+        {
+            ++SyncedFrames;
+            PresentStagedUniverses ();
+        }
+
+        LastSyncTimeMS = millis ();
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // onSync
+
+//-----------------------------------------------------------------------------
+void c_InputArtnet::StageUniverse (Universe_t & CurrentUniverse, uint32_t BytesToCopy, uint8_t * data)
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if ((nullptr != pSyncBuffer) && (SyncBufferSize != InputDataBufferSize))
+        {
+            // DEBUG_V ("The staged data no longer fits the buffer");
+            FreeSyncBuffer ();
+        }
+
+        if (nullptr == pSyncBuffer)
+        {
+            SyncBufferSize = InputDataBufferSize;
+            pSyncBuffer = (uint8_t *)malloc (SyncBufferSize);
+            if (nullptr == pSyncBuffer)
+            {
+                SyncBufferSize = 0;
+
+                // no memory for staging. Present the data as it arrives
+                OutputMgr.WriteChannelData (CurrentUniverse.DestinationOffset, BytesToCopy, data);
+                LatencyStats.DataWritten (CurrentArrivalTimeInMicroSec);
+                break;
+            }
+        }
+
+        if (CurrentUniverse.IsStaged)
+        {
+            // DEBUG_V ("The ArtSync for the staged frame never arrived");
+            ++SyncTimeouts;
+            PresentStagedUniverses ();
+        }
+
+        if ((CurrentUniverse.DestinationOffset + BytesToCopy) > SyncBufferSize)
+        {
+            // DEBUG_V ("The layout changed under this packet");
+            break;
+        }
+
+        memcpy (&pSyncBuffer[CurrentUniverse.DestinationOffset], data, BytesToCopy);
+        CurrentUniverse.StagedBytes = BytesToCopy;
+        CurrentUniverse.IsStaged = true;
+        ++NumStagedUniverses;
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // StageUniverse
+
+//-----------------------------------------------------------------------------
+void c_InputArtnet::PresentStagedUniverses ()
+{
+    // DEBUG_START;
+
+    if (0 != NumStagedUniverses)
+    {
+        for (auto & CurrentUniverse : UniverseArray)
+        {
+            if (CurrentUniverse.IsStaged &&
+                ((CurrentUniverse.DestinationOffset + CurrentUniverse.StagedBytes) <= SyncBufferSize))
+            {
+                OutputMgr.WriteChannelData (CurrentUniverse.DestinationOffset,
+                                            CurrentUniverse.StagedBytes,
+                                            &pSyncBuffer[CurrentUniverse.DestinationOffset]);
+                CurrentUniverse.IsStaged = false;
+            }
+        }
+
+        NumStagedUniverses = 0;
+        LatencyStats.DataWritten (CurrentArrivalTimeInMicroSec);
+    }
+
+    // DEBUG_END;
+
+} // PresentStagedUniverses
+
+//-----------------------------------------------------------------------------
+void c_InputArtnet::FreeSyncBuffer ()
+{
+    // DEBUG_START;
+
+    if (nullptr != pSyncBuffer)
+    {
+        free (pSyncBuffer);
+        pSyncBuffer = nullptr;
+    }
+    SyncBufferSize = 0;
+
+    for (auto & CurrentUniverse : UniverseArray)
+    {
+        CurrentUniverse.IsStaged = false;
+    }
+    NumStagedUniverses = 0;
+
+    // DEBUG_END;
+
+} // FreeSyncBuffer
+
 //-----------------------------------------------------------------------------
 void c_InputArtnet::SetBufferInfo (uint32_t BufferSize)
 {
@@ -225,6 +626,9 @@ void c_InputArtnet::SetBufferTranslation ()
         InputOffset        = 0;
     }
 
+    // the packet context drops the staged data
+    LayoutChanged = true;
+
     if (0 != BytesLeftToMap)
     {
         logcon (String (F ("ERROR: Universe configuration is too small to fill output buffer. Outputs have been truncated.")));
@@ -252,32 +656,27 @@ bool c_InputArtnet::SetConfig (ArduinoJson::JsonObject& jsonConfig)
     return true;
 } // SetConfig
 
-static c_InputArtnet * fMe = nullptr;
-
 //-----------------------------------------------------------------------------
 // Subscribe to "n" universes, starting at "universe"
 void c_InputArtnet::SetUpArtnet ()
 {
     // DEBUG_START;
 
-    if (nullptr == pArtnet)
+    if (nullptr == udp)
     {
         // DEBUG_V ("");
-        pArtnet = new Artnet ();
-        pArtnet->begin ();
-
-        byte broadcast[] = { 10, 0, 1, 255 };
-        pArtnet->setBroadcast (broadcast);
-        logcon (String (F ("Subscribed to broadcast")));
-
-        // DEBUG_V ("");
+        udp = new AsyncUDP ();
 
-        fMe = this; // hate this
-        pArtnet->setArtDmxCallback ([](uint16_t UniverseId, uint16_t length, uint8_t sequence, uint8_t* data, IPAddress remoteIP)
-            {
-                // logcon ("fMe");
-                fMe->onDmxFrame (UniverseId, length, sequence, data, remoteIP);
-            });
+        // Art-Net is sent broadcast or unicast. Listening on the port gets both.
+        if (udp->listen (ARTNET_PORT))
+        {
+            udp->onPacket (std::bind (&c_InputArtnet::ProcessReceivedUdpPacket, this, std::placeholders::_1));
+            logcon (String (F ("Listening on port ")) + ARTNET_PORT);
+        }
+        else
+        {
+            logcon (CN_stars + String (F (" ARTNET LISTEN FAILED ")) + CN_stars);
+        }
     }
     // DEBUG_V ("");
 
@@ -339,6 +738,12 @@ void c_InputArtnet::validateConfiguration ()
         LastUniverse = startUniverse + span / ChannelsPerUniverse - 1;
     }
 
+    if ((LastUniverse - startUniverse) >= MAX_NUM_UNIVERSES)
+    {
+        // small universes can need more entries than the table has
+        LastUniverse = startUniverse + MAX_NUM_UNIVERSES - 1;
+    }
+
     // DEBUG_V ("");
 
     SetBufferTranslation ();
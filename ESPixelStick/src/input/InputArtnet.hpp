@@ -19,16 +19,73 @@
 */
 
 #include "InputCommon.hpp"
-#include <Artnet.h>
+#include "InputTimingStats.hpp"
+
+#ifdef ESP32
+#include <WiFi.h>
+#include <AsyncUDP.h>
+#elif defined (ESP8266)
+#include <ESPAsyncUDP.h>
+#include <ESP8266WiFi.h>
+#else
+#error Platform not supported
+#endif
 
 class c_InputArtnet : public c_InputCommon
 {
   private:
     static const uint16_t   UNIVERSE_MAX = 512;
     static const char       ConfigFileName[];
-    static const uint8_t    MAX_NUM_UNIVERSES = 10;
+    static const uint8_t    MAX_NUM_UNIVERSES = (OM_MAX_NUM_CHANNELS / UNIVERSE_MAX) + 1;
+
+#define ARTNET_PORT                 6454
+#define ARTNET_HEADER_LEN           10      ///< ID and OpCode
+#define ARTNET_DMX_HEADER_LEN       18
+#define ARTNET_OP_POLL              0x2000
+#define ARTNET_OP_POLL_REPLY        0x2100
+#define ARTNET_OP_DMX               0x5000
+#define ARTNET_OP_SYNC              0x5200
+#define ARTNET_POLL_REPLY_NUM_PORTS 4
+
+    typedef struct __attribute__ ((packed))
+    {
+        uint8_t  Id[8];
+        uint16_t OpCode;        ///< little endian
+        uint8_t  IpAddress[4];
+        uint16_t Port;          ///< little endian
+        uint8_t  VersInfoH;
+        uint8_t  VersInfoL;
+        uint8_t  NetSwitch;
+        uint8_t  SubSwitch;
+        uint8_t  OemHi;
+        uint8_t  Oem;
+        uint8_t  UbeaVersion;
+        uint8_t  Status1;
+        uint8_t  EstaManLo;
+        uint8_t  EstaManHi;
+        char     ShortName[18];
+        char     LongName[64];
+        char     NodeReport[64];
+        uint8_t  NumPortsHi;
+        uint8_t  NumPortsLo;
+        uint8_t  PortTypes[ARTNET_POLL_REPLY_NUM_PORTS];
+        uint8_t  GoodInput[ARTNET_POLL_REPLY_NUM_PORTS];
+        uint8_t  GoodOutput[ARTNET_POLL_REPLY_NUM_PORTS];
+        uint8_t  SwIn[ARTNET_POLL_REPLY_NUM_PORTS];
+        uint8_t  SwOut[ARTNET_POLL_REPLY_NUM_PORTS];
+        uint8_t  AcnPriority;
+        uint8_t  SwMacro;
+        uint8_t  SwRemote;
+        uint8_t  Spare[3];
+        uint8_t  Style;
+        uint8_t  Mac[6];
+        uint8_t  BindIp[4];
+        uint8_t  BindIndex;
+        uint8_t  Status2;
+        uint8_t  Filler[26];
+    } ArtPollReply_t;
 
-    Artnet * pArtnet = nullptr;
+    AsyncUDP  * udp = nullptr;
 
     /// JSON configuration parameters
     uint16_t    startUniverse              = 1;    ///< Universe to listen for
@@ -38,6 +95,11 @@ class c_InputArtnet : public c_InputCommon
     IPAddress   LastRemoteIP;
     uint32_t    num_packets = 0;
     uint32_t    packet_errors = 0;
+    uint32_t    PollReplyCount = 0;
+
+    /// Time from the receive callback being called to the data being written
+    uint32_t    LatencyMaxInMicroSec   = 0;
+    uint64_t    LatencyTotalInMicroSec = 0;
 
     uint8_t     lastData = 255;
 
@@ -52,15 +114,40 @@ class c_InputArtnet : public c_InputCommon
         uint32_t SequenceErrorCounter;
         uint8_t  SequenceNumber;
         uint32_t num_packets;
+        bool     IsStaged;      ///< Data is waiting in the sync buffer for an ArtSync
+        uint32_t StagedBytes;
+        c_InputArrivalStats ArrivalStats;
 
     } Universe_t;
     Universe_t UniverseArray[MAX_NUM_UNIVERSES];
 
+    /// ArtSync. Once a sync arrives, ArtDmx data is held until the next one.
+#define ARTNET_SYNC_TIMEOUT_MS  4000    ///< Art-Net 4: drop back to immediate output without an ArtSync for 4 seconds
+    uint8_t   * pSyncBuffer             = nullptr;  ///< Same layout as the output buffer. Only used by the packet context
+    uint32_t    SyncBufferSize          = 0;
+    volatile bool LayoutChanged         = false;    ///< Set by the config path. The packet context drops the staged data
+    bool        SyncModeIsActive        = false;
+    uint32_t    LastSyncTimeMS          = 0;
+    uint32_t    NumStagedUniverses      = 0;
+    uint32_t    SyncedFrames            = 0;
+    uint32_t    SyncTimeouts            = 0;
+
+    c_InputLatencyStats LatencyStats;
+    uint32_t    CurrentArrivalTimeInMicroSec = 0;   ///< Receive time of the packet being processed
+
     void SetUpArtnet ();
     void validateConfiguration ();
     void NetworkStateChanged (bool IsConnected, bool RebootAllowed); // used by poorly designed rx functions
     void SetBufferTranslation ();
-    void onDmxFrame (uint16_t CurrentUniverseId, uint32_t length, uint8_t sequence, uint8_t* data, IPAddress remoteIP);
+    void ProcessReceivedUdpPacket (AsyncUDPPacket Packet);
+    void ProcessArtnetPacket (uint8_t * Data, uint32_t Length, IPAddress RemoteIP, uint32_t ArrivalTimeInMicroSec);
+    void SendPollReply (IPAddress remoteIP);
+    void onDmxFrame (uint16_t CurrentUniverseId, uint32_t length, uint8_t sequence, uint8_t* data, IPAddress remoteIP, uint32_t ArrivalTimeInMicroSec);
+    void onSync (IPAddress remoteIP);
+    void StageUniverse (Universe_t & CurrentUniverse, uint32_t BytesToCopy, uint8_t * data);
+    void PresentStagedUniverses ();
+    void FreeSyncBuffer ();
+    void ApplyLayoutChange ();
 
   public:
 
@@ -79,5 +166,8 @@ class c_InputArtnet : public c_InputCommon
     void SetBufferInfo (uint32_t BufferSize);
     void NetworkStateChanged (bool IsConnected); // used by poorly designed rx functions
     bool isShutDownRebootNeeded () { return HasBeenInitialized; }
+    void ProcessQueuedPacket (uint8_t * Data, uint32_t Length, IPAddress RemoteIP, uint32_t ArrivalTimeInMicroSec) { ProcessArtnetPacket (Data, Length, RemoteIP, ArrivalTimeInMicroSec); }
+    void ProcessQueuedTimer ();
+    void ResetTimingStats ();
 
 };
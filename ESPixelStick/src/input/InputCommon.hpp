@@ -42,6 +42,9 @@ public:
     virtual void SetOperationalState (bool ActiveFlag) { IsInputChannelActive = ActiveFlag; }
     virtual void NetworkStateChanged (bool IsConnected) {}; // used by poorly designed rx functions
     virtual bool isShutDownRebootNeeded () { return false; }
+    virtual void ProcessQueuedPacket (uint8_t * Data, uint32_t Length, IPAddress RemoteIP, uint32_t ArrivalTimeInMicroSec) {} ///< Called by the input packet ring
+    virtual void ProcessQueuedTimer () {}                              ///< Called by the input packet ring in the same context as ProcessQueuedPacket
+    virtual void ResetTimingStats () {}                                ///< Clear the packet timing histograms
 
     c_InputMgr::e_InputChannelIds GetInputChannelId () { return InputChannelId; }
     c_InputMgr::e_InputType       GetInputType ()      { return ChannelType; }
@@ -17,6 +17,7 @@
 */
 
 #include "InputDDP.h"
+#include "InputPacketRing.hpp"
 #include <string.h>
 #include "../network/NetworkMgr.hpp"
 
@@ -38,7 +39,7 @@ c_InputDDP::c_InputDDP (c_InputMgr::e_InputChannelIds NewInputChannelId,
 {
     // DEBUG_START;
 
-    PacketBuffer.PacketBufferStatus = PacketBufferStatus_t::BufferIsAvailable;
+    BuildStatusReply ();
 
     // DEBUG_END;
 } // c_InputDDP
@@ -51,6 +52,11 @@ c_InputDDP::~c_InputDDP ()
     // OutputMgr.PauseOutput (false);
     // udp->stop ();
 
+    // the drain task may still hold packets for us
+    InputPacketRing.Flush (this);
+
+    FreeFrameBuffer ();
+
     // DEBUG_END;
 } // ~c_InputDDP
 
@@ -79,6 +85,7 @@ void c_InputDDP::GetConfig (JsonObject& jsonConfig)
 {
     // DEBUG_START;
 
+    jsonConfig[CN_waitforpush] = WaitForPush;
 
     // DEBUG_END;
 
@@ -95,8 +102,18 @@ void c_InputDDP::GetStatus (JsonObject& jsonStatus)
     ddpStatus["packetsreceived"] = stats.packetsReceived;
     ddpStatus["bytesreceived"]   = float(stats.bytesReceived) / 1024.0;
     ddpStatus[CN_errors]         = stats.errors;
+    ddpStatus["framespushed"]    = stats.framesPushed;
+    ddpStatus["partialframes"]   = stats.framesPartial;
+    ddpStatus["incompleteframes"] = stats.framesIncomplete;
+    ddpStatus["controldropped"]  = ControlPacketsDropped;
     ddpStatus[CN_id]             = InputChannelId;
 
+    JsonObject ArrivalStatus = ddpStatus.createNestedObject (CN_interarrival);
+    ArrivalStats.GetStatus (ArrivalStatus);
+
+    JsonObject LatencyStatus = ddpStatus.createNestedObject (CN_outputlatency);
+    LatencyStats.GetStatus (LatencyStatus);
+
     // DEBUG_END;
 
 } // GetStatus
@@ -106,9 +123,12 @@ bool c_InputDDP::SetConfig (JsonObject& jsonConfig)
 {
     // DEBUG_START;
 
+    // the packet context presents and frees an assembled frame once WaitForPush is off
+    setFromJSON (WaitForPush, jsonConfig, CN_waitforpush);
+
     // DEBUG_END;
 
-    return false;
+    return true;
 
 } // SetConfig
 
@@ -117,6 +137,12 @@ void c_InputDDP::SetBufferInfo (uint32_t BufferSize)
 {
     // DEBUG_START;
 
+    if (InputDataBufferSize != BufferSize)
+    {
+        // The packet context replaces the frame buffer once it sees the new size
+        ConfigReplyLength = 0;
+    }
+
     InputDataBufferSize = BufferSize;
 
     // DEBUG_V (String ("        InputBuffer: 0x") + String (uint32_t (InputDataBuffer), HEX));
@@ -129,6 +155,9 @@ void c_InputDDP::SetBufferInfo (uint32_t BufferSize)
 //-----------------------------------------------------------------------------
 void c_InputDDP::NetworkStateChanged (bool IsConnected)
 {
+    // the hostname may have changed
+    ConfigReplyLength = 0;
+
     if (IsConnected && !HasBeenInitialized)
     {
         // DEBUG_V ();
@@ -145,7 +174,7 @@ void c_InputDDP::NetworkStateChanged (bool IsConnected)
 } // NetworkStateChanged
 
 //-----------------------------------------------------------------------------
-void c_InputDDP::ProcessReceivedUdpPacket(AsyncUDPPacket ReceivedPacket)
+void c_InputDDP::ProcessReceivedUdpPacket (AsyncUDPPacket & ReceivedPacket)
 {
     // DEBUG_START;
 
@@ -156,32 +185,41 @@ void c_InputDDP::ProcessReceivedUdpPacket(AsyncUDPPacket ReceivedPacket)
         stats.packetsReceived++;
         stats.bytesReceived += ReceivedPacket.length ();
 
-        if ((packet.header.flags1 & DDP_FLAGS1_VERMASK) != DDP_FLAGS1_VER1)
+        if ((ReceivedPacket.length () < sizeof (DDP_Header_t)) ||
+            ((packet.header.flags1 & DDP_FLAGS1_VERMASK) != DDP_FLAGS1_VER1))
         {
             stats.errors++;
             // DEBUG_V ("Invalid version");
             break;
         }
 
-        // need to fast track data
+        // need to fast track data. The ring holds on to the received buffer instead of copying it.
         if (true == IsData(packet.header.flags1))
         {
-            ProcessReceivedData (packet);
+            InputPacketRing.Push (this, ReceivedPacket);
             break;
         }
 
-        // do we have a place to put the received data?
-        if (PacketBuffer.PacketBufferStatus == PacketBufferStatus_t::BufferIsBeingProcessed)
+        if (false == IsQuery (packet.header.flags1))
+        {
+            // DEBUG_V ("not sure what this thing is but we are going to ignore it");
+            break;
+        }
+
+        uint32_t CurrentHead = ControlQueueHead.load (std::memory_order_relaxed);
+        if ((CurrentHead - ControlQueueTail.load (std::memory_order_acquire)) >= DDP_CONTROL_QUEUE_SIZE)
         {
             // DEBUG_V ("Throw away the received packet. We dont have a place to put it.");
+            ControlPacketsDropped++;
             break;
         }
         // DEBUG_V ("");
 
-        PacketBuffer.ResponseAddress = ReceivedPacket.remoteIP ();
-        PacketBuffer.ResponsePort = ReceivedPacket.remotePort ();
-        memcpy ((void*)&PacketBuffer.Packet, ReceivedPacket.data (), sizeof (PacketBuffer.Packet));
-        PacketBuffer.PacketBufferStatus = PacketBufferStatus_t::BufferIsFilled;
+        ControlPacket_t & ControlPacket = ControlQueue[CurrentHead & (DDP_CONTROL_QUEUE_SIZE - 1)];
+        ControlPacket.header          = packet.header;
+        ControlPacket.ResponseAddress = ReceivedPacket.remoteIP ();
+        ControlPacket.ResponsePort    = ReceivedPacket.remotePort ();
+        ControlQueueHead.store (CurrentHead + 1, std::memory_order_release);
 
     } while (false);
 
@@ -190,50 +228,56 @@ void c_InputDDP::ProcessReceivedUdpPacket(AsyncUDPPacket ReceivedPacket)
 } // ProcessReceivedUdpPacket
 
 //-----------------------------------------------------------------------------
-void c_InputDDP::Process ()
+void c_InputDDP::ProcessQueuedPacket (uint8_t * Data, uint32_t Length, IPAddress RemoteIP, uint32_t ArrivalTimeInMicroSec)
 {
     // DEBUG_START;
 
-    do // once
-    {
-        if (PacketBuffer.PacketBufferStatus != PacketBufferStatus_t::BufferIsFilled)
-        {
-            // DEBUG_V ("There is nothing in the buffer for us to porcess");
-            break;
-        }
+    CurrentArrivalTimeInMicroSec = ArrivalTimeInMicroSec;
+    ArrivalStats.PacketArrived (ArrivalTimeInMicroSec);
+    ProcessReceivedData (*((DDP_packet_t *)Data), Length);
 
-        // DEBUG_V ("There is something in the buffer for us to process");
-        PacketBuffer.PacketBufferStatus = PacketBufferStatus_t::BufferIsBeingProcessed;
+    // DEBUG_END;
 
-        if (true == IsData(PacketBuffer.Packet.header.flags1))
-        {
-            ProcessReceivedData (PacketBuffer.Packet);
-            PacketBuffer.PacketBufferStatus = PacketBufferStatus_t::BufferIsAvailable;
-            break;
-        }
+} // ProcessQueuedPacket
 
-        if (true == IsQuery (PacketBuffer.Packet.header.flags1))
-        {
-            ProcessReceivedQuery ();
-            PacketBuffer.PacketBufferStatus = PacketBufferStatus_t::BufferIsAvailable;
-            break;
-        }
+//-----------------------------------------------------------------------------
+void c_InputDDP::ResetTimingStats ()
+{
+    // DEBUG_START;
 
-        // DEBUG_V ("not sure what this thing is but we are going to ignore it");
-        PacketBuffer.PacketBufferStatus = PacketBufferStatus_t::BufferIsAvailable;
-        // DEBUG_V("UnSupported PDU type");
+    ArrivalStats.RequestReset ();
+    LatencyStats.RequestReset ();
 
-    } while (false);
+    // DEBUG_END;
+
+} // ResetTimingStats
+
+//-----------------------------------------------------------------------------
+void c_InputDDP::Process ()
+{
+    // DEBUG_START;
+
+    uint32_t CurrentTail = ControlQueueTail.load (std::memory_order_relaxed);
+
+    while (CurrentTail != ControlQueueHead.load (std::memory_order_acquire))
+    {
+        // DEBUG_V ("There is something in the queue for us to process");
+        ProcessReceivedQuery (ControlQueue[CurrentTail & (DDP_CONTROL_QUEUE_SIZE - 1)]);
+        ControlQueueTail.store (++CurrentTail, std::memory_order_release);
+    }
 
     // DEBUG_END;
 
 } // Process
 
 //-----------------------------------------------------------------------------
-void c_InputDDP::ProcessReceivedData (DDP_packet_t & Packet)
+void c_InputDDP::ProcessReceivedData (DDP_packet_t & Packet, uint32_t PacketLength)
 {
     // DEBUG_START;
 
+    // the size can change under us. Check and assemble against one value
+    uint32_t BufferSize = InputDataBufferSize;
+
     do // once
     {
         DDP_Header_t & header = Packet.header;
@@ -245,16 +289,27 @@ void c_InputDDP::ProcessReceivedData (DDP_packet_t & Packet)
         uint32_t packetDataLength  = ntohs (header.dataLen);
 
         // DEBUG_V (String ("    packetDataLength: ") + String (packetDataLength));
-        // DEBUG_V (String (" InputDataBufferSize: ") + String (InputDataBufferSize));
+        // DEBUG_V (String (" InputDataBufferSize: ") + String (BufferSize));
 
-        if (InputBufferOffset >= InputDataBufferSize)
+        if (InputBufferOffset >= BufferSize)
         {
             // DEBUG_V ("Cant write any of this data to the input buffer");
             stats.errors++;
             break;
         }
 
-        uint32_t RemainingBufferSpace = InputDataBufferSize - InputBufferOffset;
+        byte* Data = (IsTime(header.flags1)) ? &((DDP_TimeCode_packet_t&)Packet).data[0] : &Packet.data[0];
+
+        // the data is read straight from the received buffer. Do not trust dataLen to stay inside it.
+        uint32_t HeaderLength = uint32_t (Data - (byte*)&Packet);
+        uint32_t ReceivedDataLength = (PacketLength > HeaderLength) ? (PacketLength - HeaderLength) : 0;
+        if (ReceivedDataLength < packetDataLength)
+        {
+            packetDataLength = ReceivedDataLength;
+            stats.errors++;
+        }
+
+        uint32_t RemainingBufferSpace = BufferSize - InputBufferOffset;
         // DEBUG_V (String ("RemainingBufferSpace: ") + String (RemainingBufferSpace));
 
         uint32_t AdjPacketDataLength = packetDataLength;
@@ -265,10 +320,23 @@ void c_InputDDP::ProcessReceivedData (DDP_packet_t & Packet)
         }
         // DEBUG_V (String (" AdjPacketDataLength: ") + String (AdjPacketDataLength));
 
-        byte* Data = (IsTime(header.flags1)) ? &((DDP_TimeCode_packet_t&)Packet).data[0] : &Packet.data[0];
         // DEBUG_V (String ("                Data: 0x") + String (uint32_t (Data), HEX));
         // DEBUG_V (String ("   InputBufferOffset: ") + String (InputBufferOffset));
-        OutputMgr.WriteChannelData(InputBufferOffset, AdjPacketDataLength, &Data[0]);
+        if (WaitForPush)
+        {
+            AssembleFrame (BufferSize, InputBufferOffset, AdjPacketDataLength, &Data[0], IsPush (header.flags1));
+        }
+        else
+        {
+            if (nullptr != pFrameBuffer)
+            {
+                // WaitForPush was turned off. Show whatever has been assembled
+                PresentFrame ();
+                FreeFrameBuffer ();
+            }
+            OutputMgr.WriteChannelData(InputBufferOffset, AdjPacketDataLength, &Data[0]);
+            LatencyStats.DataWritten (CurrentArrivalTimeInMicroSec);
+        }
 
         InputMgr.RestartBlankTimer (GetInputChannelId ());
 
@@ -279,33 +347,137 @@ void c_InputDDP::ProcessReceivedData (DDP_packet_t & Packet)
 } // ProcessReceivedData
 
 //-----------------------------------------------------------------------------
-void c_InputDDP::ProcessReceivedQuery ()
+/*
+    Hold the fragment in the frame buffer. Senders split large frames over
+    several packets and set PUSH on the last one. A fragment that starts
+    below the end of the previous one begins a new frame. If the previous
+    frame was never pushed it is presented as it is.
+
+    The frame buffer is only allocated and freed in the packet context so
+    that it cannot go away while a fragment is being copied into it.
+*/
+void c_InputDDP::AssembleFrame (uint32_t BufferSize, uint32_t InputBufferOffset, uint32_t DataLength, byte * Data, bool IsPushed)
 {
     // DEBUG_START;
 
-    DDP_packet_t & Packet = PacketBuffer.Packet;
+    do // once
+    {
+        if ((nullptr != pFrameBuffer) && (FrameBufferSize != BufferSize))
+        {
+            // DEBUG_V ("The assembled data no longer fits the buffer");
+            FreeFrameBuffer ();
+        }
 
-    DDP_packet_t DDPresponse;
-    memset ((void*)&DDPresponse, 0x00, sizeof (DDPresponse));
-    DDPresponse.header.flags1 = DDP_FLAGS1_VER1 | DDP_FLAGS1_REPLY | DDP_FLAGS1_PUSH;
+        if (nullptr == pFrameBuffer)
+        {
+            pFrameBuffer = (uint8_t *)calloc (1, BufferSize);
+            FrameBufferSize = BufferSize;
+            if (nullptr == pFrameBuffer)
+            {
+                // no memory for assembly. Present the data as it arrives
+                OutputMgr.WriteChannelData (InputBufferOffset, DataLength, Data);
+                LatencyStats.DataWritten (CurrentArrivalTimeInMicroSec);
+                break;
+            }
+        }
 
-    AsyncUDPMessage UDPresponse;
+        if (FrameHasData && (InputBufferOffset < NextExpectedOffset))
+        {
+            // DEBUG_V ("New frame started before the last one was pushed");
+            stats.framesIncomplete++;
+            PresentFrame ();
+            LatencyStats.DataWritten (CurrentArrivalTimeInMicroSec);
+        }
 
-    // DEBUG_V (String ("Packet.header.flags1: ") + String (Packet.header.flags1));
-    // DEBUG_V (String ("  Packet.header.type: ") + String (Packet.header.type));
-    // DEBUG_V (String ("    Packet.header.id: ") + String (Packet.header.id));
+        if (!FrameHasData)
+        {
+            FrameHasData     = true;
+            FrameHasGap      = (0 != InputBufferOffset);
+            FrameStartOffset = InputBufferOffset;
+            FrameEndOffset   = InputBufferOffset;
+        }
+        else if (InputBufferOffset != NextExpectedOffset)
+        {
+            // DEBUG_V ("Missing fragment");
+            FrameHasGap = true;
+        }
 
-    switch (Packet.header.id)
+        memcpy (&pFrameBuffer[InputBufferOffset], Data, DataLength);
+        NextExpectedOffset = InputBufferOffset + DataLength;
+        FrameStartOffset   = min (FrameStartOffset, InputBufferOffset);
+        FrameEndOffset     = max (FrameEndOffset, NextExpectedOffset);
+
+        if (IsPushed)
+        {
+            stats.framesPushed++;
+            if (FrameHasGap)
+            {
+                stats.framesPartial++;
+            }
+            PresentFrame ();
+            LatencyStats.DataWritten (CurrentArrivalTimeInMicroSec);
+        }
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // AssembleFrame
+
+//-----------------------------------------------------------------------------
+void c_InputDDP::PresentFrame ()
+{
+    // DEBUG_START;
+
+    if (FrameHasData && (nullptr != pFrameBuffer))
+    {
+        // channels between the fragments still hold the previous frame
+        OutputMgr.WriteChannelData (FrameStartOffset,
+                                    FrameEndOffset - FrameStartOffset,
+                                    &pFrameBuffer[FrameStartOffset]);
+    }
+
+    FrameHasData       = false;
+    NextExpectedOffset = 0;
+
+    // DEBUG_END;
+
+} // PresentFrame
+
+//-----------------------------------------------------------------------------
+void c_InputDDP::FreeFrameBuffer ()
+{
+    // DEBUG_START;
+
+    if (nullptr != pFrameBuffer)
+    {
+        free (pFrameBuffer);
+        pFrameBuffer = nullptr;
+    }
+    FrameBufferSize    = 0;
+
+    FrameHasData       = false;
+    NextExpectedOffset = 0;
+
+    // DEBUG_END;
+
+} // FreeFrameBuffer
+
+//-----------------------------------------------------------------------------
+void c_InputDDP::ProcessReceivedQuery (ControlPacket_t & ControlPacket)
+{
+    // DEBUG_START;
+
+    // DEBUG_V (String ("ControlPacket.header.flags1: ") + String (ControlPacket.header.flags1));
+    // DEBUG_V (String ("  ControlPacket.header.type: ") + String (ControlPacket.header.type));
+    // DEBUG_V (String ("    ControlPacket.header.id: ") + String (ControlPacket.header.id));
+
+    switch (ControlPacket.header.id)
     {
         case DDP_ID_STATUS:
         {
             // DEBUG_V ("DDP_ID_STATUS query");
-            String JsonResponse = "{\"status\":{\"man\":\"ESPixelStick\",\"mod\":\"V4\",\"ver\":\"1.0\"}}";
-            DDPresponse.header.id = DDP_ID_STATUS;
-            DDPresponse.header.dataLen = htons (JsonResponse.length());
-            memcpy (&DDPresponse.data, JsonResponse.c_str (), JsonResponse.length());
-            UDPresponse.write ((const uint8_t*)&DDPresponse, uint32_t(sizeof(DDPresponse.header) + JsonResponse.length ()));
-            udp->sendTo (UDPresponse, PacketBuffer.ResponseAddress, PacketBuffer.ResponsePort);
+            udp->writeTo ((const uint8_t*)&StatusReply, StatusReplyLength, ControlPacket.ResponseAddress, ControlPacket.ResponsePort);
             break;
         }
 
@@ -313,39 +485,30 @@ void c_InputDDP::ProcessReceivedQuery ()
         {
             // DEBUG_V ("DDP_ID_CONFIG query");
 
-            DynamicJsonDocument JsonConfigDoc (2048);
-            JsonObject JsonConfig = JsonConfigDoc.createNestedObject (CN_config);
-            String hostname;
-            NetworkMgr.GetHostname (hostname);
-            JsonConfig[CN_hostname] = hostname;
-            JsonConfig[CN_id] = config.id;
-            JsonConfig[CN_ip] = NetworkMgr.GetlocalIP ().toString ();
-            JsonConfig[CN_version] = VERSION;
-            JsonConfig["hardwareType"] = FPP_VARIANT_NAME;
-            JsonConfig[CN_type] = FPP_TYPE_ID;
-            JsonConfig[CN_num_chan] = InputDataBufferSize;
             uint16_t PixelPortCount;
             uint16_t SerialPortCount;
             OutputMgr.GetPortCounts (PixelPortCount, SerialPortCount);
-            JsonConfig["NumPixelPort"] = PixelPortCount;
-            JsonConfig["NumSerialPort"] = SerialPortCount;
-
-            String JsonResponse;
-            serializeJson (JsonConfigDoc, JsonResponse);
-            // DEBUG_V (String ("JsonResponse: ") + String (JsonResponse));
-
-            DDPresponse.header.id = DDP_ID_CONFIG;
-            DDPresponse.header.dataLen = htons (JsonResponse.length ());
-            memcpy (&DDPresponse.data, JsonResponse.c_str (), JsonResponse.length ());
-            UDPresponse.write ((const uint8_t*)&DDPresponse, uint32_t (sizeof (DDPresponse.header) + JsonResponse.length ()));
-            udp->sendTo (UDPresponse, PacketBuffer.ResponseAddress, PacketBuffer.ResponsePort);
+
+            if ((0 == ConfigReplyLength) ||
+                (ConfigReplyIp != NetworkMgr.GetlocalIP ()) ||
+                (ConfigReplyDeviceId != config.id) ||
+                (ConfigReplyPixelPortCount != PixelPortCount) ||
+                (ConfigReplySerialPortCount != SerialPortCount))
+            {
+                BuildConfigReply ();
+            }
+
+            if (0 != ConfigReplyLength)
+            {
+                udp->writeTo ((const uint8_t*)&ConfigReply, ConfigReplyLength, ControlPacket.ResponseAddress, ControlPacket.ResponsePort);
+            }
             break;
         }
 
         default:
         {
             stats.errors++;
-            // DEBUG_V (String ("Unsupported query: ") + String (DDPresponse.header.id));
+            // DEBUG_V (String ("Unsupported query: ") + String (ControlPacket.header.id));
             break;
         }
     }
@@ -353,3 +516,75 @@ void c_InputDDP::ProcessReceivedQuery ()
     // DEBUG_END;
 
 } // ProcessReceivedDiscovery
+
+//-----------------------------------------------------------------------------
+void c_InputDDP::BuildStatusReply ()
+{
+    // DEBUG_START;
+
+    memset ((void*)&StatusReply, 0x00, sizeof (StatusReply));
+
+    strncpy (StatusReply.data, String (F ("{\"status\":{\"man\":\"ESPixelStick\",\"mod\":\"V4\",\"ver\":\"1.0\"}}")).c_str (), sizeof (StatusReply.data) - 1);
+    uint32_t DataLength = strlen (StatusReply.data);
+
+    StatusReply.header.flags1  = DDP_FLAGS1_VER1 | DDP_FLAGS1_REPLY | DDP_FLAGS1_PUSH;
+    StatusReply.header.id      = DDP_ID_STATUS;
+    StatusReply.header.dataLen = htons (DataLength);
+    StatusReplyLength          = sizeof (StatusReply.header) + DataLength;
+
+    // DEBUG_END;
+
+} // BuildStatusReply
+
+//-----------------------------------------------------------------------------
+/*
+    Called when the config reply is missing or stale. The reply is kept
+    until the network state, the buffer size, the IP address or the device
+    id changes.
+*/
+void c_InputDDP::BuildConfigReply ()
+{
+    // DEBUG_START;
+
+    ConfigReplyLength   = 0;
+    ConfigReplyIp       = NetworkMgr.GetlocalIP ();
+    ConfigReplyDeviceId = config.id;
+    OutputMgr.GetPortCounts (ConfigReplyPixelPortCount, ConfigReplySerialPortCount);
+
+    do // once
+    {
+        DynamicJsonDocument JsonConfigDoc (2048);
+        JsonObject JsonConfig = JsonConfigDoc.createNestedObject (CN_config);
+        String hostname;
+        NetworkMgr.GetHostname (hostname);
+        JsonConfig[CN_hostname] = hostname;
+        JsonConfig[CN_id] = config.id;
+        JsonConfig[CN_ip] = ConfigReplyIp.toString ();
+        JsonConfig[CN_version] = VERSION;
+        JsonConfig["hardwareType"] = FPP_VARIANT_NAME;
+        JsonConfig[CN_type] = FPP_TYPE_ID;
+        JsonConfig[CN_num_chan] = InputDataBufferSize;
+        JsonConfig["NumPixelPort"] = ConfigReplyPixelPortCount;
+        JsonConfig["NumSerialPort"] = ConfigReplySerialPortCount;
+
+        uint32_t DataLength = measureJson (JsonConfigDoc);
+        if (DataLength > sizeof (ConfigReply.data))
+        {
+            logcon (String (F ("DDP config reply is too large: ")) + String (DataLength));
+            break;
+        }
+
+        memset ((void*)&ConfigReply, 0x00, sizeof (ConfigReply));
+        serializeJson (JsonConfigDoc, ConfigReply.data, sizeof (ConfigReply.data));
+        // DEBUG_V (String ("JsonResponse: ") + String (ConfigReply.data));
+
+        ConfigReply.header.flags1  = DDP_FLAGS1_VER1 | DDP_FLAGS1_REPLY | DDP_FLAGS1_PUSH;
+        ConfigReply.header.id      = DDP_ID_CONFIG;
+        ConfigReply.header.dataLen = htons (DataLength);
+        ConfigReplyLength          = sizeof (ConfigReply.header) + DataLength;
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // BuildConfigReply
@@ -19,6 +19,8 @@
 
 #include "../ESPixelStick.h"
 #include "InputCommon.hpp"
+#include "InputTimingStats.hpp"
+#include <atomic>
 
 #ifdef ESP32
 #include <WiFi.h>
@@ -87,11 +89,30 @@ private:
         byte         data[DDP_MAX_DATALEN - sizeof(TimeCode)];
     } DDP_TimeCode_packet_t;
 
+    // Discovery replies are built ahead of time and sent as they are
+#define DDP_STATUS_REPLY_MAX_DATALEN    64
+#define DDP_CONFIG_REPLY_MAX_DATALEN    512
+
+    typedef struct __attribute__ ((packed))
+    {
+        DDP_Header_t header;
+        char         data[DDP_STATUS_REPLY_MAX_DATALEN];
+    } DDP_StatusReply_t;
+
+    typedef struct __attribute__ ((packed))
+    {
+        DDP_Header_t header;
+        char         data[DDP_CONFIG_REPLY_MAX_DATALEN];
+    } DDP_ConfigReply_t;
+
     typedef struct __attribute__ ((packed))
     {
         uint32_t packetsReceived;
         uint64_t bytesReceived;
         uint32_t errors;
+        uint32_t framesPushed;      // frames presented by a PUSH
+        uint32_t framesPartial;     // pushed frames that were missing a fragment
+        uint32_t framesIncomplete;  // frames presented without a PUSH
     } DDP_stats_t;
 
     AsyncUDP        * udp = nullptr;         // UDP
@@ -99,29 +120,57 @@ private:
     bool            suspend = false;
     DDP_stats_t     stats;    // Statistics tracker
 
+    // Frame assembly. Fragments are held until the sender pushes the frame.
+    bool            WaitForPush         = false;
+    uint8_t       * pFrameBuffer        = nullptr;  // same layout as the input buffer. Only used by the packet context
+    uint32_t        FrameBufferSize     = 0;
+    bool            FrameHasData        = false;
+    bool            FrameHasGap         = false;
+    uint32_t        FrameStartOffset    = 0;        // lowest offset written in this frame
+    uint32_t        FrameEndOffset      = 0;        // one past the highest offset written in this frame
+    uint32_t        NextExpectedOffset  = 0;
+
+    DDP_StatusReply_t StatusReply;
+    uint32_t        StatusReplyLength   = 0;
+    DDP_ConfigReply_t ConfigReply;
+    uint32_t        ConfigReplyLength   = 0;        // 0 = rebuild before sending
+    IPAddress       ConfigReplyIp;                  // values the config reply was built with
+    String          ConfigReplyDeviceId;
+    uint16_t        ConfigReplyPixelPortCount   = 0;
+    uint16_t        ConfigReplySerialPortCount  = 0;
+
+    c_InputArrivalStats ArrivalStats;
+    c_InputLatencyStats LatencyStats;
+    uint32_t        CurrentArrivalTimeInMicroSec = 0;   // receive time of the packet being processed
+
     void NetworkStateChanged (bool NetwokState);
 
     // Packet parser callback
-    void ProcessReceivedUdpPacket (AsyncUDPPacket _packet);
-    void ProcessReceivedData  (DDP_packet_t & Packet);
-    void ProcessReceivedQuery ();
-
-    enum PacketBufferStatus_t
-    {
-        BufferIsAvailable,
-        BufferIsFilled,
-        BufferIsBeingProcessed,
-    };
+    void ProcessReceivedUdpPacket (AsyncUDPPacket & ReceivedPacket);
+    void ProcessReceivedData  (DDP_packet_t & Packet, uint32_t PacketLength);
+    void BuildStatusReply     ();
+    void BuildConfigReply     ();
+    void AssembleFrame        (uint32_t BufferSize, uint32_t InputBufferOffset, uint32_t DataLength, byte * Data, bool IsPushed);
+    void PresentFrame         ();
+    void FreeFrameBuffer      ();
+
+    // Control packets are answered from loop(). Only their headers are kept.
+    // One producer (the UDP receive callback) and one consumer (Process).
+#define DDP_CONTROL_QUEUE_SIZE  4   // must be a power of two
 
     typedef struct
     {
-        PacketBufferStatus_t PacketBufferStatus = PacketBufferStatus_t::BufferIsAvailable;
-        DDP_packet_t Packet;
-        IPAddress ResponseAddress;
-        uint16_t  ResponsePort;
-    } PacketBuffer_t;
+        DDP_Header_t header;
+        IPAddress    ResponseAddress;
+        uint16_t     ResponsePort;
+    } ControlPacket_t;
+
+    ControlPacket_t       ControlQueue[DDP_CONTROL_QUEUE_SIZE];
+    std::atomic<uint32_t> ControlQueueHead {0};    // next entry to fill
+    std::atomic<uint32_t> ControlQueueTail {0};    // next entry to answer
+    uint32_t              ControlPacketsDropped = 0;
 
-    PacketBuffer_t PacketBuffer;
+    void ProcessReceivedQuery (ControlPacket_t & ControlPacket);
 
 public:
 
@@ -140,5 +189,7 @@ public:
     void GetDriverName (String& sDriverName) { sDriverName = "DDP"; } ///< get the name for the instantiated driver
     void SetBufferInfo (uint32_t BufferSize);
     bool isShutDownRebootNeeded () { return HasBeenInitialized; }
+    void ProcessQueuedPacket (uint8_t * Data, uint32_t Length, IPAddress RemoteIP, uint32_t ArrivalTimeInMicroSec);
+    void ResetTimingStats ();
 
 };
@@ -18,7 +18,36 @@
 */
 
 #include "InputE131.hpp"
+#include "InputE131Merge.hpp"
+#include "InputPacketRing.hpp"
 #include "../network/NetworkMgr.hpp"
+#include <lwip/igmp.h>
+
+// Raw packet offsets. ESPAsyncE131 calls the data packet sync address "reserved"
+#define E131_ROOT_VECTOR_OFFSET             18
+#define E131_FRAME_VECTOR_OFFSET            40
+#define E131_DATA_SYNC_ADDRESS_OFFSET       109
+#define E131_PROPERTY_VALUES_OFFSET         125
+#define E131_CID_OFFSET                     22
+#define E131_SOURCE_NAME_OFFSET             44
+#define E131_OPTIONS_STREAM_TERMINATED      0x40
+#define E131_OPTIONS_PREVIEW_DATA           0x80
+#define E131_SYNC_PACKET_LENGTH             49
+#define E131_SYNC_SYNC_ADDRESS_OFFSET       45
+#define E131_VECTOR_ROOT_EXTENDED           0x00000008
+#define E131_VECTOR_EXTENDED_SYNCHRONIZATION 0x00000001
+
+//-----------------------------------------------------------------------------
+static inline uint16_t GetE131Uint16 (const uint8_t * pData)
+{
+    return (uint16_t (pData[0]) << 8) | uint16_t (pData[1]);
+} // GetE131Uint16
+
+//-----------------------------------------------------------------------------
+static inline uint32_t GetE131Uint32 (const uint8_t * pData)
+{
+    return (uint32_t (GetE131Uint16 (&pData[0])) << 16) | uint32_t (GetE131Uint16 (&pData[2]));
+} // GetE131Uint32
 
 //-----------------------------------------------------------------------------
 c_InputE131::c_InputE131 (c_InputMgr::e_InputChannelIds NewInputChannelId,
@@ -32,6 +61,10 @@ c_InputE131::c_InputE131 (c_InputMgr::e_InputChannelIds NewInputChannelId,
     e131 = new ESPAsyncE131 (0);
 
     memset ((void*)UniverseArray, 0x00, sizeof (UniverseArray));
+    memset ((void*)Sources, 0x00, sizeof (Sources));
+
+    // staged frames time out even if no more packets arrive
+    InputPacketRing.AddTimerInput (this);
 
     // DEBUG_END;
 } // c_InputE131
@@ -41,6 +74,14 @@ c_InputE131::~c_InputE131()
 {
     // DEBUG_START;
 
+    // the drain task may still hold packets for us
+    InputPacketRing.RemoveTimerInput (this);
+    InputPacketRing.Flush (this);
+
+    FreeSyncBuffer ();
+    ResetSources ();
+    LeaveMulticastGroups ();
+
     // DEBUG_END;
 
 } // ~c_InputE131
@@ -60,7 +101,7 @@ void c_InputE131::Begin ()
         // DEBUG_V ("");
         e131->registerCallback ( (void*)this, [] (e131_packet_t* Packet, void * pThis)
             {
-                ((c_InputE131*)pThis)->ProcessIncomingE131Data (Packet);
+                ((c_InputE131*)pThis)->QueueIncomingE131Data (Packet);
             });
 
         NetworkStateChanged (NetworkMgr.IsConnected (), false);
@@ -73,6 +114,30 @@ void c_InputE131::Begin ()
 
 } // Begin
 
+//-----------------------------------------------------------------------------
+void c_InputE131::FreeSyncBuffer ()
+{
+    // DEBUG_START;
+
+    if (nullptr != pSyncBuffer)
+    {
+        free (pSyncBuffer);
+        pSyncBuffer = nullptr;
+    }
+    SyncBufferSize = 0;
+
+    for (auto & CurrentUniverse : UniverseArray)
+    {
+        CurrentUniverse.IsSynced = false;
+        CurrentUniverse.IsStaged = false;
+    }
+    NumStagedUniverses = 0;
+    SyncAddress = 0;
+
+    // DEBUG_END;
+
+} // FreeSyncBuffer
+
 //-----------------------------------------------------------------------------
 void c_InputE131::GetConfig (JsonObject & jsonConfig)
 {
@@ -82,6 +147,7 @@ void c_InputE131::GetConfig (JsonObject & jsonConfig)
     jsonConfig[CN_universe_limit] = ChannelsPerUniverse;
     jsonConfig[CN_universe_start] = FirstUniverseChannelOffset;
     jsonConfig[CN_port]           = PortId;
+    jsonConfig[CN_merge]          = MergeMode;
 
     // DEBUG_END;
 
@@ -104,20 +170,78 @@ void c_InputE131::GetStatus (JsonObject & jsonStatus)
 
     JsonArray e131UniverseStatus = e131Status.createNestedArray (CN_channels);
     uint32_t TotalErrors = e131->stats.packet_errors;
+    uint32_t NumUniversesInUse = uint32_t (LastUniverse - startUniverse) + 1;
+    uint32_t UniverseIndex = 0;
     for (auto & CurrentUniverse : UniverseArray)
     {
         JsonObject e131CurrentUniverseStatus = e131UniverseStatus.createNestedObject ();
 
         e131CurrentUniverseStatus[CN_errors] = CurrentUniverse.SequenceErrorCounter;
         TotalErrors += CurrentUniverse.SequenceErrorCounter;
+
+        if (UniverseIndex++ < NumUniversesInUse)
+        {
+            e131CurrentUniverseStatus[CN_num_packets] = CurrentUniverse.num_packets;
+
+            JsonObject ArrivalStatus = e131CurrentUniverseStatus.createNestedObject (CN_interarrival);
+            CurrentUniverse.ArrivalStats.GetStatus (ArrivalStatus);
+        }
     }
 
     e131Status[CN_packet_errors] = TotalErrors;
 
+    e131Status[CN_multicast]             = (0 != NumJoinedUniverses);
+    e131Status[F ("multicastgroups")]    = NumJoinedUniverses;
+    e131Status[F ("multicastlimited")]   = MulticastIsLimited;
+    e131Status[F ("multicastmaxgroups")] = E131_MAX_MULTICAST_GROUPS;
+
+    e131Status[CN_syncaddress]   = SyncAddress;
+    e131Status[CN_syncedframes]  = SyncedFrames;
+    e131Status[CN_synctimeouts]  = SyncTimeouts;
+    e131Status[CN_lateuniverses] = LateUniverses;
+
+    JsonObject LatencyStatus = e131Status.createNestedObject (CN_outputlatency);
+    LatencyStats.GetStatus (LatencyStatus);
+
+    e131Status[F ("sourcelimitdrops")] = SourceLimitDrops;
+    e131Status[F ("mergedpackets")]    = MergedPackets;
+
+    JsonArray e131SourceStatus = e131Status.createNestedArray (CN_sources);
+    for (auto & CurrentSource : Sources)
+    {
+        if (!CurrentSource.InUse)
+        {
+            continue;
+        }
+
+        JsonObject e131CurrentSourceStatus = e131SourceStatus.createNestedObject ();
+
+        e131CurrentSourceStatus[CN_name]              = CurrentSource.Name;
+        e131CurrentSourceStatus[CN_priority]          = CurrentSource.Priority;
+        e131CurrentSourceStatus[CN_num_packets]       = CurrentSource.num_packets;
+        e131CurrentSourceStatus[CN_errors]            = CurrentSource.SequenceErrorCounter;
+        e131CurrentSourceStatus[F ("discarded")]      = CurrentSource.DiscardedPackets;
+    }
+
     // DEBUG_END;
 
 } // GetStatus
 
+//-----------------------------------------------------------------------------
+void c_InputE131::ResetTimingStats ()
+{
+    // DEBUG_START;
+
+    for (auto & CurrentUniverse : UniverseArray)
+    {
+        CurrentUniverse.ArrivalStats.RequestReset ();
+    }
+    LatencyStats.RequestReset ();
+
+    // DEBUG_END;
+
+} // ResetTimingStats
+
 //-----------------------------------------------------------------------------
 void c_InputE131::Process ()
 {
@@ -127,6 +251,85 @@ void c_InputE131::Process ()
 
 } // process
 
+//-----------------------------------------------------------------------------
+/*
+    Called from the UDP receive callback. The packet is copied into the
+    input packet ring and processed by its drain task.
+*/
+void c_InputE131::QueueIncomingE131Data (e131_packet_t * packet)
+{
+    // DEBUG_START;
+
+    uint8_t * RawPacket    = (uint8_t *)packet;
+    uint32_t  PacketLength = E131_SYNC_PACKET_LENGTH;
+
+    if (E131_VECTOR_ROOT_EXTENDED != GetE131Uint32 (&RawPacket[E131_ROOT_VECTOR_OFFSET]))
+    {
+        PacketLength = min (uint32_t (E131_PROPERTY_VALUES_OFFSET + ntohs (packet->property_value_count)), uint32_t (sizeof (e131_packet_t)));
+    }
+
+    InputPacketRing.Push (this, RawPacket, PacketLength, IPAddress ());
+
+    // DEBUG_END;
+
+} // QueueIncomingE131Data
+
+//-----------------------------------------------------------------------------
+/*
+    Called by the input packet ring in the same context as the packets.
+    Presents a staged frame whose sync packet never arrived.
+*/
+void c_InputE131::ProcessQueuedTimer ()
+{
+    // DEBUG_START;
+
+    ApplyLayoutChange ();
+
+    if ((0 != NumStagedUniverses) && ((millis () - SyncFrameStartTimeMS) > E131_SYNC_TIMEOUT_MS))
+    {
+        ++SyncTimeouts;
+        PresentSyncedUniverses ();
+    }
+
+    // DEBUG_END;
+
+} // ProcessQueuedTimer
+
+//-----------------------------------------------------------------------------
+void c_InputE131::ProcessQueuedPacket (uint8_t * Data, uint32_t Length, IPAddress RemoteIP, uint32_t ArrivalTimeInMicroSec)
+{
+    // DEBUG_START;
+
+    ApplyLayoutChange ();
+
+    CurrentArrivalTimeInMicroSec = ArrivalTimeInMicroSec;
+    ProcessIncomingE131Data ((e131_packet_t *)Data);
+
+    // DEBUG_END;
+
+} // ProcessQueuedPacket
+
+//-----------------------------------------------------------------------------
+/*
+    Called in the packet context. The config path only flags a change of the
+    universe layout. The data that was kept for the old layout is dropped here
+    so that it cannot be freed while a packet is using it.
+*/
+void c_InputE131::ApplyLayoutChange ()
+{
+    // DEBUG_START;
+
+    if (LayoutChanged)
+    {
+        LayoutChanged = false;
+        FreeSyncBuffer ();
+        ResetSources ();
+    }
+
+    // DEBUG_END;
+
+} // ApplyLayoutChange
+
 //-----------------------------------------------------------------------------
 void c_InputE131::ProcessIncomingE131Data (e131_packet_t * packet)
 {
@@ -143,6 +346,14 @@ void c_InputE131::ProcessIncomingE131Data (e131_packet_t * packet)
             break;
         }
 
+        uint8_t * RawPacket = (uint8_t *)packet;
+        if ((E131_VECTOR_ROOT_EXTENDED == GetE131Uint32 (&RawPacket[E131_ROOT_VECTOR_OFFSET])) &&
+            (E131_VECTOR_EXTENDED_SYNCHRONIZATION == GetE131Uint32 (&RawPacket[E131_FRAME_VECTOR_OFFSET])))
+        {
+            ProcessIncomingE131Sync (GetE131Uint16 (&RawPacket[E131_SYNC_SYNC_ADDRESS_OFFSET]));
+            break;
+        }
+
         CurrentUniverseId = ntohs (packet->universe);
         E131Data = packet->property_values + 1;
 
@@ -151,34 +362,43 @@ void c_InputE131::ProcessIncomingE131Data (e131_packet_t * packet)
 
         if ((startUniverse <= CurrentUniverseId) && (LastUniverse >= CurrentUniverseId))
         {
-            // Universe offset and sequence tracking
-            Universe_t& CurrentUniverse = UniverseArray[CurrentUniverseId - startUniverse];
+            uint32_t    UniverseIndex   = CurrentUniverseId - startUniverse;
+            Universe_t& CurrentUniverse = UniverseArray[UniverseIndex];
 
-            // Do we need to update a sequnce error?
-            if (packet->sequence_number != CurrentUniverse.SequenceNumber)
+            // the first universe can start part way into the packet
+            uint32_t NumBytesOfE131Data = uint32_t(ntohs (packet->property_value_count) - 1);
+            uint32_t BytesToCopy = (NumBytesOfE131Data > CurrentUniverse.SourceDataOffset) ? (NumBytesOfE131Data - CurrentUniverse.SourceDataOffset) : 0;
+            BytesToCopy = min (CurrentUniverse.BytesToCopy, BytesToCopy);
+
+            uint8_t * UniverseData = SelectSourceData (packet, UniverseIndex, &E131Data[CurrentUniverse.SourceDataOffset], BytesToCopy);
+            if (nullptr == UniverseData)
             {
-                // DEBUG_V (F ("E1.31 Sequence Error - expected: "));
-                // DEBUG_V (CurrentUniverse.SequenceNumber);
-                // DEBUG_V (F (" actual: "));
-                // DEBUG_V (packet->sequence_number);
-                // DEBUG_V (" " + String (CN_universe) + " : ");
-                // DEBUG_V (CurrentUniverseId);
-
-                CurrentUniverse.SequenceErrorCounter++;
-                CurrentUniverse.SequenceNumber = packet->sequence_number;
+                // DEBUG_V ("Packet is not used");
+                break;
             }
 
-            ++CurrentUniverse.SequenceNumber;
+            ++CurrentUniverse.num_packets;
+            CurrentUniverse.ArrivalStats.PacketArrived (CurrentArrivalTimeInMicroSec);
+
+            uint16_t NewSyncAddress = GetE131Uint16 (&RawPacket[E131_DATA_SYNC_ADDRESS_OFFSET]);
+            if (0 != NewSyncAddress)
+            {
+                StageSyncedUniverse (CurrentUniverse, NewSyncAddress, UniverseData, BytesToCopy);
+            }
+            else
+            {
+                if (CurrentUniverse.IsStaged)
+                {
+                    // the sender stopped synchronizing this universe. The new data replaces the staged data
+                    CurrentUniverse.IsStaged = false;
+                    --NumStagedUniverses;
+                }
+                CurrentUniverse.IsSynced = false;
+
+                OutputMgr.WriteChannelData(CurrentUniverse.DestinationOffset, BytesToCopy, UniverseData);
+                LatencyStats.DataWritten (CurrentArrivalTimeInMicroSec);
+            }
 
-            uint32_t NumBytesOfE131Data = uint32_t(ntohs (packet->property_value_count) - 1);
-            OutputMgr.WriteChannelData(CurrentUniverse.DestinationOffset,
-                                    min(CurrentUniverse.BytesToCopy, NumBytesOfE131Data),
-                                    &E131Data[CurrentUniverse.SourceDataOffset]);
-/*
-            memcpy(CurrentUniverse.Destination,
-                   &E131Data[CurrentUniverse.SourceDataOffset],
-                   min(CurrentUniverse.BytesToCopy, NumBytesOfE131Data));
-*/
             InputMgr.RestartBlankTimer (GetInputChannelId ());
         }
         else
@@ -192,11 +412,458 @@ void c_InputE131::ProcessIncomingE131Data (e131_packet_t * packet)
 
 } // process
 
+//-----------------------------------------------------------------------------
+/*
+    Track the source of a data packet and decide what its universe data
+    turns into. Returns nullptr if the packet is not to be used, the packet
+    data if it wins outright and the merged data if several sources share
+    the winning priority in HTP mode.
+*/
+uint8_t * c_InputE131::SelectSourceData (e131_packet_t * packet, uint32_t UniverseIndex, uint8_t * UniverseData, uint32_t BytesToCopy)
+{
+    // DEBUG_START;
+
+    uint8_t * Response  = nullptr;
+    uint8_t * RawPacket = (uint8_t *)packet;
+    uint32_t  Now       = max (millis (), uint32_t (1)); // 0 marks a universe a source has not sent
+
+    do // once
+    {
+        if (packet->options & E131_OPTIONS_PREVIEW_DATA)
+        {
+            // meant for visualizers, not for the lights
+            break;
+        }
+
+        Source_t * pSource = FindSource (RawPacket, Now);
+        if (nullptr == pSource)
+        {
+            ++SourceLimitDrops;
+            break;
+        }
+
+        ++pSource->num_packets;
+        pSource->Priority = packet->priority;
+
+        if (packet->options & E131_OPTIONS_STREAM_TERMINATED)
+        {
+            // the source is done with this universe. Let the others take over.
+            pSource->UniverseLastSeenMS[UniverseIndex] = 0;
+            break;
+        }
+
+        if (0 != pSource->UniverseLastSeenMS[UniverseIndex])
+        {
+            int8_t SequenceDelta = int8_t (packet->sequence_number - pSource->SequenceNumber[UniverseIndex]);
+            if (1 != SequenceDelta)
+            {
+                ++pSource->SequenceErrorCounter;
+                ++UniverseArray[UniverseIndex].SequenceErrorCounter;
+
+                if ((SequenceDelta <= 0) && (SequenceDelta > -20))
+                {
+                    // DEBUG_V ("Out of order or duplicate packet");
+                    ++pSource->DiscardedPackets;
+                    break;
+                }
+            }
+        }
+
+        pSource->SequenceNumber[UniverseIndex]     = packet->sequence_number;
+        pSource->UniversePriority[UniverseIndex]   = packet->priority;
+        pSource->UniverseLastSeenMS[UniverseIndex] = Now;
+
+        uint8_t  TopPriority     = 0;
+        uint32_t NumSourcesAtTop = 0;
+        for (auto & CurrentSource : Sources)
+        {
+            if (!SourceIsActive (CurrentSource, UniverseIndex, Now))
+            {
+                continue;
+            }
+
+            uint8_t CurrentPriority = CurrentSource.UniversePriority[UniverseIndex];
+            if (CurrentPriority > TopPriority)
+            {
+                TopPriority     = CurrentPriority;
+                NumSourcesAtTop = 1;
+            }
+            else if (CurrentPriority == TopPriority)
+            {
+                ++NumSourcesAtTop;
+            }
+        }
+
+        if (packet->priority < TopPriority)
+        {
+            // DEBUG_V ("A higher priority source owns this universe");
+            ++pSource->DiscardedPackets;
+            break;
+        }
+
+        Response = UniverseData;
+
+        if ((E131_MERGE_HTP != MergeMode) || !StoreSourceData (*pSource, UniverseIndex, UniverseData, BytesToCopy))
+        {
+            // latest packet wins
+            break;
+        }
+
+        if (1 < NumSourcesAtTop)
+        {
+            ++MergedPackets;
+            Response = MergeUniverseHtp (UniverseIndex, TopPriority, BytesToCopy, Now);
+        }
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return Response;
+
+} // SelectSourceData
+
+//-----------------------------------------------------------------------------
+/*
+    Find the entry for the CID in the packet. A new CID takes a free entry
+    or one whose source has gone quiet on every universe.
+*/
+c_InputE131::Source_t * c_InputE131::FindSource (const uint8_t * RawPacket, uint32_t Now)
+{
+    // DEBUG_START;
+
+    Source_t * Response    = nullptr;
+    Source_t * pFreeSource = nullptr;
+    const uint8_t * Cid    = &RawPacket[E131_CID_OFFSET];
+
+    for (auto & CurrentSource : Sources)
+    {
+        if (CurrentSource.InUse && (0 == memcmp (CurrentSource.Cid, Cid, E131_CID_LEN)))
+        {
+            Response = &CurrentSource;
+            break;
+        }
+
+        if (nullptr != pFreeSource)
+        {
+            continue;
+        }
+
+        bool SourceIsQuiet = true;
+        for (uint32_t UniverseIndex = 0; CurrentSource.InUse && (UniverseIndex < MAX_NUM_UNIVERSES); ++UniverseIndex)
+        {
+            if (SourceIsActive (CurrentSource, UniverseIndex, Now))
+            {
+                SourceIsQuiet = false;
+                break;
+            }
+        }
+
+        if (SourceIsQuiet)
+        {
+            pFreeSource = &CurrentSource;
+        }
+    }
+
+    if ((nullptr == Response) && (nullptr != pFreeSource))
+    {
+        // the merge buffer is the same size for every source. Keep it.
+        uint8_t * pData = pFreeSource->pData;
+        memset ((void*)pFreeSource, 0x00, sizeof (Source_t));
+        pFreeSource->pData = pData;
+
+        pFreeSource->InUse = true;
+        memcpy (pFreeSource->Cid, Cid, E131_CID_LEN);
+        memcpy (pFreeSource->Name, &RawPacket[E131_SOURCE_NAME_OFFSET], E131_SOURCE_NAME_LEN);
+        pFreeSource->Name[E131_SOURCE_NAME_LEN] = 0x00;
+
+        Response = pFreeSource;
+    }
+
+    // DEBUG_END;
+
+    return Response;
+
+} // FindSource
+
+//-----------------------------------------------------------------------------
+bool c_InputE131::SourceIsActive (Source_t & Source, uint32_t UniverseIndex, uint32_t Now)
+{
+    return Source.InUse &&
+           (0 != Source.UniverseLastSeenMS[UniverseIndex]) &&
+           ((Now - Source.UniverseLastSeenMS[UniverseIndex]) <= E131_SOURCE_TIMEOUT_MS);
+
+} // SourceIsActive
+
+//-----------------------------------------------------------------------------
+/*
+    Keep a copy of the universe for HTP merging. The merge reads whole words
+    of every source so the part of the universe the packet did not fill is
+    cleared.
+*/
+bool c_InputE131::StoreSourceData (Source_t & Source, uint32_t UniverseIndex, uint8_t * UniverseData, uint32_t BytesToCopy)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        if (0 == SourceDataNumUniverses)
+        {
+            // every source is sized for the same layout
+            SourceDataNumUniverses = LastUniverse - startUniverse + 1;
+        }
+
+        if (UniverseIndex >= SourceDataNumUniverses)
+        {
+            // DEBUG_V ("The layout changed under this packet");
+            break;
+        }
+
+        if (nullptr == Source.pData)
+        {
+            Source.pData = (uint8_t *)calloc (SourceDataNumUniverses, UNIVERSE_MAX);
+            if (nullptr == Source.pData)
+            {
+                break;
+            }
+        }
+
+        uint8_t * pUniverse = &Source.pData[UniverseIndex * UNIVERSE_MAX];
+        memcpy (pUniverse, UniverseData, BytesToCopy);
+        memset (&pUniverse[BytesToCopy], 0x00, UNIVERSE_MAX - BytesToCopy);
+
+        Response = true;
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return Response;
+
+} // StoreSourceData
+
+//-----------------------------------------------------------------------------
+/*
+    Highest value per channel across the sources that share the winning
+    priority. Each source keeps its universes on word boundaries so the
+    merge runs a word at a time.
+*/
+uint8_t * c_InputE131::MergeUniverseHtp (uint32_t UniverseIndex, uint8_t TopPriority, uint32_t BytesToCopy, uint32_t Now)
+{
+    // DEBUG_START;
+
+    uint32_t NumWords    = (BytesToCopy + sizeof (uint32_t) - 1) / sizeof (uint32_t);
+    bool     FirstSource = true;
+
+    for (auto & CurrentSource : Sources)
+    {
+        if ((nullptr == CurrentSource.pData) ||
+            !SourceIsActive (CurrentSource, UniverseIndex, Now) ||
+            (TopPriority != CurrentSource.UniversePriority[UniverseIndex]))
+        {
+            continue;
+        }
+
+        const uint32_t * pSourceWords = (const uint32_t *)&CurrentSource.pData[UniverseIndex * UNIVERSE_MAX];
+
+        if (FirstSource)
+        {
+            memcpy (MergeBuffer, pSourceWords, NumWords * sizeof (uint32_t));
+            FirstSource = false;
+            continue;
+        }
+
+        E131MergeWordsHtp (MergeBuffer, pSourceWords, NumWords);
+    }
+
+    // DEBUG_END;
+
+    return (uint8_t *)MergeBuffer;
+
+} // MergeUniverseHtp
+
+//-----------------------------------------------------------------------------
+void c_InputE131::ResetSources ()
+{
+    // DEBUG_START;
+
+    for (auto & CurrentSource : Sources)
+    {
+        if (nullptr != CurrentSource.pData)
+        {
+            free (CurrentSource.pData);
+        }
+    }
+    memset ((void*)Sources, 0x00, sizeof (Sources));
+    SourceDataNumUniverses = 0;
+
+    // DEBUG_END;
+
+} // ResetSources
+
+//-----------------------------------------------------------------------------
+void c_InputE131::ProcessIncomingE131Sync (uint16_t SyncUniverse)
+{
+    // DEBUG_START;
+
+    // from now on the staged frames wait for the sender to release them
+    SyncPacketsReceived = true;
+
+    if ((SyncUniverse == SyncAddress) && (0 != NumStagedUniverses))
+    {
+        ++SyncedFrames;
+        PresentSyncedUniverses ();
+    }
+
+    // DEBUG_END;
+
+} // ProcessIncomingE131Sync
+
+//-----------------------------------------------------------------------------
+/*
+    Copy all of the staged universes to the outputs in one pass. Synced
+    universes that have not arrived for this frame are counted as late.
+*/
+void c_InputE131::PresentSyncedUniverses ()
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if (0 == NumStagedUniverses)
+        {
+            // nothing to present
+            break;
+        }
+
+        for (auto & CurrentUniverse : UniverseArray)
+        {
+            if (CurrentUniverse.IsStaged &&
+                ((CurrentUniverse.DestinationOffset + CurrentUniverse.StagedBytes) <= SyncBufferSize))
+            {
+                OutputMgr.WriteChannelData (CurrentUniverse.DestinationOffset,
+                                            CurrentUniverse.StagedBytes,
+                                            &pSyncBuffer[CurrentUniverse.DestinationOffset]);
+                CurrentUniverse.IsStaged = false;
+            }
+            else if (CurrentUniverse.IsSynced)
+            {
+                ++LateUniverses;
+            }
+        }
+
+        NumStagedUniverses = 0;
+        LatencyStats.DataWritten (CurrentArrivalTimeInMicroSec);
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // PresentSyncedUniverses
+
+//-----------------------------------------------------------------------------
+void c_InputE131::StageSyncedUniverse (Universe_t & CurrentUniverse, uint16_t NewSyncAddress, uint8_t * E131Data, uint32_t NumBytesOfE131Data)
+{
+    // DEBUG_START;
+
+    uint32_t BytesToCopy = min (CurrentUniverse.BytesToCopy, NumBytesOfE131Data);
+
+    do // once
+    {
+        if ((nullptr != pSyncBuffer) && (SyncBufferSize != InputDataBufferSize))
+        {
+            // DEBUG_V ("The staged data no longer fits the buffer");
+            FreeSyncBuffer ();
+        }
+
+        if (nullptr == pSyncBuffer)
+        {
+            SyncBufferSize = InputDataBufferSize;
+            pSyncBuffer = (uint8_t *)malloc (SyncBufferSize);
+            if (nullptr == pSyncBuffer)
+            {
+                SyncBufferSize = 0;
+
+                // no memory for staging. Present the data as it arrives
+                OutputMgr.WriteChannelData (CurrentUniverse.DestinationOffset, BytesToCopy, E131Data);
+                LatencyStats.DataWritten (CurrentArrivalTimeInMicroSec);
+                break;
+            }
+        }
+
+        if (NewSyncAddress != SyncAddress)
+        {
+            // the stream moved to a new sync universe. Show what we have and start over
+            PresentSyncedUniverses ();
+            SyncAddress = NewSyncAddress;
+        }
+        else if (CurrentUniverse.IsStaged ||
+                 ((0 != NumStagedUniverses) && ((millis () - SyncFrameStartTimeMS) > E131_SYNC_TIMEOUT_MS)))
+        {
+            // the sync packet for the staged frame never arrived
+            ++SyncTimeouts;
+            PresentSyncedUniverses ();
+        }
+
+        if ((CurrentUniverse.DestinationOffset + BytesToCopy) > SyncBufferSize)
+        {
+            // DEBUG_V ("The layout changed under this packet");
+            break;
+        }
+
+        if (0 == NumStagedUniverses)
+        {
+            SyncFrameStartTimeMS = millis ();
+        }
+
+        memcpy (&pSyncBuffer[CurrentUniverse.DestinationOffset], E131Data, BytesToCopy);
+        CurrentUniverse.StagedBytes = BytesToCopy;
+        CurrentUniverse.IsStaged = true;
+        CurrentUniverse.IsSynced = true;
+        ++NumStagedUniverses;
+
+        if (SyncPacketsReceived)
+        {
+            // wait for the sync packet
+            break;
+        }
+
+        // No sync packets from the sender. Present the frame once every synced universe is in
+        bool FrameIsComplete = true;
+        for (auto & Universe : UniverseArray)
+        {
+            if (Universe.IsSynced && !Universe.IsStaged)
+            {
+                FrameIsComplete = false;
+                break;
+            }
+        }
+
+        if (FrameIsComplete)
+        {
+            ++SyncedFrames;
+            PresentSyncedUniverses ();
+        }
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // StageSyncedUniverse
+
 //-----------------------------------------------------------------------------
 void c_InputE131::SetBufferInfo (uint32_t BufferSize)
 {
     // DEBUG_START;
 
+    if (InputDataBufferSize != BufferSize)
+    {
+        // the packet context drops the staged and merge data
+        LayoutChanged = true;
+    }
+
     InputDataBufferSize = BufferSize;
 
     if (HasBeenInitialized)
@@ -236,7 +903,6 @@ void c_InputE131::SetBufferTranslation ()
         CurrentUniverse.BytesToCopy = BytesInThisUniverse;
         CurrentUniverse.SourceDataOffset = InputOffset;
         CurrentUniverse.SequenceErrorCounter = 0;
-        CurrentUniverse.SequenceNumber = 0;
 
         // DEBUG_V (String ("        Destination: 0x") + String (uint32_t (CurrentUniverse.Destination), HEX));
         // DEBUG_V (String ("        BytesToCopy:   ") + String (CurrentUniverse.BytesToCopy));
@@ -249,6 +915,8 @@ void c_InputE131::SetBufferTranslation ()
         // DEBUG_V (String ("     BytesLeftToMap:   ") + String (BytesLeftToMap));
     }
 
+    // the staged universes are dropped by the packet context. See ApplyLayoutChange
+
     if (0 != BytesLeftToMap)
     {
         logcon (String (F ("ERROR: Universe configuration is too small to fill output buffer. Outputs have been truncated.")));
@@ -264,11 +932,16 @@ bool c_InputE131::SetConfig (ArduinoJson::JsonObject& jsonConfig)
     // DEBUG_START;
 
     ESPAsyncE131PortId OldPortId = PortId;
+    uint16_t OldStartUniverse = startUniverse;
+    uint16_t OldLastUniverse  = LastUniverse;
+    uint16_t OldChannelsPerUniverse        = ChannelsPerUniverse;
+    uint16_t OldFirstUniverseChannelOffset = FirstUniverseChannelOffset;
 
     setFromJSON (startUniverse,              jsonConfig, CN_universe);
     setFromJSON (ChannelsPerUniverse,        jsonConfig, CN_universe_limit);
     setFromJSON (FirstUniverseChannelOffset, jsonConfig, CN_universe_start);
     setFromJSON (PortId,                     jsonConfig, CN_port);
+    setFromJSON (MergeMode,                  jsonConfig, CN_merge);
 
     if ((OldPortId != PortId) && (ESPAsyncE131Initialized))
     {
@@ -279,6 +952,21 @@ bool c_InputE131::SetConfig (ArduinoJson::JsonObject& jsonConfig)
 
     validateConfiguration ();
 
+    if ((OldStartUniverse != startUniverse) ||
+        (OldLastUniverse  != LastUniverse) ||
+        (OldChannelsPerUniverse != ChannelsPerUniverse) ||
+        (OldFirstUniverseChannelOffset != FirstUniverseChannelOffset))
+    {
+        // the packet context starts the source tracking over
+        LayoutChanged = true;
+    }
+
+    if (ESPAsyncE131Initialized && ((OldStartUniverse != startUniverse) || (OldLastUniverse != LastUniverse)))
+    {
+        // subscribe to the groups for the new universe range
+        NetworkStateChanged (NetworkMgr.IsConnected (), false);
+    }
+
     // Update the config fields in case the validator changed them
     GetConfig (jsonConfig);
 
@@ -337,6 +1025,12 @@ void c_InputE131::validateConfiguration ()
         LastUniverse = startUniverse + span / ChannelsPerUniverse - 1;
     }
 
+    if ((LastUniverse - startUniverse) >= MAX_NUM_UNIVERSES)
+    {
+        // small universes can need more entries than the tables have
+        LastUniverse = startUniverse + MAX_NUM_UNIVERSES - 1;
+    }
+
     // DEBUG_V ("");
 
     SetBufferTranslation ();
@@ -352,24 +1046,86 @@ void c_InputE131::NetworkStateChanged (bool IsConnected)
 } // NetworkStateChanged
 
 //-----------------------------------------------------------------------------
-void c_InputE131::NetworkStateChanged (bool IsConnected, bool ReBootAllowed)
+/*
+    Join one multicast group per universe in use. Joining more groups than
+    lwIP and the WiFi driver can hold fails part way through and universes
+    go missing without notice. If the range is too large no groups are
+    joined and the universes have to be sent by unicast.
+*/
+void c_InputE131::UpdateMulticastGroups (bool IsConnected)
 {
     // DEBUG_START;
 
-    if (IsConnected)
+    uint16_t NumUniverses = LastUniverse - startUniverse + 1;
+
+    do // once
     {
-        // Get on with business
-        if (e131->begin (e131_listen_t::E131_MULTICAST, PortId, startUniverse, LastUniverse - startUniverse + 1))
+        if (!IsConnected)
         {
-            // logcon (String (F ("Multicast enabled")));
+            // join them again once we are back on the network
+            LeaveMulticastGroups ();
+            break;
         }
-        else
+
+        if ((0 != NumJoinedUniverses) && (JoinedFirstUniverse == startUniverse) && (NumJoinedUniverses == NumUniverses))
+        {
+            // DEBUG_V ("Already subscribed");
+            break;
+        }
+
+        LeaveMulticastGroups ();
+
+        MulticastIsLimited = (NumUniverses > E131_MAX_MULTICAST_GROUPS);
+        if (MulticastIsLimited)
+        {
+            logcon (String (F ("E1.31: ")) + NumUniverses + F (" universes is more than the ") + E131_MAX_MULTICAST_GROUPS +
+                    F (" multicast groups the network stack can join. Listening for unicast only."));
+            break;
+        }
+
+        if (!e131->begin (e131_listen_t::E131_MULTICAST, PortId, startUniverse, NumUniverses))
         {
             logcon (String (CN_stars) + F (" E1.31 MULTICAST INIT FAILED ") + CN_stars);
+            break;
         }
 
-        // DEBUG_V ("");
+        JoinedFirstUniverse = startUniverse;
+        NumJoinedUniverses  = NumUniverses;
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // UpdateMulticastGroups
+
+//-----------------------------------------------------------------------------
+void c_InputE131::LeaveMulticastGroups ()
+{
+    // DEBUG_START;
+
+    for (uint32_t Universe = JoinedFirstUniverse; Universe < (uint32_t (JoinedFirstUniverse) + NumJoinedUniverses); ++Universe)
+    {
+        ip4_addr_t GroupAddress;
+        IP4_ADDR (&GroupAddress, 239, 255, ((Universe >> 8) & 0xff), (Universe & 0xff));
+        igmp_leavegroup (IP4_ADDR_ANY4, &GroupAddress);
+    }
 
+    NumJoinedUniverses = 0;
+
+    // DEBUG_END;
+
+} // LeaveMulticastGroups
+
+//-----------------------------------------------------------------------------
+void c_InputE131::NetworkStateChanged (bool IsConnected, bool ReBootAllowed)
+{
+    // DEBUG_START;
+
+    UpdateMulticastGroups (IsConnected);
+
+    if (IsConnected)
+    {
+        // Get on with business. Multicast packets for the joined groups arrive on the unicast listener
         if (e131->begin (e131_listen_t::E131_UNICAST, PortId, startUniverse, LastUniverse - startUniverse + 1))
         {
             // logcon (String (F ("Listening on port ")) + PortId);
@@ -19,6 +19,7 @@
 */
 
 #include "InputCommon.hpp"
+#include "InputTimingStats.hpp"
 #include <ESPAsyncE131.h>
 
 class c_InputE131 : public c_InputCommon
@@ -47,13 +48,82 @@ class c_InputE131 : public c_InputCommon
       uint32_t   DestinationOffset;
       uint32_t   BytesToCopy;
       uint32_t   SourceDataOffset;
-      uint8_t  SequenceNumber;
       uint32_t SequenceErrorCounter;
+      bool     IsSynced;        ///< Last packet carried a synchronization address
+      bool     IsStaged;        ///< Data is waiting in the sync buffer
+      uint32_t StagedBytes;
+      uint32_t num_packets;     ///< Packets used for this universe (its multicast group when joined)
+      c_InputArrivalStats ArrivalStats;
 
     } Universe_t;
     Universe_t UniverseArray[MAX_NUM_UNIVERSES];
 
+    /// Universe synchronization (E1.31-2016 6.2.4 and 6.3)
+#define E131_SYNC_TIMEOUT_MS    100
+    uint8_t   * pSyncBuffer             = nullptr;  ///< Staged data for synchronized universes. Same layout as the output buffer. Only used by the packet context
+    uint32_t    SyncBufferSize          = 0;
+    uint16_t    SyncAddress             = 0;        ///< Sync universe of the staged stream
+    bool        SyncPacketsReceived     = false;    ///< Once seen, frames are only presented by a sync packet or a timeout
+    uint32_t    SyncFrameStartTimeMS    = 0;        ///< When the first universe of the staged frame arrived
+    uint32_t    NumStagedUniverses      = 0;
+    uint32_t    SyncedFrames            = 0;
+    uint32_t    SyncTimeouts            = 0;
+    uint32_t    LateUniverses           = 0;
+
+    /// Sources. Sequence numbers and priority are tracked per source (E1.31 6.7.2 and 6.9)
+#define E131_MAX_SOURCES            4
+#define E131_SOURCE_TIMEOUT_MS      2500    ///< E131_NETWORK_DATA_LOSS_TIMEOUT
+#define E131_CID_LEN                16
+#define E131_SOURCE_NAME_LEN        64
+#define E131_MERGE_LTP              0       ///< Highest priority wins. Equal priorities: latest packet wins
+#define E131_MERGE_HTP              1       ///< Highest priority wins. Equal priorities: highest value per channel wins
+
+    typedef struct
+    {
+      bool      InUse;
+      uint8_t   Cid[E131_CID_LEN];
+      char      Name[E131_SOURCE_NAME_LEN + 1];
+      uint8_t   Priority;                                   ///< From the last packet
+      uint8_t   SequenceNumber[MAX_NUM_UNIVERSES];
+      uint8_t   UniversePriority[MAX_NUM_UNIVERSES];
+      uint32_t  UniverseLastSeenMS[MAX_NUM_UNIVERSES];      ///< 0 = no data for the universe
+      uint8_t * pData;                                      ///< HTP: UNIVERSE_MAX bytes per universe
+      uint32_t  num_packets;
+      uint32_t  SequenceErrorCounter;
+      uint32_t  DiscardedPackets;                           ///< Out of order or below the winning priority
+    } Source_t;
+    Source_t    Sources[E131_MAX_SOURCES];
+    uint8_t     MergeMode                   = E131_MERGE_LTP;
+    uint32_t    SourceLimitDrops            = 0;            ///< Packets from more than E131_MAX_SOURCES sources
+    uint32_t    MergedPackets               = 0;
+    uint32_t    SourceDataNumUniverses      = 0;            ///< Universes each pData was allocated for. 0 = not yet sized
+    volatile bool LayoutChanged             = false;        ///< Set by the config path. The packet context drops the data kept for the old layout
+    uint32_t    MergeBuffer[UNIVERSE_MAX / sizeof (uint32_t)];
+
+    c_InputLatencyStats LatencyStats;
+    uint32_t    CurrentArrivalTimeInMicroSec = 0;           ///< Receive time of the packet being processed
+
+    /// Multicast subscriptions. One group per universe. lwIP has room for eight
+    /// groups per interface and the all hosts group, mDNS and FPP discovery use three.
+#define E131_MAX_MULTICAST_GROUPS   5
+    uint16_t    JoinedFirstUniverse         = 0;
+    uint16_t    NumJoinedUniverses          = 0;            ///< 0 = no groups joined
+    bool        MulticastIsLimited          = false;        ///< Too many universes. Listening to unicast only
+
     void validateConfiguration ();
+    uint8_t  * SelectSourceData (e131_packet_t * packet, uint32_t UniverseIndex, uint8_t * UniverseData, uint32_t BytesToCopy);
+    Source_t * FindSource (const uint8_t * RawPacket, uint32_t Now);
+    bool       SourceIsActive (Source_t & Source, uint32_t UniverseIndex, uint32_t Now);
+    bool       StoreSourceData (Source_t & Source, uint32_t UniverseIndex, uint8_t * UniverseData, uint32_t BytesToCopy);
+    uint8_t  * MergeUniverseHtp (uint32_t UniverseIndex, uint8_t TopPriority, uint32_t BytesToCopy, uint32_t Now);
+    void       ResetSources ();
+    void       ApplyLayoutChange ();
+    void       UpdateMulticastGroups (bool IsConnected);
+    void       LeaveMulticastGroups ();
+    void StageSyncedUniverse (Universe_t & CurrentUniverse, uint16_t NewSyncAddress, uint8_t * E131Data, uint32_t NumBytesOfE131Data);
+    void ProcessIncomingE131Sync (uint16_t SyncUniverse);
+    void PresentSyncedUniverses ();
+    void FreeSyncBuffer ();
     void NetworkStateChanged (bool IsConnected, bool RebootAllowed); // used by poorly designed rx functions
     void SetBufferTranslation ();
 
@@ -75,4 +145,8 @@ class c_InputE131 : public c_InputCommon
     void NetworkStateChanged (bool IsConnected); // used by poorly designed rx functions
     bool isShutDownRebootNeeded () { return HasBeenInitialized; }
     void ProcessIncomingE131Data (e131_packet_t *);
+    void QueueIncomingE131Data (e131_packet_t *);
+    void ProcessQueuedPacket (uint8_t * Data, uint32_t Length, IPAddress RemoteIP, uint32_t ArrivalTimeInMicroSec);
+    void ProcessQueuedTimer ();
+    void ResetTimingStats ();
 };
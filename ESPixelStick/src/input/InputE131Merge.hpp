@@ -0,0 +1,54 @@
+#pragma once
+/*
+* InputE131Merge.hpp - Highest takes precedence merge helpers for the E1.31 input
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   These functions only depend on the standard integer types so that they
+*   can be built and checked on a host as well as on the target.
+*
+*/
+
+#include <stdint.h>
+
+//----------------------------------------------------------------------------
+/*
+    Per byte maximum of two words. The low seven bits of each byte are
+    compared with a subtract that cannot borrow out of the byte. The top
+    bits settle the rest. The result is a 0x00 or 0xFF mask per byte.
+*/
+inline uint32_t E131MaxBytes (uint32_t a, uint32_t b)
+{
+    uint32_t LowBitsGe = (a | 0x80808080) - (b & 0x7F7F7F7F);
+    uint32_t Ge        = ((a & ~b) | (~(a ^ b) & LowBitsGe)) & 0x80808080;
+    uint32_t Mask      = (Ge >> 7) * 0xFF;
+
+    return (a & Mask) | (b & ~Mask);
+
+} // E131MaxBytes
+
+//----------------------------------------------------------------------------
+/*
+    Merge NumWords words of source data into the target, keeping the
+    highest value of each byte.
+*/
+inline void E131MergeWordsHtp (uint32_t * pTarget, const uint32_t * pSource, uint32_t NumWords)
+{
+    for (uint32_t WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+    {
+        pTarget[WordIndex] = E131MaxBytes (pTarget[WordIndex], pSource[WordIndex]);
+    }
+
+} // E131MergeWordsHtp
@@ -164,7 +164,10 @@ bool c_InputFPPRemote::SetConfig (JsonObject& jsonConfig)
 
     // DEBUG_V ("Config Processing");
     // Clear outbuffer on config change
+    OutputMgr.BeginInputWrite ();
     memset (OutputMgr.GetBufferAddress (), 0x0, OutputMgr.GetBufferUsedSize ());
+    OutputMgr.EndInputWrite ();
+    OutputMgr.SetBufferDirty ();
     StartPlaying (FileToPlay);
 
     // DEBUG_END;
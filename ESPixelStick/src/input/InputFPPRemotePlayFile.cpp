@@ -67,7 +67,7 @@ c_InputFPPRemotePlayFile::c_InputFPPRemotePlayFile (c_InputMgr::e_InputChannelId
     fsm_PlayFile_state_Idle_imp.Init (this);
 
     LastIsrTimeStampMS = millis ();
-    MsTicker.attach_ms (uint32_t (FPP_TICKER_PERIOD_MS), &TimerPollHandler, (void*)this); // Add ISR Function
+    SetTimerPollPeriod (FPP_TICKER_PERIOD_MS);
 
 #ifdef ARDUINO_ARCH_ESP32
     xTaskCreate (TimerPollHandlerTask, "FPPTask", TimerPollHandlerTaskStack, this, ESP_TASK_PRIO_MIN + 4, &TimerPollTaskHandle);
@@ -85,6 +85,11 @@ c_InputFPPRemotePlayFile::~c_InputFPPRemotePlayFile ()
 #ifdef ARDUINO_ARCH_ESP32
     if (NULL != TimerPollTaskHandle)
     {
+        // let a frame in progress finish so that it releases the prefetch ring
+        while (eSuspended != eTaskGetState (TimerPollTaskHandle))
+        {
+            vTaskDelay (pdMS_TO_TICKS (1));
+        }
         vTaskDelete (TimerPollTaskHandle);
         TimerPollTaskHandle = NULL;
     }
@@ -95,6 +100,10 @@ c_InputFPPRemotePlayFile::~c_InputFPPRemotePlayFile ()
         Stop ();
         Poll ();
     }
+
+    FreeSparseRanges ();
+    FreeStagingFrame ();
+
     // DEBUG_END;
 
 } // ~c_InputFPPRemotePlayFile
@@ -223,6 +232,25 @@ void c_InputFPPRemotePlayFile::GetStatus (JsonObject& JsonStatus)
 
     JsonStatus[CN_errors] = LastFailedPlayStatusMsg;
 
+    if (Decoder.IsActive ())
+    {
+        JsonObject JsonDecoderStatus = JsonStatus.createNestedObject (F ("decoder"));
+        Decoder.GetStatus (JsonDecoderStatus);
+    }
+
+    if (Prefetch.IsActive ())
+    {
+        JsonObject JsonPrefetchStatus = JsonStatus.createNestedObject (F ("prefetch"));
+        Prefetch.GetStatus (JsonPrefetchStatus);
+    }
+    else
+    {
+        JsonObject JsonFrameReadStatus = JsonStatus.createNestedObject (F ("framereads"));
+        JsonFrameReadStatus[F ("direct")]    = FrameReadCounts.Direct;
+        JsonFrameReadStatus[F ("staged")]    = FrameReadCounts.Staged;
+        JsonFrameReadStatus[F ("piecewise")] = FrameReadCounts.Piecewise;
+    }
+
     // xDEBUG_END;
 
 } // GetStatus
@@ -284,6 +312,11 @@ bool c_InputFPPRemotePlayFile::ParseFseqFile ()
         FSEQRawHeader    fsqRawHeader;
         FSEQParsedHeader fsqParsedHeader;
 
+        Prefetch.End ();
+        Decoder.End ();
+        FreeStagingFrame ();
+        memset ((void*)&FrameReadCounts, 0x00, sizeof (FrameReadCounts));
+
         FileHandleForFileBeingPlayed = -1;
         if (false == FileMgr.OpenSdFile (PlayItemName,
                                          c_FileMgr::FileMode::FileRead,
@@ -318,8 +351,8 @@ bool c_InputFPPRemotePlayFile::ParseFseqFile ()
         fsqParsedHeader.TotalNumberOfFramesInSequence = read32 (fsqRawHeader.TotalNumberOfFramesInSequence, 0);
         fsqParsedHeader.stepTime                      = fsqRawHeader.stepTime;
         fsqParsedHeader.flags                         = fsqRawHeader.flags;
-        fsqParsedHeader.compressionType               = fsqRawHeader.compressionType;
-        fsqParsedHeader.numCompressedBlocks           = fsqRawHeader.numCompressedBlocks;
+        fsqParsedHeader.compressionType               = fsqRawHeader.compressionType & FSEQ_COMPRESSION_TYPE_MASK;
+        fsqParsedHeader.numCompressedBlocks           = fsqRawHeader.numCompressedBlocks + (uint16_t (fsqRawHeader.compressionType & FSEQ_COMPRESSED_BLOCK_COUNT_MASK) << 4);
         fsqParsedHeader.numSparseRanges               = fsqRawHeader.numSparseRanges;
         fsqParsedHeader.flags2                        = fsqRawHeader.flags2;
         fsqParsedHeader.id                            = read64 (fsqRawHeader.id, 0);
@@ -341,16 +374,32 @@ bool c_InputFPPRemotePlayFile::ParseFseqFile ()
         DEBUG_V (String ("                           id: 0x") + String ((unsigned long)fsqParsedHeader.id, HEX));
 #endif // def DUMP_FSEQ_HEADER
 
-        if (fsqParsedHeader.majorVersion != 2 || fsqParsedHeader.compressionType != 0)
+        if (fsqParsedHeader.majorVersion != 2)
         {
-            LastFailedPlayStatusMsg = (String (F ("ParseFseqFile:: Could not start. ")) + PlayItemName + F (" is not a v2 uncompressed sequence"));
+            LastFailedPlayStatusMsg = (String (F ("ParseFseqFile:: Could not start. ")) + PlayItemName + F (" is not a v2 sequence"));
             logcon (LastFailedPlayStatusMsg);
             break;
         }
+
+        if (FSEQ_COMPRESSION_NONE != fsqParsedHeader.compressionType)
+        {
+            c_FileMgr::FileId FileHandle = FileHandleForFileBeingPlayed;
+            auto ReadHandler = [FileHandle] (uint8_t * Buffer, uint32_t NumBytes, uint32_t FileOffset)
+            {
+                return uint32_t (FileMgr.ReadSdFile (FileHandle, Buffer, NumBytes, FileOffset));
+            };
+
+            if (!Decoder.Begin (ReadHandler, FileMgr.GetSdFileSize (FileHandleForFileBeingPlayed), fsqParsedHeader))
+            {
+                LastFailedPlayStatusMsg = (String (F ("ParseFseqFile:: Could not start. ")) + PlayItemName + F (": ") + Decoder.GetErrorMsg ());
+                logcon (LastFailedPlayStatusMsg);
+                break;
+            }
+        }
         // DEBUG_V ("");
         size_t FileSize = FileMgr.GetSdFileSize (FileHandleForFileBeingPlayed);
         size_t ExpectedSize = fsqParsedHeader.TotalNumberOfFramesInSequence * fsqParsedHeader.channelCount;
-        if ((ExpectedSize) > FileSize)
+        if (!Decoder.IsActive () && ((ExpectedSize) > FileSize))
         {
             LastFailedPlayStatusMsg = (String (F ("ParseFseqFile:: Could not start: ")) + PlayItemName +
                                       F (" File does not contain enough data to meet the Stated Channel Count * Number of Frames value. Expected ") +
@@ -359,102 +408,215 @@ bool c_InputFPPRemotePlayFile::ParseFseqFile ()
             break;
         }
 
-        FrameControl.FrameStepTimeMS = max ((uint8_t)25, fsqParsedHeader.stepTime);
+        // only go below 40 fps when an output can make use of it
+        uint32_t MinFrameStepTimeMS = (OutputMgr.HighRefreshRateIsEnabled ()) ? FSEQ_MIN_FRAME_STEP_TIME_MS : FSEQ_DEFAULT_MIN_FRAME_STEP_TIME_MS;
+        FrameControl.FrameStepTimeMS = max (MinFrameStepTimeMS, uint32_t (fsqParsedHeader.stepTime));
+        SetTimerPollPeriod (min (uint32_t (FPP_TICKER_PERIOD_MS), FrameControl.FrameStepTimeMS));
         FrameControl.TotalNumberOfFramesInSequence = fsqParsedHeader.TotalNumberOfFramesInSequence;
 
         FrameControl.DataOffset = fsqParsedHeader.dataOffset;
         FrameControl.ChannelsPerFrame = fsqParsedHeader.channelCount;
 
-        memset ((void*)&SparseRanges, 0x00, sizeof (SparseRanges));
-        if (fsqParsedHeader.numSparseRanges)
+        if (!ParseSparseRanges (fsqParsedHeader))
+        {
+            break;
+        }
+
+        // falls back to reading each frame when it is due
+        if (!Prefetch.Begin (GetFrameReadLength (), FrameControl.TotalNumberOfFramesInSequence) &&
+            !Decoder.IsActive () &&
+            !OutputMgr.ChannelDataIsUnchanged ())
         {
-            if (MAX_NUM_SPARSE_RANGES < fsqParsedHeader.numSparseRanges)
+            // the outputs need the channel data handed to them. Stage a whole frame.
+            StagingFrameSize = GetFrameReadLength ();
+            pStagingFrame = (uint8_t *)malloc (StagingFrameSize);
+            if (nullptr == pStagingFrame)
             {
-                LastFailedPlayStatusMsg =  (String (F ("ParseFseqFile:: Could not start. ")) + PlayItemName + F (" Too many sparse ranges defined in file header."));
-                logcon (LastFailedPlayStatusMsg);
-                break;
+                // DEBUG_V ("Could not allocate the staging frame. Frames will be copied in pieces");
+                StagingFrameSize = 0;
             }
+        }
+
+        PlayedFileCount++;
+        Response = true;
 
-            FSEQRawRangeEntry FseqRawRanges[MAX_NUM_SPARSE_RANGES];
+    } while (false);
 
-            FileMgr.ReadSdFile (FileHandleForFileBeingPlayed,
-                                (uint8_t*)&FseqRawRanges[0],
-                                sizeof (FseqRawRanges),
-                                sizeof (FSEQRawHeader) + fsqParsedHeader.numCompressedBlocks * 8);
+    if (!Response)
+    {
+        Decoder.End ();
+    }
 
-            uint32_t SparseRangeIndex = 0;
-            uint32_t TotalChannels = 0;
-            uint32_t LargestBlock = 0;
-            for (auto & CurrentSparseRange : SparseRanges)
-            {
-                // DEBUG_V (String ("           Sparse Range Index: ") + String (SparseRangeIndex));
-                if (SparseRangeIndex >= fsqParsedHeader.numSparseRanges)
-                {
-                    // DEBUG_V (String ("No Sparse Range Data for this entry "));
-                    ++SparseRangeIndex;
-                    continue;
-                }
+    // Caller must close the file since it is used to play the channel data.
 
-                // CurrentSparseRange.DataOffset = read24 (FseqRawRanges[SparseRangeIndex].Start);
-                CurrentSparseRange.DataOffset = TotalChannels;
-                CurrentSparseRange.ChannelCount = read24 (FseqRawRanges[SparseRangeIndex].Length);
-                TotalChannels += CurrentSparseRange.ChannelCount;
-                LargestBlock  = max (LargestBlock, CurrentSparseRange.DataOffset + CurrentSparseRange.ChannelCount);
+    // DEBUG_END;
 
-#ifdef DUMP_FSEQ_HEADER
-                // DEBUG_V (String ("            RangeChannelCount: ") + String (CurrentSparseRange.ChannelCount));
-                // DEBUG_V (String ("              RangeDataOffset: 0x") + String (CurrentSparseRange.DataOffset, HEX));
-#endif // def DUMP_FSEQ_HEADER
+    return Response;
 
-                ++SparseRangeIndex;
-            }
+} // ParseFseqFile
 
-#ifdef DUMP_FSEQ_HEADER
-            // DEBUG_V (String ("                TotalChannels: ") + String (TotalChannels));
-            // DEBUG_V (String ("                 LargestBlock: ") + String (LargestBlock));
-#endif // def DUMP_FSEQ_HEADER
-            if (0 == TotalChannels)
+//-----------------------------------------------------------------------------
+/*
+    A sparse file only stores the channels in its ranges. The ranges are
+    packed one after the other in each frame. Each range is written to the
+    output buffer at its start channel, relative to the lowest start channel
+    in the file so that the first channel in the file lands on the first
+    output channel.
+*/
+bool c_InputFPPRemotePlayFile::ParseSparseRanges (FSEQParsedHeader & fsqParsedHeader)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+    FSEQRawRangeEntry * pFseqRawRanges = nullptr;
+
+    do // once
+    {
+        FreeSparseRanges ();
+
+        uint32_t MaxNumRanges = max (uint32_t (1), uint32_t (fsqParsedHeader.numSparseRanges));
+        pSparseRanges = (FSEQParsedRangeEntry *)malloc (MaxNumRanges * sizeof (FSEQParsedRangeEntry));
+        if (nullptr == pSparseRanges)
+        {
+            LastFailedPlayStatusMsg = (String (F ("ParseFseqFile:: Could not start. ")) + PlayItemName + F (" Could not allocate the Sparse Range table."));
+            logcon (LastFailedPlayStatusMsg);
+            break;
+        }
+
+        // default to playing the whole frame
+        NumSparseRanges = 1;
+        pSparseRanges[0].DataOffset        = 0;
+        pSparseRanges[0].ChannelCount      = fsqParsedHeader.channelCount;
+        pSparseRanges[0].DestinationOffset = 0;
+        Response = true;
+
+        if (0 == fsqParsedHeader.numSparseRanges)
+        {
+            break;
+        }
+
+        uint32_t RawRangesSize = fsqParsedHeader.numSparseRanges * sizeof (FSEQRawRangeEntry);
+        pFseqRawRanges = (FSEQRawRangeEntry *)malloc (RawRangesSize);
+        if (nullptr == pFseqRawRanges)
+        {
+            LastFailedPlayStatusMsg = (String (F ("ParseFseqFile:: Ignoring Range Info. ")) + PlayItemName + F (" Could not allocate space to read the Sparse Ranges."));
+            logcon (LastFailedPlayStatusMsg);
+            break;
+        }
+
+        if (RawRangesSize != FileMgr.ReadSdFile (FileHandleForFileBeingPlayed,
+                                                 (uint8_t*)pFseqRawRanges,
+                                                 RawRangesSize,
+                                                 sizeof (FSEQRawHeader) + fsqParsedHeader.numCompressedBlocks * sizeof (FSEQRawCompressedBlockEntry)))
+        {
+            LastFailedPlayStatusMsg = (String (F ("ParseFseqFile:: Ignoring Range Info. ")) + PlayItemName + F (" Could not read the Sparse Ranges."));
+            logcon (LastFailedPlayStatusMsg);
+            break;
+        }
+
+        uint32_t FirstChannel = uint32_t (-1);
+        for (uint32_t RangeIndex = 0; RangeIndex < fsqParsedHeader.numSparseRanges; ++RangeIndex)
+        {
+            if (0 != read24 (pFseqRawRanges[RangeIndex].Length))
             {
-                LastFailedPlayStatusMsg = (String (F ("ParseFseqFile:: Ignoring Range Info. ")) + PlayItemName + F (" No channels defined in Sparse Ranges."));
-                logcon (LastFailedPlayStatusMsg);
-                memset ((void*)&SparseRanges, 0x00, sizeof (SparseRanges));
-                SparseRanges[0].ChannelCount = fsqParsedHeader.channelCount;
+                FirstChannel = min (FirstChannel, read24 (pFseqRawRanges[RangeIndex].Start));
             }
+        }
 
-            else if (TotalChannels > fsqParsedHeader.channelCount)
+        uint32_t TotalChannels = 0;
+        uint32_t NumRanges = 0;
+        for (uint32_t RangeIndex = 0; RangeIndex < fsqParsedHeader.numSparseRanges; ++RangeIndex)
+        {
+            uint32_t ChannelCount = read24 (pFseqRawRanges[RangeIndex].Length);
+            if (0 == ChannelCount)
             {
-                LastFailedPlayStatusMsg = (String (F ("ParseFseqFile:: Ignoring Range Info. ")) + PlayItemName + F (" Too many channels defined in Sparse Ranges."));
-                logcon (LastFailedPlayStatusMsg);
-                memset ((void*)&SparseRanges, 0x00, sizeof (SparseRanges));
-                SparseRanges[0].ChannelCount = fsqParsedHeader.channelCount;
+                continue;
             }
 
-            else if (LargestBlock > fsqParsedHeader.channelCount)
+            uint32_t DestinationOffset = read24 (pFseqRawRanges[RangeIndex].Start) - FirstChannel;
+
+#ifdef DUMP_FSEQ_HEADER
+            // DEBUG_V (String ("            RangeChannelCount: ") + String (ChannelCount));
+            // DEBUG_V (String ("              RangeDataOffset: 0x") + String (TotalChannels, HEX));
+            // DEBUG_V (String ("       RangeDestinationOffset: 0x") + String (DestinationOffset, HEX));
+#endif // def DUMP_FSEQ_HEADER
+
+            FSEQParsedRangeEntry * pPreviousRange = (0 == NumRanges) ? nullptr : &pSparseRanges[NumRanges - 1];
+            if ((nullptr != pPreviousRange) &&
+                ((pPreviousRange->DestinationOffset + pPreviousRange->ChannelCount) == DestinationOffset))
             {
-                LastFailedPlayStatusMsg = (String (F ("ParseFseqFile:: Ignoring Range Info. ")) + PlayItemName + F (" Sparse Range Frame offset + Num channels is larger than frame size."));
-                logcon (LastFailedPlayStatusMsg);
-                memset ((void*)&SparseRanges, 0x00, sizeof (SparseRanges));
-                SparseRanges[0].ChannelCount = fsqParsedHeader.channelCount;
+                // continues the previous range in the file and in the output buffer
+                pPreviousRange->ChannelCount += ChannelCount;
             }
+            else
+            {
+                pSparseRanges[NumRanges].DataOffset        = TotalChannels;
+                pSparseRanges[NumRanges].ChannelCount      = ChannelCount;
+                pSparseRanges[NumRanges].DestinationOffset = DestinationOffset;
+                ++NumRanges;
+            }
+
+            TotalChannels += ChannelCount;
         }
-        else
+
+#ifdef DUMP_FSEQ_HEADER
+        // DEBUG_V (String ("                TotalChannels: ") + String (TotalChannels));
+        // DEBUG_V (String ("                    NumRanges: ") + String (NumRanges));
+#endif // def DUMP_FSEQ_HEADER
+
+        if (0 == TotalChannels)
         {
-            memset ((void*)&SparseRanges, 0x00, sizeof (SparseRanges));
-            SparseRanges[0].ChannelCount = fsqParsedHeader.channelCount;
+            LastFailedPlayStatusMsg = (String (F ("ParseFseqFile:: Ignoring Range Info. ")) + PlayItemName + F (" No channels defined in Sparse Ranges."));
+            logcon (LastFailedPlayStatusMsg);
+            NumSparseRanges = 1;
+            pSparseRanges[0].DataOffset        = 0;
+            pSparseRanges[0].ChannelCount      = fsqParsedHeader.channelCount;
+            pSparseRanges[0].DestinationOffset = 0;
         }
 
-        PlayedFileCount++;
-        Response = true;
+        else if (TotalChannels > fsqParsedHeader.channelCount)
+        {
+            LastFailedPlayStatusMsg = (String (F ("ParseFseqFile:: Ignoring Range Info. ")) + PlayItemName + F (" Too many channels defined in Sparse Ranges."));
+            logcon (LastFailedPlayStatusMsg);
+            NumSparseRanges = 1;
+            pSparseRanges[0].DataOffset        = 0;
+            pSparseRanges[0].ChannelCount      = fsqParsedHeader.channelCount;
+            pSparseRanges[0].DestinationOffset = 0;
+        }
+
+        else
+        {
+            NumSparseRanges = NumRanges;
+        }
 
     } while (false);
 
-    // Caller must close the file since it is used to play the channel data.
+    if (nullptr != pFseqRawRanges)
+    {
+        free (pFseqRawRanges);
+    }
 
     // DEBUG_END;
 
     return Response;
 
-} // ParseFseqFile
+} // ParseSparseRanges
+
+//-----------------------------------------------------------------------------
+void c_InputFPPRemotePlayFile::FreeSparseRanges ()
+{
+    // DEBUG_START;
+
+    if (nullptr != pSparseRanges)
+    {
+        free (pSparseRanges);
+        pSparseRanges = nullptr;
+    }
+    NumSparseRanges = 0;
+
+    // DEBUG_END;
+
+} // FreeSparseRanges
 
 //-----------------------------------------------------------------------------
 void c_InputFPPRemotePlayFile::ClearFileInfo()
@@ -468,18 +630,49 @@ void c_InputFPPRemotePlayFile::ClearFileInfo()
     FrameControl.FrameStepTimeMS               = 25;
     FrameControl.TotalNumberOfFramesInSequence = 0;
 
+    SetTimerPollPeriod (FPP_TICKER_PERIOD_MS);
+
 } // ClearFileInfo
 
+//-----------------------------------------------------------------------------
+/*
+    The frames are sent from the timer poll so it has to run at least once
+    per frame step. Called from the loop context only.
+*/
+void c_InputFPPRemotePlayFile::SetTimerPollPeriod (uint32_t PeriodMS)
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if (PeriodMS == TimerPollPeriodMS)
+        {
+            break;
+        }
+
+        // keep the time it takes to notice that polls have stopped the same
+        PollDetectionCounterLimit = max (1, int (FPP_POLL_DETECTION_TIME_MS / PeriodMS));
+        PollDetectionCounter = 0;
+
+        MsTicker.detach ();
+        TimerPollPeriodMS = PeriodMS;
+        MsTicker.attach_ms (TimerPollPeriodMS, &TimerPollHandler, (void*)this); // Add ISR Function
+        // DEBUG_V (String ("TimerPollPeriodMS: ") + String (TimerPollPeriodMS));
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // SetTimerPollPeriod
+
+//-----------------------------------------------------------------------------
+/*
+    Fallback when there is no staging buffer. Copies the data in small pieces.
+*/
 uint32_t c_InputFPPRemotePlayFile::ReadFile(uint32_t DestinationIntensityId, uint32_t NumBytesToRead, uint32_t FileOffset)
 {
     // DEBUG_START;
-// #define WRITE_DIRECT_TO_OUTPUT_BUFFER
-#ifdef WRITE_DIRECT_TO_OUTPUT_BUFFER
-    uint32_t NumBytesRead = FileMgr.ReadSdFile(FileHandleForFileBeingPlayed,
-                                             OutputMgr.GetBufferAddress(),
-                                             min((NumBytesToRead), OutputMgr.GetBufferUsedSize()),
-                                             FileOffset);
-#else
+
     uint8_t LocalIntensityBuffer[200];
 
     uint32_t NumBytesRead = 0;
@@ -490,6 +683,10 @@ uint32_t c_InputFPPRemotePlayFile::ReadFile(uint32_t DestinationIntensityId, uin
                                                          LocalIntensityBuffer,
                                                          min((NumBytesToRead - NumBytesRead), sizeof(LocalIntensityBuffer)),
                                                          FileOffset);
+        if (0 == NumBytesReadThisPass)
+        {
+            break;
+        }
 
         OutputMgr.WriteChannelData(DestinationIntensityId, NumBytesReadThisPass, LocalIntensityBuffer);
 
@@ -497,8 +694,205 @@ uint32_t c_InputFPPRemotePlayFile::ReadFile(uint32_t DestinationIntensityId, uin
         NumBytesRead += NumBytesReadThisPass;
         DestinationIntensityId += NumBytesReadThisPass;
     }
-#endif // !def WRITE_DIRECT_TO_OUTPUT_BUFFER
 
     // DEBUG_END;
     return NumBytesRead;
 } // ReadFile
+
+//-----------------------------------------------------------------------------
+/*
+    Called by the play timer when the prefetcher is not running. Uses the
+    fastest path the current layout allows:
+      - The outputs store channel data unchanged: each range is read from
+        the card straight into the output buffer.
+      - Otherwise the frame is read with a single read into the staging
+        buffer and handed to the outputs in one pass.
+      - Without a staging buffer the ranges are copied in small pieces.
+*/
+bool c_InputFPPRemotePlayFile::ReadFrame (uint32_t FrameId)
+{
+    // xDEBUG_START;
+
+    bool     Response     = true;
+    uint32_t BufferSize   = OutputMgr.GetBufferUsedSize ();
+    uint32_t FrameLength  = GetFrameReadLength ();
+    uint32_t FilePosition = FrameControl.DataOffset + (FrameControl.ChannelsPerFrame * FrameId);
+
+    do // once
+    {
+        if (0 == FrameLength)
+        {
+            // nothing in this file lands in the output buffer
+            break;
+        }
+
+        if (Decoder.IsActive ())
+        {
+            const uint8_t * pFrame = Decoder.GetFrame (FrameId);
+            Response = (nullptr != pFrame);
+            if (Response)
+            {
+                WriteFrame (pFrame, FrameLength);
+            }
+            break;
+        }
+
+        if (OutputMgr.ChannelDataIsUnchanged ())
+        {
+            uint8_t * pOutputBuffer = OutputMgr.GetBufferAddress ();
+            OutputMgr.BeginInputWrite ();
+            for (uint32_t RangeIndex = 0; RangeIndex < NumSparseRanges; ++RangeIndex)
+            {
+                FSEQParsedRangeEntry & CurrentSparseRange = pSparseRanges[RangeIndex];
+                if (CurrentSparseRange.DestinationOffset >= BufferSize)
+                {
+                    continue;
+                }
+
+                uint32_t ChannelCount = min (BufferSize - CurrentSparseRange.DestinationOffset, CurrentSparseRange.ChannelCount);
+                if (ChannelCount != FileMgr.ReadSdFile (FileHandleForFileBeingPlayed,
+                                                        &pOutputBuffer[CurrentSparseRange.DestinationOffset],
+                                                        ChannelCount,
+                                                        FilePosition + CurrentSparseRange.DataOffset))
+                {
+                    Response = false;
+                    break;
+                }
+            }
+            OutputMgr.EndInputWrite ();
+            OutputMgr.SetBufferDirty ();
+            ++FrameReadCounts.Direct;
+            break;
+        }
+
+        if ((nullptr != pStagingFrame) && (FrameLength <= StagingFrameSize))
+        {
+            Response = LoadFrame (FrameId, pStagingFrame, FrameLength);
+            if (Response)
+            {
+                WriteFrame (pStagingFrame, FrameLength);
+            }
+            ++FrameReadCounts.Staged;
+            break;
+        }
+
+        for (uint32_t RangeIndex = 0; RangeIndex < NumSparseRanges; ++RangeIndex)
+        {
+            FSEQParsedRangeEntry & CurrentSparseRange = pSparseRanges[RangeIndex];
+            if (CurrentSparseRange.DestinationOffset >= BufferSize)
+            {
+                continue;
+            }
+
+            uint32_t ChannelCount = min (BufferSize - CurrentSparseRange.DestinationOffset, CurrentSparseRange.ChannelCount);
+            if (ChannelCount != ReadFile (CurrentSparseRange.DestinationOffset, ChannelCount, FilePosition + CurrentSparseRange.DataOffset))
+            {
+                Response = false;
+                break;
+            }
+        }
+        ++FrameReadCounts.Piecewise;
+
+    } while (false);
+
+    // xDEBUG_END;
+    return Response;
+} // ReadFrame
+
+//-----------------------------------------------------------------------------
+void c_InputFPPRemotePlayFile::FreeStagingFrame ()
+{
+    // DEBUG_START;
+
+    if (nullptr != pStagingFrame)
+    {
+        free (pStagingFrame);
+        pStagingFrame = nullptr;
+    }
+    StagingFrameSize = 0;
+
+    // DEBUG_END;
+} // FreeStagingFrame
+
+//-----------------------------------------------------------------------------
+/*
+    Number of bytes at the start of each frame that end up in the output
+    buffer. The sparse ranges are packed in the frame so this is one read.
+*/
+uint32_t c_InputFPPRemotePlayFile::GetFrameReadLength ()
+{
+    // DEBUG_START;
+
+    uint32_t Response   = 0;
+    uint32_t BufferSize = OutputMgr.GetBufferUsedSize ();
+
+    for (uint32_t RangeIndex = 0; RangeIndex < NumSparseRanges; ++RangeIndex)
+    {
+        FSEQParsedRangeEntry & CurrentSparseRange = pSparseRanges[RangeIndex];
+        if (CurrentSparseRange.DestinationOffset >= BufferSize)
+        {
+            continue;
+        }
+
+        uint32_t ChannelCount = min (BufferSize - CurrentSparseRange.DestinationOffset, CurrentSparseRange.ChannelCount);
+        Response = max (Response, CurrentSparseRange.DataOffset + ChannelCount);
+    }
+
+    // DEBUG_END;
+    return Response;
+} // GetFrameReadLength
+
+//-----------------------------------------------------------------------------
+/*
+    Called by the prefetch task. Reads the start of a frame into pBuffer.
+*/
+bool c_InputFPPRemotePlayFile::LoadFrame (uint32_t FrameId, uint8_t * pBuffer, uint32_t Length)
+{
+    // xDEBUG_START;
+
+    bool Response = false;
+
+    if (Decoder.IsActive ())
+    {
+        const uint8_t * pFrame = Decoder.GetFrame (FrameId);
+        if (nullptr != pFrame)
+        {
+            memcpy (pBuffer, pFrame, Length);
+            Response = true;
+        }
+    }
+    else
+    {
+        uint32_t FilePosition = FrameControl.DataOffset + (FrameControl.ChannelsPerFrame * FrameId);
+        Response = (Length == FileMgr.ReadSdFile (FileHandleForFileBeingPlayed, pBuffer, Length, FilePosition));
+    }
+
+    // xDEBUG_END;
+    return Response;
+} // LoadFrame
+
+//-----------------------------------------------------------------------------
+/*
+    Copy a frame loaded by LoadFrame to the output buffer.
+*/
+void c_InputFPPRemotePlayFile::WriteFrame (const uint8_t * pFrame, uint32_t Length)
+{
+    // xDEBUG_START;
+
+    uint32_t BufferSize = OutputMgr.GetBufferUsedSize ();
+
+    for (uint32_t RangeIndex = 0; RangeIndex < NumSparseRanges; ++RangeIndex)
+    {
+        FSEQParsedRangeEntry & CurrentSparseRange = pSparseRanges[RangeIndex];
+        if ((CurrentSparseRange.DestinationOffset >= BufferSize) || (CurrentSparseRange.DataOffset >= Length))
+        {
+            continue;
+        }
+
+        uint32_t ChannelCount = min (BufferSize - CurrentSparseRange.DestinationOffset, CurrentSparseRange.ChannelCount);
+        ChannelCount = min (ChannelCount, Length - CurrentSparseRange.DataOffset);
+        OutputMgr.WriteChannelData (CurrentSparseRange.DestinationOffset, ChannelCount, (byte *)&pFrame[CurrentSparseRange.DataOffset]);
+    }
+
+    // xDEBUG_END;
+} // WriteFrame
@@ -20,14 +20,23 @@
 */
 
 #include "../ESPixelStick.h"
+#include "../FileMgr.hpp"
 #include "InputFPPRemotePlayItem.hpp"
 #include "InputFPPRemotePlayFileFsm.hpp"
+#include "InputFPPRemotePlayFileDecoder.hpp"
+#include "InputFPPRemotePlayFilePrefetch.hpp"
 #include "../service/fseq.h"
 #include <Ticker.h>
 
 #ifdef ARDUINO_ARCH_ESP32
 #include <esp_task.h>
+    // When an output runs in high refresh mode the step time in the file is
+    // honored. The outputs limit themselves to what the wire can carry.
+#   define FSEQ_MIN_FRAME_STEP_TIME_MS 1
+#else
+#   define FSEQ_MIN_FRAME_STEP_TIME_MS 25
 #endif // def ARDUINO_ARCH_ESP32
+#define FSEQ_DEFAULT_MIN_FRAME_STEP_TIME_MS 25
 
 
 class c_InputFPPRemotePlayFile : public c_InputFPPRemotePlayItem
@@ -59,6 +68,7 @@ private:
     friend class fsm_PlayFile_state_Stopping;
     friend class fsm_PlayFile_state_Error;
     friend class fsm_PlayFile_state;
+    friend class c_InputFPPRemotePlayFilePrefetch;
 
     fsm_PlayFile_state_Idle        fsm_PlayFile_state_Idle_imp;
     fsm_PlayFile_state_Starting    fsm_PlayFile_state_Starting_imp;
@@ -90,28 +100,59 @@ private:
 #   define    FPP_TICKER_PERIOD_MS 25
 // #   define    FPP_TICKER_PERIOD_MS 1000
     Ticker    MsTicker;
+    uint32_t  TimerPollPeriodMS = 0;    ///< Follows the frame step time when it is shorter than FPP_TICKER_PERIOD_MS
     uint32_t  LastIsrTimeStampMS = 0;
     uint32_t  PlayedFileCount = 0;
 
     // Logic to detect if polls have stopped coming in.
     // This is part of the blanking logic.
+#   define    FPP_POLL_DETECTION_TIME_MS (5 * FPP_TICKER_PERIOD_MS)
     int       PollDetectionCounter = 0;
-    static const int PollDetectionCounterLimit = 5;
+    int       PollDetectionCounterLimit = FPP_POLL_DETECTION_TIME_MS / FPP_TICKER_PERIOD_MS;
 
-#define MAX_NUM_SPARSE_RANGES 5
-    FSEQParsedRangeEntry SparseRanges[MAX_NUM_SPARSE_RANGES];
+    // Ranges that are next to each other in both the file and the output
+    // buffer are merged so that each entry is a single read.
+    FSEQParsedRangeEntry * pSparseRanges = nullptr;
+    uint32_t               NumSparseRanges = 0;
 
     void        UpdateElapsedPlayTimeMS ();
+    void        SetTimerPollPeriod (uint32_t PeriodMS);
     uint32_t    CalculateFrameId (uint32_t ElapsedMS, int32_t SyncOffsetMS);
     bool        ParseFseqFile ();
+    bool        ParseSparseRanges (FSEQParsedHeader & fsqParsedHeader);
+    void        FreeSparseRanges ();
     uint32_t      ReadFile(uint32_t DestinationIntensityId, uint32_t NumBytesToRead, uint32_t FileOffset);
+    bool        ReadFrame (uint32_t FrameId);
+    void        FreeStagingFrame ();
+    uint32_t    GetFrameReadLength ();
+    bool        LoadFrame (uint32_t FrameId, uint8_t * pBuffer, uint32_t Length);
+    void        WriteFrame (const uint8_t * pFrame, uint32_t Length);
+
+    uint8_t *   pStagingFrame = nullptr;    ///< One frame, read with a single SD read
+    uint32_t    StagingFrameSize = 0;
+
+    struct FrameReadCounts_t
+    {
+        uint32_t    Direct = 0;         ///< Read straight into the output buffer
+        uint32_t    Staged = 0;         ///< Read into the staging frame
+        uint32_t    Piecewise = 0;      ///< Copied through a small local buffer
+    } FrameReadCounts;
+
+    c_InputFPPRemotePlayFileDecoder  Decoder;           ///< Only active while playing a compressed file
+    c_InputFPPRemotePlayFilePrefetch Prefetch {this};   ///< Uses the decoder so it must be destroyed first
 
     String      LastFailedPlayStatusMsg;
 
 #ifdef ARDUINO_ARCH_ESP32
     TaskHandle_t TimerPollTaskHandle = NULL;
-#   define TimerPollHandlerTaskStack 2000
-// #   define TimerPollHandlerTaskStack 6000
+#   if defined (SUPPORT_FSEQ_ZSTD)
+        // the zstd block decoder runs on this task
+#       define TimerPollHandlerTaskStack 6000
+#   elif defined (SUPPORT_FSEQ_ZLIB)
+#       define TimerPollHandlerTaskStack 3000
+#   else
+#       define TimerPollHandlerTaskStack 2000
+#   endif // defined (SUPPORT_FSEQ_ZSTD)
 #endif // def ARDUINO_ARCH_ESP32
 
 }; // c_InputFPPRemotePlayFile
@@ -0,0 +1,862 @@
+/*
+* InputFPPRemotePlayFileDecoder.cpp - Decode the compressed blocks of an FSEQ v2 file
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "InputFPPRemotePlayFileDecoder.hpp"
+
+//-----------------------------------------------------------------------------
+c_InputFPPRemotePlayFileDecoder::c_InputFPPRemotePlayFileDecoder ()
+{
+    // DEBUG_START;
+
+    // DEBUG_END;
+} // c_InputFPPRemotePlayFileDecoder
+
+//-----------------------------------------------------------------------------
+c_InputFPPRemotePlayFileDecoder::~c_InputFPPRemotePlayFileDecoder ()
+{
+    // DEBUG_START;
+
+    End ();
+
+    // DEBUG_END;
+} // ~c_InputFPPRemotePlayFileDecoder
+
+//-----------------------------------------------------------------------------
+bool c_InputFPPRemotePlayFileDecoder::IsSupported (uint8_t CompressionType)
+{
+    bool Response = false;
+
+    switch (CompressionType)
+    {
+#ifdef SUPPORT_FSEQ_ZSTD
+        case FSEQ_COMPRESSION_ZSTD:
+        {
+            Response = true;
+            break;
+        }
+#endif // def SUPPORT_FSEQ_ZSTD
+
+#ifdef SUPPORT_FSEQ_ZLIB
+        case FSEQ_COMPRESSION_ZLIB:
+        {
+            Response = true;
+            break;
+        }
+#endif // def SUPPORT_FSEQ_ZLIB
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return Response;
+
+} // IsSupported
+
+//-----------------------------------------------------------------------------
+/*
+    Called once the file header has been parsed. The caller keeps the file
+    open until End is called.
+*/
+bool c_InputFPPRemotePlayFileDecoder::Begin (ReadHandler_t _ReadHandler, uint32_t _FileSize, FSEQParsedHeader & Header)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    End ();
+    ErrorMsg[0] = '\0';
+
+    do // once
+    {
+        ReadHandler         = _ReadHandler;
+        FileSize            = _FileSize;
+        CompressionType     = Header.compressionType;
+        ChannelsPerFrame    = Header.channelCount;
+        TotalNumberOfFrames = Header.TotalNumberOfFramesInSequence;
+
+        if (!IsSupported (CompressionType))
+        {
+            snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("Compression type %u is not supported by this build"), CompressionType);
+            break;
+        }
+
+        if ((0 == ChannelsPerFrame) || (0 == TotalNumberOfFrames))
+        {
+            snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("Sequence does not contain any frames"));
+            break;
+        }
+
+        if (!ReadBlockTable (Header))
+        {
+            break;
+        }
+
+        WindowSizeInFrames = max (uint32_t (1), uint32_t (FSEQ_DECODE_WINDOW_SIZE / ChannelsPerFrame));
+        pWindow = (uint8_t *)malloc (WindowSizeInFrames * ChannelsPerFrame);
+        pInput  = (uint8_t *)malloc (FSEQ_DECODE_INPUT_SIZE);
+        if ((nullptr == pWindow) || (nullptr == pInput))
+        {
+            snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("Could not allocate %u bytes for the decode window"), unsigned (WindowSizeInFrames * ChannelsPerFrame));
+            break;
+        }
+
+        if (!CodecBegin ())
+        {
+            if ('\0' == ErrorMsg[0])
+            {
+                snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("Could not allocate the decompression state"));
+            }
+            break;
+        }
+
+        BlockStarts    = 0;
+        WindowsDecoded = 0;
+        DecodeErrors   = 0;
+        ReadErrors     = 0;
+        PeakMemoryUsed = GetMemoryUsed ();
+
+        Response = true;
+
+    } while (false);
+
+    if (!Response)
+    {
+        End ();
+    }
+
+    // DEBUG_END;
+
+    return Response;
+
+} // Begin
+
+//-----------------------------------------------------------------------------
+void c_InputFPPRemotePlayFileDecoder::End ()
+{
+    // DEBUG_START;
+
+    CodecEnd ();
+
+    if (nullptr != pWindow)
+    {
+        free (pWindow);
+        pWindow = nullptr;
+    }
+
+    if (nullptr != pInput)
+    {
+        free (pInput);
+        pInput = nullptr;
+    }
+
+    if (nullptr != pBlocks)
+    {
+        free (pBlocks);
+        pBlocks = nullptr;
+    }
+
+    NumBlockTableEntries = 0;
+    NumBlocks       = 0;
+    BlockIsValid    = false;
+    WindowNumFrames = 0;
+
+    // DEBUG_END;
+
+} // End
+
+//-----------------------------------------------------------------------------
+/*
+    The table has one 8 byte entry per block right after the fixed header.
+    Writers reserve more entries than they use and leave the spare ones
+    zeroed. The block data starts at the header data offset and the blocks
+    follow each other in table order.
+*/
+bool c_InputFPPRemotePlayFileDecoder::ReadBlockTable (FSEQParsedHeader & Header)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        if (0 == Header.numCompressedBlocks)
+        {
+            snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("Compressed sequence has no block table"));
+            break;
+        }
+
+        pBlocks = (Block_t *)malloc ((Header.numCompressedBlocks + 1) * sizeof (Block_t));
+        if (nullptr == pBlocks)
+        {
+            snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("Could not allocate the compressed block table"));
+            break;
+        }
+        NumBlockTableEntries = Header.numCompressedBlocks + 1;
+
+        FSEQRawCompressedBlockEntry RawEntries[16];
+        uint32_t TableOffset = sizeof (FSEQRawHeader);
+        uint32_t FileOffset  = Header.dataOffset;
+        uint32_t EntriesLeft = Header.numCompressedBlocks;
+        bool     TableIsValid = true;
+
+        while (TableIsValid && (0 != EntriesLeft))
+        {
+            uint32_t EntriesThisPass = min (EntriesLeft, uint32_t (sizeof (RawEntries) / sizeof (RawEntries[0])));
+            uint32_t BytesToRead = EntriesThisPass * sizeof (RawEntries[0]);
+            if (BytesToRead != ReadHandler ((uint8_t *)&RawEntries[0], BytesToRead, TableOffset))
+            {
+                snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("Could not read the compressed block table"));
+                TableIsValid = false;
+                break;
+            }
+
+            for (uint32_t EntryIndex = 0; EntryIndex < EntriesThisPass; ++EntryIndex)
+            {
+                uint32_t FirstFrameId     = read32 (RawEntries[EntryIndex].FirstFrameId, 0);
+                uint32_t CompressedLength = read32 (RawEntries[EntryIndex].CompressedLength, 0);
+                if (0 == CompressedLength)
+                {
+                    // unused entry
+                    continue;
+                }
+
+                if ((0 == NumBlocks) ? (0 != FirstFrameId) : (FirstFrameId <= pBlocks[NumBlocks - 1].FirstFrameId))
+                {
+                    snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("Compressed block %u has an invalid first frame"), unsigned (NumBlocks));
+                    TableIsValid = false;
+                    break;
+                }
+
+                pBlocks[NumBlocks].FirstFrameId = FirstFrameId;
+                pBlocks[NumBlocks].FileOffset   = FileOffset;
+                FileOffset += CompressedLength;
+                ++NumBlocks;
+            }
+
+            TableOffset += BytesToRead;
+            EntriesLeft -= EntriesThisPass;
+        }
+
+        if (!TableIsValid)
+        {
+            break;
+        }
+
+        if ((0 == NumBlocks) || (pBlocks[NumBlocks - 1].FirstFrameId >= TotalNumberOfFrames))
+        {
+            snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("Compressed block table does not match the number of frames"));
+            break;
+        }
+
+        if (FileOffset > FileSize)
+        {
+            snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("File does not contain all of the compressed blocks. Expected %u, Got: %u"),
+                        unsigned (FileOffset), unsigned (FileSize));
+            break;
+        }
+
+        // marks the end of the last block
+        pBlocks[NumBlocks].FirstFrameId = TotalNumberOfFrames;
+        pBlocks[NumBlocks].FileOffset   = FileOffset;
+
+        Response = true;
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return Response;
+
+} // ReadBlockTable
+
+//-----------------------------------------------------------------------------
+uint32_t c_InputFPPRemotePlayFileDecoder::FindBlock (uint32_t FrameId)
+{
+    // xDEBUG_START;
+
+    uint32_t Low  = 0;
+    uint32_t High = NumBlocks - 1;
+
+    while (Low < High)
+    {
+        uint32_t Middle = (Low + High + 1) / 2;
+        if (pBlocks[Middle].FirstFrameId <= FrameId)
+        {
+            Low = Middle;
+        }
+        else
+        {
+            High = Middle - 1;
+        }
+    }
+
+    // xDEBUG_END;
+
+    return Low;
+
+} // FindBlock
+
+//-----------------------------------------------------------------------------
+const uint8_t * c_InputFPPRemotePlayFileDecoder::GetFrame (uint32_t FrameId)
+{
+    // xDEBUG_START;
+
+    const uint8_t * Response = nullptr;
+
+    do // once
+    {
+        if (!IsActive () || (FrameId >= TotalNumberOfFrames))
+        {
+            break;
+        }
+
+        if ((FrameId >= WindowFirstFrameId) && (FrameId < (WindowFirstFrameId + WindowNumFrames)))
+        {
+            Response = &pWindow[(FrameId - WindowFirstFrameId) * ChannelsPerFrame];
+            break;
+        }
+
+        uint32_t BlockIndex = FindBlock (FrameId);
+        if (!BlockIsValid || (BlockIndex != CurrentBlock) || (FrameId < NextFrameId))
+        {
+            if (!StartBlock (BlockIndex))
+            {
+                break;
+            }
+        }
+
+        // skip forward to the window that holds the frame
+        bool WindowIsValid = true;
+        while (WindowIsValid && (FrameId >= NextFrameId))
+        {
+            WindowIsValid = DecodeWindow ();
+        }
+
+        if (!WindowIsValid)
+        {
+            break;
+        }
+
+        Response = &pWindow[(FrameId - WindowFirstFrameId) * ChannelsPerFrame];
+
+    } while (false);
+
+    // xDEBUG_END;
+
+    return Response;
+
+} // GetFrame
+
+//-----------------------------------------------------------------------------
+bool c_InputFPPRemotePlayFileDecoder::StartBlock (uint32_t BlockIndex)
+{
+    // xDEBUG_START;
+
+    CurrentBlock             = BlockIndex;
+    NextFrameId              = pBlocks[BlockIndex].FirstFrameId;
+    WindowFirstFrameId       = NextFrameId;
+    WindowNumFrames          = 0;
+    CompressedFileOffset     = pBlocks[BlockIndex].FileOffset;
+    CompressedBytesRemaining = pBlocks[BlockIndex + 1].FileOffset - CompressedFileOffset;
+    InputLength              = 0;
+    InputPosition            = 0;
+    ++BlockStarts;
+
+    BlockIsValid = CodecRestart ();
+
+    // xDEBUG_END;
+
+    return BlockIsValid;
+
+} // StartBlock
+
+//-----------------------------------------------------------------------------
+/*
+    Replace the window with the next frames of the current block. The window
+    never spans two blocks.
+*/
+bool c_InputFPPRemotePlayFileDecoder::DecodeWindow ()
+{
+    // xDEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        WindowFirstFrameId = NextFrameId;
+        WindowNumFrames    = 0;
+
+        uint32_t FramesLeftInBlock = pBlocks[CurrentBlock + 1].FirstFrameId - NextFrameId;
+        uint32_t NumFrames = min (WindowSizeInFrames, FramesLeftInBlock);
+        if (0 == NumFrames)
+        {
+            break;
+        }
+
+        if (!CodecDecode (pWindow, NumFrames * ChannelsPerFrame))
+        {
+            break;
+        }
+
+        WindowNumFrames = NumFrames;
+        NextFrameId    += NumFrames;
+        ++WindowsDecoded;
+        Response = true;
+
+        // zstd allocates its buffers once it has seen the first frame header
+        PeakMemoryUsed = max (PeakMemoryUsed, GetMemoryUsed ());
+
+    } while (false);
+
+    if (!Response)
+    {
+        // start over the next time a frame is requested
+        BlockIsValid = false;
+    }
+
+    // xDEBUG_END;
+
+    return Response;
+
+} // DecodeWindow
+
+//-----------------------------------------------------------------------------
+/*
+    Read the next part of the current block. Returns false once the block
+    has been read completely.
+*/
+bool c_InputFPPRemotePlayFileDecoder::FillInput ()
+{
+    // xDEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        InputLength   = 0;
+        InputPosition = 0;
+
+        if (0 == CompressedBytesRemaining)
+        {
+            break;
+        }
+
+        uint32_t BytesToRead = min (CompressedBytesRemaining, uint32_t (FSEQ_DECODE_INPUT_SIZE));
+        uint32_t BytesRead   = ReadHandler (pInput, BytesToRead, CompressedFileOffset);
+        if (BytesRead != BytesToRead)
+        {
+            ++ReadErrors;
+            CompressedBytesRemaining = 0;
+            break;
+        }
+
+        InputLength               = BytesRead;
+        CompressedFileOffset     += BytesRead;
+        CompressedBytesRemaining -= BytesRead;
+        Response = true;
+
+    } while (false);
+
+    // xDEBUG_END;
+
+    return Response;
+
+} // FillInput
+
+//-----------------------------------------------------------------------------
+bool c_InputFPPRemotePlayFileDecoder::CodecBegin ()
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    switch (CompressionType)
+    {
+#ifdef SUPPORT_FSEQ_ZSTD
+        case FSEQ_COMPRESSION_ZSTD:
+        {
+            pZstdStream = ZSTD_createDStream ();
+            if (nullptr == pZstdStream)
+            {
+                break;
+            }
+
+            ZSTD_DCtx_setParameter (pZstdStream, ZSTD_d_windowLogMax, FSEQ_ZSTD_WINDOW_LOG_MAX);
+            Response = true;
+            break;
+        }
+#endif // def SUPPORT_FSEQ_ZSTD
+
+#ifdef SUPPORT_FSEQ_ZLIB
+        case FSEQ_COMPRESSION_ZLIB:
+        {
+            Response = InflateBegin ();
+            break;
+        }
+#endif // def SUPPORT_FSEQ_ZLIB
+
+        default:
+        {
+            break;
+        }
+    }
+
+    // DEBUG_END;
+
+    return Response;
+
+} // CodecBegin
+
+//-----------------------------------------------------------------------------
+void c_InputFPPRemotePlayFileDecoder::CodecEnd ()
+{
+    // DEBUG_START;
+
+#ifdef SUPPORT_FSEQ_ZSTD
+    if (nullptr != pZstdStream)
+    {
+        ZSTD_freeDStream (pZstdStream);
+        pZstdStream = nullptr;
+    }
+#endif // def SUPPORT_FSEQ_ZSTD
+
+#ifdef SUPPORT_FSEQ_ZLIB
+    if (nullptr != pInflator)
+    {
+        free (pInflator);
+        pInflator = nullptr;
+    }
+
+    if (nullptr != pInflateHistory)
+    {
+        free (pInflateHistory);
+        pInflateHistory = nullptr;
+    }
+    InflateHistorySize = 0;
+#endif // def SUPPORT_FSEQ_ZLIB
+
+    // DEBUG_END;
+
+} // CodecEnd
+
+//-----------------------------------------------------------------------------
+bool c_InputFPPRemotePlayFileDecoder::CodecRestart ()
+{
+    // xDEBUG_START;
+
+    bool Response = false;
+
+    switch (CompressionType)
+    {
+#ifdef SUPPORT_FSEQ_ZSTD
+        case FSEQ_COMPRESSION_ZSTD:
+        {
+            Response = !ZSTD_isError (ZSTD_DCtx_reset (pZstdStream, ZSTD_reset_session_only));
+            break;
+        }
+#endif // def SUPPORT_FSEQ_ZSTD
+
+#ifdef SUPPORT_FSEQ_ZLIB
+        case FSEQ_COMPRESSION_ZLIB:
+        {
+            // every block is a complete zlib stream
+            tinfl_init (pInflator);
+            InflateWritePosition = 0;
+            InflateReadPosition  = 0;
+            InflatePendingBytes  = 0;
+            InflateIsDone        = false;
+            Response = true;
+            break;
+        }
+#endif // def SUPPORT_FSEQ_ZLIB
+
+        default:
+        {
+            break;
+        }
+    }
+
+    // xDEBUG_END;
+
+    return Response;
+
+} // CodecRestart
+
+//-----------------------------------------------------------------------------
+/*
+    Decode exactly OutputSize bytes from the current block. The decoder may
+    still hold output after the input has been used up so it is always
+    called until it stops making progress.
+*/
+bool c_InputFPPRemotePlayFileDecoder::CodecDecode (uint8_t * Output, uint32_t OutputSize)
+{
+    // xDEBUG_START;
+
+    uint32_t OutputPosition = 0;
+
+    switch (CompressionType)
+    {
+#ifdef SUPPORT_FSEQ_ZSTD
+        case FSEQ_COMPRESSION_ZSTD:
+        {
+            ZSTD_outBuffer Out = { Output, OutputSize, 0 };
+
+            while (Out.pos < Out.size)
+            {
+                if (InputPosition >= InputLength)
+                {
+                    FillInput ();
+                }
+
+                ZSTD_inBuffer In = { pInput, InputLength, InputPosition };
+                size_t PreviousOutputPosition = Out.pos;
+
+                size_t Result = ZSTD_decompressStream (pZstdStream, &Out, &In);
+                if (ZSTD_isError (Result))
+                {
+                    snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("zstd: %s"), ZSTD_getErrorName (Result));
+                    ++DecodeErrors;
+                    break;
+                }
+
+                bool MadeProgress = (In.pos != InputPosition) || (Out.pos != PreviousOutputPosition);
+                InputPosition = In.pos;
+                if (!MadeProgress)
+                {
+                    // ran out of compressed data
+                    ++DecodeErrors;
+                    break;
+                }
+            }
+
+            OutputPosition = Out.pos;
+            break;
+        }
+#endif // def SUPPORT_FSEQ_ZSTD
+
+#ifdef SUPPORT_FSEQ_ZLIB
+        case FSEQ_COMPRESSION_ZLIB:
+        {
+            OutputPosition = InflateDecode (Output, OutputSize) ? OutputSize : 0;
+            break;
+        }
+#endif // def SUPPORT_FSEQ_ZLIB
+
+        default:
+        {
+            break;
+        }
+    }
+
+    // xDEBUG_END;
+
+    return (OutputPosition == OutputSize);
+
+} // CodecDecode
+
+#ifdef SUPPORT_FSEQ_ZLIB
+//-----------------------------------------------------------------------------
+/*
+    Size the history from the zlib header of the first block. All of the
+    blocks come from the same encoder. A later block with a larger window
+    fails in the inflater instead of reading outside of the history.
+*/
+bool c_InputFPPRemotePlayFileDecoder::InflateBegin ()
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        uint8_t ZlibHeader[2];
+        if (sizeof (ZlibHeader) != ReadHandler (ZlibHeader, sizeof (ZlibHeader), pBlocks[0].FileOffset))
+        {
+            ++ReadErrors;
+            snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("zlib: could not read the stream header"));
+            break;
+        }
+
+        uint32_t CompressionMethod = ZlibHeader[0] & 0x0f;
+        uint32_t WindowBits        = (ZlibHeader[0] >> 4) + 8;
+        if ((8 != CompressionMethod) || (0 != (((uint32_t (ZlibHeader[0]) << 8) | ZlibHeader[1]) % 31)) || (15 < WindowBits))
+        {
+            snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("zlib: not a deflate stream"));
+            break;
+        }
+
+        if (FSEQ_ZLIB_WINDOW_BITS_MAX < WindowBits)
+        {
+            snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("zlib: windowBits %u is larger than the limit of %u"),
+                        unsigned (WindowBits), unsigned (FSEQ_ZLIB_WINDOW_BITS_MAX));
+            break;
+        }
+
+        InflateHistorySize = uint32_t (1) << WindowBits;
+        pInflator          = (tinfl_decompressor *)malloc (sizeof (tinfl_decompressor));
+        pInflateHistory    = (uint8_t *)malloc (InflateHistorySize);
+        Response = (nullptr != pInflator) && (nullptr != pInflateHistory);
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return Response;
+
+} // InflateBegin
+
+//-----------------------------------------------------------------------------
+/*
+    The inflater needs the last window of output to resolve back references
+    so it writes into a circular history buffer. Whatever it produces is
+    then copied into the window.
+*/
+bool c_InputFPPRemotePlayFileDecoder::InflateDecode (uint8_t * Output, uint32_t OutputSize)
+{
+    // xDEBUG_START;
+
+    uint32_t OutputPosition = 0;
+
+    while (OutputPosition < OutputSize)
+    {
+        if (0 != InflatePendingBytes)
+        {
+            uint32_t BytesToCopy = min (InflatePendingBytes, OutputSize - OutputPosition);
+            memcpy (&Output[OutputPosition], &pInflateHistory[InflateReadPosition], BytesToCopy);
+            OutputPosition      += BytesToCopy;
+            InflatePendingBytes -= BytesToCopy;
+            InflateReadPosition  = (InflateReadPosition + BytesToCopy) & (InflateHistorySize - 1);
+            continue;
+        }
+
+        if (InflateIsDone)
+        {
+            // the block holds fewer frames than the table says
+            ++DecodeErrors;
+            break;
+        }
+
+        if (InputPosition >= InputLength)
+        {
+            FillInput ();
+        }
+
+        size_t InputBytes  = InputLength - InputPosition;
+        size_t OutputBytes = InflateHistorySize - InflateWritePosition;
+        mz_uint32 Flags    = TINFL_FLAG_PARSE_ZLIB_HEADER;
+        if (0 != CompressedBytesRemaining)
+        {
+            Flags |= TINFL_FLAG_HAS_MORE_INPUT;
+        }
+
+        tinfl_status Status = tinfl_decompress (pInflator,
+                                                &pInput[InputPosition], &InputBytes,
+                                                pInflateHistory, &pInflateHistory[InflateWritePosition], &OutputBytes,
+                                                Flags);
+        InputPosition       += InputBytes;
+        InflateReadPosition  = InflateWritePosition;
+        InflatePendingBytes  = OutputBytes;
+        InflateWritePosition = (InflateWritePosition + OutputBytes) & (InflateHistorySize - 1);
+
+        if (Status < TINFL_STATUS_DONE)
+        {
+            snprintf_P (ErrorMsg, sizeof (ErrorMsg), PSTR ("zlib: inflate failed with status %d"), int (Status));
+            ++DecodeErrors;
+            break;
+        }
+
+        InflateIsDone = (TINFL_STATUS_DONE == Status);
+
+        if ((0 == InputBytes) && (0 == OutputBytes) && !InflateIsDone)
+        {
+            // ran out of compressed data
+            ++DecodeErrors;
+            break;
+        }
+    }
+
+    // xDEBUG_END;
+
+    return (OutputPosition == OutputSize);
+
+} // InflateDecode
+#endif // def SUPPORT_FSEQ_ZLIB
+
+//-----------------------------------------------------------------------------
+uint32_t c_InputFPPRemotePlayFileDecoder::GetMemoryUsed ()
+{
+    // xDEBUG_START;
+
+    uint32_t Response = NumBlockTableEntries * sizeof (Block_t);
+
+    if (nullptr != pWindow)
+    {
+        Response += WindowSizeInFrames * ChannelsPerFrame;
+    }
+
+    if (nullptr != pInput)
+    {
+        Response += FSEQ_DECODE_INPUT_SIZE;
+    }
+
+#ifdef SUPPORT_FSEQ_ZSTD
+    if (nullptr != pZstdStream)
+    {
+        Response += ZSTD_sizeof_DStream (pZstdStream);
+    }
+#endif // def SUPPORT_FSEQ_ZSTD
+
+#ifdef SUPPORT_FSEQ_ZLIB
+    if (nullptr != pInflator)
+    {
+        Response += sizeof (tinfl_decompressor) + InflateHistorySize;
+    }
+#endif // def SUPPORT_FSEQ_ZLIB
+
+    // xDEBUG_END;
+
+    return Response;
+
+} // GetMemoryUsed
+
+#ifdef ARDUINO
+//-----------------------------------------------------------------------------
+void c_InputFPPRemotePlayFileDecoder::GetStatus (JsonObject & jsonStatus)
+{
+    // xDEBUG_START;
+
+    jsonStatus[F ("compression")]  = CompressionType;
+    jsonStatus[F ("blocks")]       = NumBlocks;
+    jsonStatus[F ("windowframes")] = WindowSizeInFrames;
+    jsonStatus[F ("blockstarts")]  = BlockStarts;
+    jsonStatus[F ("windows")]      = WindowsDecoded;
+    jsonStatus[F ("decodeerrors")] = DecodeErrors;
+    jsonStatus[F ("readerrors")]   = ReadErrors;
+    jsonStatus[F ("peakram")]      = PeakMemoryUsed;
+    if (0 != DecodeErrors)
+    {
+        jsonStatus[F ("lasterror")] = ErrorMsg;
+    }
+
+    // xDEBUG_END;
+
+} // GetStatus
+#endif // def ARDUINO
@@ -0,0 +1,199 @@
+#pragma once
+/*
+* InputFPPRemotePlayFileDecoder.hpp - Decode the compressed blocks of an FSEQ v2 file
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   A compressed FSEQ v2 file stores its frames in blocks. Each block is an
+*   independent compressed stream. The table that follows the file header
+*   gives the first frame and the compressed size of every block.
+*
+*   A block is decoded a window of frames at a time so the RAM used does not
+*   depend on how large the blocks are. Frames are normally requested in
+*   order and decoding simply continues where it left off. A request for an
+*   earlier frame, or for a frame in another block, restarts decoding at the
+*   start of the block that holds it.
+*
+*   zstd support needs the zstd library and is enabled with SUPPORT_FSEQ_ZSTD.
+*   zstd sizes its history window from the compression level unless the
+*   encoder knows how much data a block holds. Without that, levels 1 and
+*   below ask for 512KB, level 2 for 1MB and level 3 and up for 2MB or more.
+*   A block is only decoded if it asks for at most 2^FSEQ_ZSTD_WINDOW_LOG_MAX
+*   bytes: 1MB with PSRAM, 128KB without. Larger blocks fail with a decode
+*   error. With PSRAM, write the file with a level of 2 or less. Otherwise
+*   limit the window of the encoder (zstd --zstd=wlog=17, ZSTD_c_windowLog).
+*   On top of the window the stream keeps two 128KB blocks of output, one
+*   block of input and about 100KB of tables: a 128KB window needs about
+*   630KB in total, which is why only the PSRAM builds enable zstd.
+*
+*   zlib blocks are inflated with miniz. The ESP32 ROM already contains it.
+*   Other platforms need the miniz library and SUPPORT_FSEQ_ZLIB. The history
+*   buffer is sized from the window in the zlib header (CINFO) of the first
+*   block. FPP and zlib default to windowBits 15, a 32KB window. With the
+*   11KB inflate state, the decode window and the input buffer such a file
+*   needs about 52KB, which an ESP8266 does not have in one piece. The
+*   ESP8266 only accepts windows of up to 2^FSEQ_ZLIB_WINDOW_BITS_MAX bytes:
+*   write the file with windowBits 13 or less (zlib deflateInit2,
+*   zlib.compressobj (level, zlib.DEFLATED, 13)) for about 28KB in total.
+*   Larger windows fail in Begin with a message that names the limit.
+*
+*   The decoder only reads the file through a handler so that it can be
+*   built and checked on a host as well as on the target.
+*
+*/
+
+#ifdef ARDUINO
+#   include "../ESPixelStick.h"
+#else
+#   include <stdint.h>
+#   include <stdio.h>
+#   include <stdlib.h>
+#   include <string.h>
+#   include <algorithm>
+#   include <string>
+    using std::min;
+    using std::max;
+    // fseq.h is shared with the target and uses the Arduino String
+    typedef std::string String;
+#   define PSTR(s)      (s)
+#   define snprintf_P   snprintf
+#endif // def ARDUINO
+
+#include <functional>
+#include "../service/fseq.h"
+
+#ifdef SUPPORT_FSEQ_ZSTD
+#   include <zstd.h>
+#endif // def SUPPORT_FSEQ_ZSTD
+
+#if defined (ARDUINO_ARCH_ESP32) && !defined (SUPPORT_FSEQ_ZLIB)
+#   define SUPPORT_FSEQ_ZLIB
+#endif // defined (ARDUINO_ARCH_ESP32) && !defined (SUPPORT_FSEQ_ZLIB)
+
+#ifdef SUPPORT_FSEQ_ZLIB
+#   ifdef ARDUINO_ARCH_ESP32
+#       include <esp32/rom/miniz.h>
+#   else
+#       include <miniz.h>
+#   endif // def ARDUINO_ARCH_ESP32
+#endif // def SUPPORT_FSEQ_ZLIB
+
+class c_InputFPPRemotePlayFileDecoder
+{
+public:
+    c_InputFPPRemotePlayFileDecoder ();
+    virtual ~c_InputFPPRemotePlayFileDecoder ();
+
+    /// Reads NumBytes at FileOffset into Buffer. Returns the number of bytes read.
+    typedef std::function<uint32_t (uint8_t * Buffer, uint32_t NumBytes, uint32_t FileOffset)> ReadHandler_t;
+
+    bool            Begin       (ReadHandler_t ReadHandler, uint32_t FileSize, FSEQParsedHeader & Header);
+    void            End         ();
+    bool            IsActive    () { return (nullptr != pWindow); }
+    const uint8_t * GetFrame    (uint32_t FrameId); ///< Returns nullptr if the frame could not be decoded
+    const char *    GetErrorMsg () { return ErrorMsg; }   ///< Why Begin or the last decode failed
+    uint32_t        GetMemoryUsed ();
+    uint32_t        GetPeakMemoryUsed () { return PeakMemoryUsed; }
+#ifdef ARDUINO
+    void            GetStatus   (JsonObject & jsonStatus);
+#endif // def ARDUINO
+
+    static bool     IsSupported (uint8_t CompressionType);
+
+private:
+#define FSEQ_DECODE_WINDOW_SIZE     (8 * 1024)  ///< Decoded bytes held at once. Never less than one frame.
+#define FSEQ_DECODE_INPUT_SIZE      1024        ///< Compressed bytes read from the SD card at a time
+#define FSEQ_DECODE_ERROR_MSG_SIZE  96
+#ifndef FSEQ_ZSTD_WINDOW_LOG_MAX
+#   ifdef BOARD_HAS_PSRAM
+#       define FSEQ_ZSTD_WINDOW_LOG_MAX 20          ///< Refuse zstd streams that need more than 1MB of history
+#   else
+#       define FSEQ_ZSTD_WINDOW_LOG_MAX 17          ///< Refuse zstd streams that need more than 128KB of history
+#   endif // def BOARD_HAS_PSRAM
+#endif // ndef FSEQ_ZSTD_WINDOW_LOG_MAX
+#ifndef FSEQ_ZLIB_WINDOW_BITS_MAX
+#   ifdef ARDUINO_ARCH_ESP8266
+#       define FSEQ_ZLIB_WINDOW_BITS_MAX 13         ///< Refuse zlib streams that need more than 8KB of history
+#   else
+#       define FSEQ_ZLIB_WINDOW_BITS_MAX 15         ///< The largest zlib window
+#   endif // def ARDUINO_ARCH_ESP8266
+#endif // ndef FSEQ_ZLIB_WINDOW_BITS_MAX
+
+    struct Block_t
+    {
+        uint32_t FirstFrameId;
+        uint32_t FileOffset;
+    };
+
+    bool     ReadBlockTable (FSEQParsedHeader & Header);
+    uint32_t FindBlock      (uint32_t FrameId);
+    bool     StartBlock     (uint32_t BlockIndex);
+    bool     DecodeWindow   ();
+    bool     FillInput      ();
+
+    bool     CodecBegin     ();
+    void     CodecEnd       ();
+    bool     CodecRestart   ();
+    bool     CodecDecode    (uint8_t * Output, uint32_t OutputSize);
+
+    ReadHandler_t ReadHandler;
+    uint32_t    FileSize                = 0;
+    char        ErrorMsg[FSEQ_DECODE_ERROR_MSG_SIZE] = {0};
+    uint8_t     CompressionType         = FSEQ_COMPRESSION_NONE;
+    uint32_t    ChannelsPerFrame        = 0;
+    uint32_t    TotalNumberOfFrames     = 0;
+
+    Block_t *   pBlocks                 = nullptr;  ///< NumBlocks entries plus one that marks the end of the data
+    uint32_t    NumBlockTableEntries    = 0;        ///< Allocated entries in pBlocks
+    uint32_t    NumBlocks               = 0;
+    uint32_t    CurrentBlock            = 0;
+    bool        BlockIsValid            = false;
+
+    uint8_t *   pWindow                 = nullptr;
+    uint32_t    WindowSizeInFrames      = 0;
+    uint32_t    WindowFirstFrameId      = 0;
+    uint32_t    WindowNumFrames         = 0;
+    uint32_t    NextFrameId             = 0;    ///< Next frame the stream will produce
+
+    uint8_t *   pInput                  = nullptr;
+    uint32_t    InputLength             = 0;
+    uint32_t    InputPosition           = 0;
+    uint32_t    CompressedFileOffset    = 0;    ///< Next compressed byte to read from the file
+    uint32_t    CompressedBytesRemaining = 0;   ///< In the current block
+
+#ifdef SUPPORT_FSEQ_ZSTD
+    ZSTD_DStream * pZstdStream          = nullptr;
+#endif // def SUPPORT_FSEQ_ZSTD
+
+#ifdef SUPPORT_FSEQ_ZLIB
+    bool     InflateBegin               ();
+    bool     InflateDecode              (uint8_t * Output, uint32_t OutputSize);
+
+    tinfl_decompressor * pInflator      = nullptr;
+    uint8_t *   pInflateHistory         = nullptr;  ///< Circular buffer the inflater writes into
+    uint32_t    InflateHistorySize      = 0;        ///< The window of the stream. Always a power of two
+    uint32_t    InflateWritePosition    = 0;
+    uint32_t    InflateReadPosition     = 0;
+    uint32_t    InflatePendingBytes     = 0;        ///< Inflated but not yet copied to the window
+    bool        InflateIsDone           = false;
+#endif // def SUPPORT_FSEQ_ZLIB
+
+    uint32_t    BlockStarts             = 0;
+    uint32_t    WindowsDecoded          = 0;
+    uint32_t    DecodeErrors            = 0;
+    uint32_t    ReadErrors              = 0;
+    uint32_t    PeakMemoryUsed          = 0;
+
+}; // c_InputFPPRemotePlayFileDecoder
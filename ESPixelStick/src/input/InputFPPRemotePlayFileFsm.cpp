@@ -239,53 +239,43 @@ IRAM_ATTR void fsm_PlayFile_state_PlayingFile::TimerPoll ()
             break;
         }
 
-        uint32_t FilePosition = p_Parent->FrameControl.DataOffset + (p_Parent->FrameControl.ChannelsPerFrame * CurrentFrame);
-        uint32_t BufferSize = OutputMgr.GetBufferUsedSize();
-        uint32_t MaxBytesToRead = (p_Parent->FrameControl.ChannelsPerFrame > BufferSize) ? BufferSize : p_Parent->FrameControl.ChannelsPerFrame;
-
-        uint32_t CurrentDestination = 0;
-        // xDEBUG_V (String ("               MaxBytesToRead: ") + String (MaxBytesToRead));
-
-        LastPlayedFrameId = CurrentFrame;
-
-        for (auto& CurrentSparseRange : p_Parent->SparseRanges)
+        if (p_Parent->Prefetch.IsActive ())
         {
-            uint32_t ActualBytesToRead = min (MaxBytesToRead, CurrentSparseRange.ChannelCount);
-            if (0 == ActualBytesToRead)
+            const uint8_t * pFrame = p_Parent->Prefetch.GetFrame (CurrentFrame);
+            if (nullptr == pFrame)
             {
-                // no data to read for this range
-                continue;
+                if (p_Parent->Prefetch.HasFailed ())
+                {
+                    // logcon (F ("File Playback Failed to read enough data"));
+                    Stop ();
+                }
+                // otherwise try again on the next tick
+                break;
             }
 
-            uint32_t AdjustedFilePosition = FilePosition + CurrentSparseRange.DataOffset;
+            LastPlayedFrameId = CurrentFrame;
+            p_Parent->WriteFrame (pFrame, p_Parent->Prefetch.GetFrameSize ());
+            p_Parent->Prefetch.FrameDone ();
+            break;
+        }
 
-            /// DEBUG_V (String ("                 FilePosition: ") + String (FilePosition));
-            /// DEBUG_V (String ("         AdjustedFilePosition: ") + String (uint32_t(AdjustedFilePosition), HEX));
-            /// DEBUG_V (String ("           CurrentDestination: ") + String (uint32_t(CurrentDestination), HEX));
-            /// DEBUG_V (String ("            ActualBytesToRead: ") + String (ActualBytesToRead));
-            uint32_t ActualBytesRead = p_Parent->ReadFile(CurrentDestination, ActualBytesToRead, AdjustedFilePosition);
+        LastPlayedFrameId = CurrentFrame;
 
-            MaxBytesToRead -= ActualBytesRead;
-            CurrentDestination += ActualBytesRead;
+        if (!p_Parent->ReadFrame (CurrentFrame))
+        {
+            // xDEBUG_V (String ("TotalNumberOfFramesInSequence: ") + String (p_Parent->TotalNumberOfFramesInSequence));
+            // xDEBUG_V (String ("                 CurrentFrame: ") + String (CurrentFrame));
 
-            if (ActualBytesRead != ActualBytesToRead)
+            if (0 != p_Parent->FileHandleForFileBeingPlayed)
             {
-                // xDEBUG_V (String ("TotalNumberOfFramesInSequence: ") + String (p_Parent->TotalNumberOfFramesInSequence));
-                // xDEBUG_V (String ("                 CurrentFrame: ") + String (CurrentFrame));
-
-                if (0 != p_Parent->FileHandleForFileBeingPlayed)
-                {
-                    // logcon (F ("File Playback Failed to read enough data"));
-                    Stop ();
-                }
+                // logcon (F ("File Playback Failed to read enough data"));
+                Stop ();
             }
         }
 
         // xDEBUG_V (String ("       DataOffset: ") + String (p_Parent->DataOffset));
         // xDEBUG_V (String ("       BufferSize: ") + String (p_Parent->BufferSize));
         // xDEBUG_V (String (" ChannelsPerFrame: ") + String (p_Parent->ChannelsPerFrame));
-        // xDEBUG_V (String ("     FilePosition: ") + String (FilePosition));
-        // xDEBUG_V (String ("   MaxBytesToRead: ") + String (MaxBytesToRead));
         // xDEBUG_V (String ("GetInputChannelId: ") + String (p_Parent->GetInputChannelId ()));
 
     } while (false);
@@ -445,6 +435,9 @@ void fsm_PlayFile_state_Stopping::Poll ()
 
     // DEBUG_V (String ("FileHandleForFileBeingPlayed: ") + String (p_Parent->FileHandleForFileBeingPlayed));
 
+    p_Parent->Prefetch.End ();
+    p_Parent->Decoder.End ();
+    p_Parent->FreeStagingFrame ();
     FileMgr.CloseSdFile (p_Parent->FileHandleForFileBeingPlayed);
     p_Parent->FileHandleForFileBeingPlayed = 0;
     p_Parent->fsm_PlayFile_state_Idle_imp.Init (p_Parent);
@@ -100,11 +100,6 @@ public:
     virtual IRAM_ATTR void TimerPoll ();
 
 private:
-    struct SparseRange
-    {
-        uint32_t DataOffset;
-        uint32_t ChannelCount;
-    };
     uint32_t LastPlayedFrameId = 0;
 
 }; // fsm_PlayFile_state_PlayingFile
@@ -0,0 +1,381 @@
+/*
+* InputFPPRemotePlayFilePrefetch.cpp - Read FSEQ frames ahead of the play timer
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "InputFPPRemotePlayFilePrefetch.hpp"
+#include "InputFPPRemotePlayFile.hpp"
+
+#ifdef ARDUINO_ARCH_ESP32
+//-----------------------------------------------------------------------------
+static void PrefetchTask (void * pvParameters)
+{
+    // DEBUG_START;
+
+    c_InputFPPRemotePlayFilePrefetch * Prefetch = reinterpret_cast <c_InputFPPRemotePlayFilePrefetch*> (pvParameters);
+
+    for (;;)
+    {
+        ulTaskNotifyTake (pdTRUE, pdMS_TO_TICKS (FSEQ_PREFETCH_POLL_MS));
+        Prefetch->Fill ();
+    }
+
+    // DEBUG_END;
+
+} // PrefetchTask
+#endif // def ARDUINO_ARCH_ESP32
+
+//-----------------------------------------------------------------------------
+c_InputFPPRemotePlayFilePrefetch::c_InputFPPRemotePlayFilePrefetch (c_InputFPPRemotePlayFile * Parent) :
+    pParent (Parent)
+{
+    // DEBUG_START;
+
+    // DEBUG_END;
+} // c_InputFPPRemotePlayFilePrefetch
+
+//-----------------------------------------------------------------------------
+c_InputFPPRemotePlayFilePrefetch::~c_InputFPPRemotePlayFilePrefetch ()
+{
+    // DEBUG_START;
+
+    End ();
+
+#ifdef ARDUINO_ARCH_ESP32
+    if (NULL != TaskHandle)
+    {
+        vTaskDelete (TaskHandle);
+        TaskHandle = NULL;
+    }
+#endif // def ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+} // ~c_InputFPPRemotePlayFilePrefetch
+
+//-----------------------------------------------------------------------------
+/*
+    Called once the file has been parsed. Returns false if the frames will
+    have to be read when they are due.
+*/
+bool c_InputFPPRemotePlayFilePrefetch::Begin (uint32_t _FrameSize, uint32_t TotalNumberOfFrames)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    End ();
+
+    do // once
+    {
+#ifdef ARDUINO_ARCH_ESP32
+        if (0 == _FrameSize)
+        {
+            break;
+        }
+
+        if (NULL == TaskHandle)
+        {
+            xTaskCreate (PrefetchTask, "FPPPrefetch", PrefetchTaskStack, this, ESP_TASK_PRIO_MIN + 3, &TaskHandle);
+            if (NULL == TaskHandle)
+            {
+                logcon (F ("Could not start the FSEQ prefetch task. Frames will be read when they are due"));
+                break;
+            }
+        }
+
+        Depth = FSEQ_PREFETCH_MAX_DEPTH;
+        while ((Depth > FSEQ_PREFETCH_MIN_DEPTH) && ((Depth * _FrameSize) > FSEQ_PREFETCH_BUFFER_SIZE))
+        {
+            Depth /= 2;
+        }
+
+        if ((Depth * _FrameSize) > FSEQ_PREFETCH_BUFFER_SIZE)
+        {
+            logcon (String (F ("FSEQ frames of ")) + String (_FrameSize) + F (" bytes are too large to prefetch. Frames will be read when they are due"));
+            Depth = 0;
+            break;
+        }
+
+#   ifdef BOARD_HAS_PSRAM
+        pFrames = (uint8_t *)ps_malloc (Depth * _FrameSize);
+#   else
+        pFrames = (uint8_t *)malloc (Depth * _FrameSize);
+#   endif // def BOARD_HAS_PSRAM
+        if (nullptr == pFrames)
+        {
+            logcon (String (F ("Could not allocate ")) + String (Depth * _FrameSize) + F (" bytes for the FSEQ prefetch buffer. Frames will be read when they are due"));
+            Depth = 0;
+            break;
+        }
+
+        FrameSize          = _FrameSize;
+        NumFrames          = TotalNumberOfFrames;
+        WantedFrameId      = 0;
+        NextFrameToRead    = 0;
+        ++Generation;
+        ReadFailed         = false;
+        Head.store (0);
+        Tail.store (0);
+
+        FramesRead     = 0;
+        FramesSkipped  = 0;
+        Underruns      = 0;
+        Restarts       = 0;
+        ReadErrors     = 0;
+        MaxReadTimeUS  = 0;
+        LastReadTimeUS = 0;
+
+        Active = true;
+        xTaskNotifyGive (TaskHandle);
+
+        Response = true;
+#endif // def ARDUINO_ARCH_ESP32
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return Response;
+
+} // Begin
+
+//-----------------------------------------------------------------------------
+/*
+    Stop reading ahead. Waits for a read in progress to finish so that the
+    caller can close the file, and for the consumer to be done with the
+    frame it holds. Neither side looks at the buffers once it has seen
+    Active go false, so they can then be freed. Must not be called from the
+    prefetch task or from the consumer between GetFrame and FrameDone.
+*/
+void c_InputFPPRemotePlayFilePrefetch::End ()
+{
+    // DEBUG_START;
+
+    Active = false;
+
+#ifdef ARDUINO_ARCH_ESP32
+    while (Busy || ConsumerBusy)
+    {
+        vTaskDelay (pdMS_TO_TICKS (1));
+    }
+#endif // def ARDUINO_ARCH_ESP32
+
+    if (nullptr != pFrames)
+    {
+        free (pFrames);
+        pFrames = nullptr;
+    }
+    Depth = 0;
+
+    // DEBUG_END;
+
+} // End
+
+//-----------------------------------------------------------------------------
+/*
+    Called by the consumer when a frame is due. A frame that is returned
+    stays valid until FrameDone is called.
+*/
+const uint8_t * c_InputFPPRemotePlayFilePrefetch::GetFrame (uint32_t FrameId)
+{
+    // xDEBUG_START;
+
+    const uint8_t * Response = nullptr;
+
+    // must be set before Active is checked. See End
+    ConsumerBusy = true;
+
+    do // once
+    {
+        if (!Active)
+        {
+            break;
+        }
+
+        WantedFrameId = FrameId;
+
+        // sample the producer before the ring so that a frame it has
+        // already passed is guaranteed to be visible in the ring
+        bool     ProducerIsCurrent = (ProducerGeneration == Generation);
+        uint32_t ProducerNextFrame = NextFrameToRead;
+
+        uint32_t CurrentTail = Tail.load (std::memory_order_relaxed);
+        uint32_t CurrentHead = Head.load (std::memory_order_acquire);
+
+        // drop the frames we are too late for
+        while (CurrentTail != CurrentHead)
+        {
+            Slot_t & Slot = Slots[CurrentTail & (Depth - 1)];
+            if ((Slot.Generation == Generation) && (Slot.FrameId >= FrameId))
+            {
+                break;
+            }
+            ++CurrentTail;
+            ++FramesSkipped;
+        }
+        Tail.store (CurrentTail, std::memory_order_release);
+
+        if (CurrentTail != CurrentHead)
+        {
+            Slot_t & Slot = Slots[CurrentTail & (Depth - 1)];
+            if (Slot.FrameId == FrameId)
+            {
+                Response = &pFrames[(CurrentTail & (Depth - 1)) * FrameSize];
+                break;
+            }
+        }
+
+        ++Underruns;
+
+        if (ProducerIsCurrent && ((CurrentTail != CurrentHead) || (ProducerNextFrame > FrameId)))
+        {
+            // playback went backwards. Read from the new position
+            ++Generation;
+            ++Restarts;
+        }
+
+#ifdef ARDUINO_ARCH_ESP32
+        xTaskNotifyGive (TaskHandle);
+#endif // def ARDUINO_ARCH_ESP32
+
+    } while (false);
+
+    if (nullptr == Response)
+    {
+        ConsumerBusy = false;
+    }
+
+    // xDEBUG_END;
+
+    return Response;
+
+} // GetFrame
+
+//-----------------------------------------------------------------------------
+void c_InputFPPRemotePlayFilePrefetch::FrameDone ()
+{
+    // xDEBUG_START;
+
+    Tail.fetch_add (1, std::memory_order_release);
+
+#ifdef ARDUINO_ARCH_ESP32
+    xTaskNotifyGive (TaskHandle);
+#endif // def ARDUINO_ARCH_ESP32
+
+    ConsumerBusy = false;
+
+    // xDEBUG_END;
+
+} // FrameDone
+
+//-----------------------------------------------------------------------------
+/*
+    Called by the producer. Reads frames until the ring is full.
+*/
+void c_InputFPPRemotePlayFilePrefetch::Fill ()
+{
+    // xDEBUG_START;
+
+    Busy = true;
+
+    do // once
+    {
+        if (!Active || ReadFailed)
+        {
+            break;
+        }
+
+        uint32_t CurrentGeneration = Generation;
+        if (CurrentGeneration != ProducerGeneration)
+        {
+            // the consumer trusts NextFrameToRead once the generation matches
+            NextFrameToRead    = WantedFrameId;
+            ProducerGeneration = CurrentGeneration;
+        }
+
+        while (Active && (CurrentGeneration == Generation))
+        {
+            // never read frames that are already late
+            if (NextFrameToRead < WantedFrameId)
+            {
+                NextFrameToRead = WantedFrameId;
+            }
+
+            if (NextFrameToRead >= NumFrames)
+            {
+                break;
+            }
+
+            uint32_t CurrentHead = Head.load (std::memory_order_relaxed);
+            if ((CurrentHead - Tail.load (std::memory_order_acquire)) >= Depth)
+            {
+                // ring is full
+                break;
+            }
+
+            uint32_t SlotIndex = CurrentHead & (Depth - 1);
+            uint32_t StartTimeUS = micros ();
+            if (!pParent->LoadFrame (NextFrameToRead, &pFrames[SlotIndex * FrameSize], FrameSize))
+            {
+                ++ReadErrors;
+                ReadFailed = true;
+                break;
+            }
+            uint32_t ReadTimeUS = micros () - StartTimeUS;
+            LastReadTimeUS = ReadTimeUS;
+            uint32_t PreviousMaxReadTimeUS = MaxReadTimeUS;
+            while ((ReadTimeUS > PreviousMaxReadTimeUS) &&
+                   !MaxReadTimeUS.compare_exchange_weak (PreviousMaxReadTimeUS, ReadTimeUS))
+            {
+                // a reset or another update got in first. Check again.
+            }
+            ++FramesRead;
+
+            Slots[SlotIndex].FrameId    = NextFrameToRead;
+            Slots[SlotIndex].Generation = CurrentGeneration;
+
+            // publish the frame
+            Head.fetch_add (1, std::memory_order_release);
+            NextFrameToRead = NextFrameToRead + 1;
+        }
+
+    } while (false);
+
+    Busy = false;
+
+    // xDEBUG_END;
+
+} // Fill
+
+//-----------------------------------------------------------------------------
+void c_InputFPPRemotePlayFilePrefetch::GetStatus (JsonObject & jsonStatus)
+{
+    // xDEBUG_START;
+
+    jsonStatus[F ("depth")]      = Depth;
+    jsonStatus[F ("queued")]     = Head.load () - Tail.load ();
+    jsonStatus[F ("read")]       = FramesRead.load ();
+    jsonStatus[F ("skipped")]    = FramesSkipped.load ();
+    jsonStatus[F ("underruns")]  = Underruns.load ();
+    jsonStatus[F ("restarts")]   = Restarts.load ();
+    jsonStatus[F ("readerrors")] = ReadErrors.load ();
+    jsonStatus[F ("lastreadus")] = LastReadTimeUS.load ();
+    jsonStatus[F ("maxreadus")]  = MaxReadTimeUS.load ();
+
+    // xDEBUG_END;
+
+} // GetStatus
@@ -0,0 +1,112 @@
+#pragma once
+/*
+* InputFPPRemotePlayFilePrefetch.hpp - Read FSEQ frames ahead of the play timer
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   A low priority task reads the next frames of the file into a ring of
+*   preallocated frame buffers. When a frame is due the play timer only
+*   copies it from the ring, so an SD card that stalls for a few tens of
+*   milliseconds no longer costs a frame.
+*
+*   There is one producer (the prefetch task) and one consumer (the play
+*   timer task) so the ring needs no locks. The consumer asks for a frame by
+*   number. Older frames are skipped. When playback jumps backwards the
+*   consumer starts a new generation and the producer restarts from the
+*   frame that was asked for.
+*
+*   Each side flags when it is using the frame buffers. End() clears Active
+*   and then waits for both flags to drop before it frees the buffers, so
+*   neither side can still be reading or writing a frame at that point.
+*
+*   The ESP8266 has no tasks to run this on and reads each frame when it is due.
+*
+*/
+
+#include "../ESPixelStick.h"
+#include <atomic>
+
+class c_InputFPPRemotePlayFile;
+
+class c_InputFPPRemotePlayFilePrefetch
+{
+public:
+    c_InputFPPRemotePlayFilePrefetch (c_InputFPPRemotePlayFile * Parent);
+    virtual ~c_InputFPPRemotePlayFilePrefetch ();
+
+    bool            Begin       (uint32_t FrameSize, uint32_t TotalNumberOfFrames);
+    void            End         ();
+    bool            IsActive    () { return Active; }
+    bool            HasFailed   () { return ReadFailed; }
+    uint32_t        GetFrameSize () { return FrameSize; }
+    const uint8_t * GetFrame    (uint32_t FrameId); ///< nullptr if the frame has not been read yet
+    void            FrameDone   ();                 ///< Release the frame returned by GetFrame
+    void            Fill        ();                 ///< Runs on the prefetch task
+    void            GetStatus   (JsonObject & jsonStatus);
+
+private:
+#define FSEQ_PREFETCH_MAX_DEPTH     8       ///< Frames read ahead. Must be a power of two.
+#define FSEQ_PREFETCH_MIN_DEPTH     2
+#define FSEQ_PREFETCH_POLL_MS       10      ///< Longest the task sleeps between fills
+#ifdef BOARD_HAS_PSRAM
+#   define FSEQ_PREFETCH_BUFFER_SIZE    (256 * 1024)
+#else
+#   define FSEQ_PREFETCH_BUFFER_SIZE    (16 * 1024)
+#endif // def BOARD_HAS_PSRAM
+
+    struct Slot_t
+    {
+        uint32_t    FrameId;
+        uint32_t    Generation;
+    };
+
+    c_InputFPPRemotePlayFile * pParent = nullptr;
+
+    Slot_t                  Slots[FSEQ_PREFETCH_MAX_DEPTH];
+    uint8_t *               pFrames         = nullptr;  ///< Depth frame buffers
+    uint32_t                Depth           = 0;
+    uint32_t                FrameSize       = 0;
+    uint32_t                NumFrames       = 0;
+    std::atomic<uint32_t>   Head {0};           ///< Next slot to fill. Only written by the producer
+    std::atomic<uint32_t>   Tail {0};           ///< Next slot to play. Only written by the consumer
+    std::atomic<bool>       Active {false};
+    std::atomic<bool>       Busy {false};       ///< The producer is using the file
+    std::atomic<bool>       ConsumerBusy {false}; ///< The consumer holds a frame between GetFrame and FrameDone
+    volatile uint32_t       Generation          = 0;    ///< Changed by the consumer to restart the producer
+    volatile uint32_t       WantedFrameId       = 0;    ///< Frame the consumer asked for last
+    volatile uint32_t       NextFrameToRead     = 0;
+    volatile uint32_t       ProducerGeneration  = 0;    ///< Generation the producer is reading for
+    volatile bool           ReadFailed          = false;
+
+#ifdef ARDUINO_ARCH_ESP32
+    TaskHandle_t            TaskHandle = NULL;
+#   if defined (SUPPORT_FSEQ_ZSTD)
+        // the zstd block decoder runs on this task
+#       define PrefetchTaskStack 6000
+#   else
+#       define PrefetchTaskStack 3000
+#   endif // defined (SUPPORT_FSEQ_ZSTD)
+#endif // def ARDUINO_ARCH_ESP32
+
+    // Updated by the player and the prefetch task and reset by Begin
+    std::atomic<uint32_t>   FramesRead      {0};
+    std::atomic<uint32_t>   FramesSkipped   {0};    ///< Read but too late to play
+    std::atomic<uint32_t>   Underruns       {0};    ///< Frame was due but had not been read yet
+    std::atomic<uint32_t>   Restarts        {0};
+    std::atomic<uint32_t>   ReadErrors      {0};
+    std::atomic<uint32_t>   MaxReadTimeUS   {0};    ///< Worst time to read one frame from the card
+    std::atomic<uint32_t>   LastReadTimeUS  {0};
+
+}; // c_InputFPPRemotePlayFilePrefetch
@@ -33,6 +33,7 @@
 #include "InputDDP.h"
 #include "InputFPPRemote.h"
 #include "InputArtnet.hpp"
+#include "InputPacketRing.hpp"
 // needs to be last
 #include "InputMgr.hpp"
 
@@ -117,6 +118,8 @@ void c_InputMgr::Begin (uint32_t BufferSize)
     // prevent recalls
     if (true == HasBeenInitialized) { return; }
 
+    InputPacketRing.Begin ();
+
     String temp = String (F("Effects Control"));
     ExternalInput.Init (0,0, c_ExternalInput::Polarity_t::ActiveLow, temp);
 
@@ -320,6 +323,9 @@ void c_InputMgr::GetStatus (JsonObject& jsonStatus)
     JsonObject InputButtonStatus = jsonStatus.createNestedObject (F ("inputbutton"));
     ExternalInput.GetStatistics (InputButtonStatus);
 
+    JsonObject PacketRingStatus = jsonStatus.createNestedObject (F ("packetring"));
+    InputPacketRing.GetStatus (PacketRingStatus);
+
     JsonArray InputStatus = jsonStatus.createNestedArray (F ("input"));
     for (auto & CurrentInput : InputChannelDrivers)
     {
@@ -331,6 +337,19 @@ void c_InputMgr::GetStatus (JsonObject& jsonStatus)
     // DEBUG_END;
 } // GetStatus
 
+//-----------------------------------------------------------------------------
+void c_InputMgr::ResetTimingStats ()
+{
+    // DEBUG_START;
+
+    for (auto & CurrentInput : InputChannelDrivers)
+    {
+        CurrentInput.pInputChannelDriver->ResetTimingStats ();
+    }
+
+    // DEBUG_END;
+} // ResetTimingStats
+
 //-----------------------------------------------------------------------------
 /* Determine whether the input type is allowed on the desired input channel
 *
@@ -644,6 +663,7 @@ void c_InputMgr::Process ()
         }
 
         ExternalInput.Poll ();
+        InputPacketRing.Poll ();
         ProcessEffectsButtonActions ();
 
         if (true == configLoadNeeded)
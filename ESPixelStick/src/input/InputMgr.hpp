@@ -51,6 +51,7 @@ public:
     void LoadConfig           ();
     void GetConfig            (byte * Response, uint32_t maxlen);
     void GetStatus            (JsonObject & jsonStatus);
+    void ResetTimingStats     ();
     void SetConfig            (const char * NewConfig);
     void SetConfig            (ArduinoJson::JsonDocument & NewConfig);
     void Process              ();
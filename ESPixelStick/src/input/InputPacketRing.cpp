@@ -0,0 +1,472 @@
+/*
+* InputPacketRing.cpp - Hand off between the network receive callbacks and the output buffer
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "InputPacketRing.hpp"
+#include "InputCommon.hpp"
+#include <new>
+
+#define IPR_FLUSH_MAX_WAIT_MS   100
+
+#ifdef ARDUINO_ARCH_ESP32
+//-----------------------------------------------------------------------------
+static void InputPacketRingTask (void * pvParameters)
+{
+    // DEBUG_START;
+
+    for (;;)
+    {
+        // wake up at least once a timer period so that the inputs can
+        // give up on packets that are not going to arrive
+        ulTaskNotifyTake (pdTRUE, pdMS_TO_TICKS (IPR_TIMER_PERIOD_MS));
+        InputPacketRing.Drain ();
+        InputPacketRing.ProcessTimers ();
+    }
+
+    // DEBUG_END;
+
+} // InputPacketRingTask
+#endif // def ARDUINO_ARCH_ESP32
+
+//-----------------------------------------------------------------------------
+c_InputPacketRing::c_InputPacketRing ()
+{
+    // DEBUG_START;
+
+    // DEBUG_END;
+} // c_InputPacketRing
+
+//-----------------------------------------------------------------------------
+c_InputPacketRing::~c_InputPacketRing ()
+{
+    // DEBUG_START;
+
+#ifdef ARDUINO_ARCH_ESP32
+    if (NULL != DrainTaskHandle)
+    {
+        vTaskDelete (DrainTaskHandle);
+        DrainTaskHandle = NULL;
+    }
+#endif // def ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+} // ~c_InputPacketRing
+
+//-----------------------------------------------------------------------------
+void c_InputPacketRing::Begin ()
+{
+    // DEBUG_START;
+
+#ifdef ARDUINO_ARCH_ESP32
+    if (NULL == TimerInputLock)
+    {
+        TimerInputLock = xSemaphoreCreateMutex ();
+    }
+
+    if (NULL == DrainTaskHandle)
+    {
+        // Below the async UDP task so that a burst of packets is drained as a
+        // batch, above loop() so that web and config work cannot hold it up.
+        xTaskCreatePinnedToCore (InputPacketRingTask, "InputRingTask", 4096, this, ESP_TASK_PRIO_MIN + 2, &DrainTaskHandle, 0);
+        if (NULL == DrainTaskHandle)
+        {
+            logcon (CN_stars + String (F (" Could not start the input packet task. Packets will be processed as they arrive ")) + CN_stars);
+        }
+    }
+#endif // def ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+
+} // Begin
+
+#ifdef ARDUINO_ARCH_ESP32
+//-----------------------------------------------------------------------------
+/*
+    Called by the producer. Returns the next slot to fill or nullptr if the
+    ring is full. The slot is not visible to the consumer until the head
+    is moved past it.
+*/
+c_InputPacketRing::Slot_t * c_InputPacketRing::GetFreeSlot ()
+{
+    // DEBUG_START;
+
+    Slot_t * Response = nullptr;
+
+    do // once
+    {
+        uint32_t CurrentHead = Head.load (std::memory_order_relaxed);
+        uint32_t SlotsInUse  = CurrentHead - Tail.load (std::memory_order_acquire);
+        if (SlotsInUse >= IPR_NUM_SLOTS)
+        {
+            ++PacketsDropped;
+            break;
+        }
+
+        HighWaterMark = max (HighWaterMark, SlotsInUse + 1);
+        Response = &Slots[CurrentHead & (IPR_NUM_SLOTS - 1)];
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return Response;
+
+} // GetFreeSlot
+#endif // def ARDUINO_ARCH_ESP32
+
+//-----------------------------------------------------------------------------
+/*
+    Called by the producer. Copies the packet into the next free slot and
+    wakes the drain task. Returns false if the packet was dropped.
+*/
+bool c_InputPacketRing::Push (c_InputCommon * pOwner, const uint8_t * Data, uint32_t Length, IPAddress RemoteIP)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        if (Length > IPR_SLOT_SIZE)
+        {
+            ++PacketsTooLarge;
+            break;
+        }
+
+        ++PacketsQueued;
+
+#ifdef ARDUINO_ARCH_ESP32
+        if (NULL == DrainTaskHandle)
+        {
+            pOwner->ProcessQueuedPacket ((uint8_t *)Data, Length, RemoteIP, micros ());
+            Response = true;
+            break;
+        }
+
+        Slot_t * pSlot = GetFreeSlot ();
+        if (nullptr == pSlot)
+        {
+            break;
+        }
+
+        pSlot->pOwner                = pOwner;
+        pSlot->pPacket               = nullptr;
+        pSlot->Length                = Length;
+        pSlot->RemoteIP              = uint32_t (RemoteIP);
+        pSlot->ArrivalTimeInMicroSec = micros ();
+        memcpy (pSlot->Data, Data, Length);
+
+        // publish the slot
+        Head.fetch_add (1, std::memory_order_release);
+        xTaskNotifyGive (DrainTaskHandle);
+#else
+        pOwner->ProcessQueuedPacket ((uint8_t *)Data, Length, RemoteIP, micros ());
+#endif // def ARDUINO_ARCH_ESP32
+
+        Response = true;
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return Response;
+
+} // Push
+
+//-----------------------------------------------------------------------------
+/*
+    Called by the producer. The slot takes a reference to the received
+    buffer so the payload is not copied. The reference is released once
+    the input has processed the packet.
+*/
+bool c_InputPacketRing::Push (c_InputCommon * pOwner, AsyncUDPPacket & Packet)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        ++PacketsQueued;
+
+#ifdef ARDUINO_ARCH_ESP32
+        if (NULL == DrainTaskHandle)
+        {
+            pOwner->ProcessQueuedPacket (Packet.data (), Packet.length (), Packet.remoteIP (), micros ());
+            Response = true;
+            break;
+        }
+
+        Slot_t * pSlot = GetFreeSlot ();
+        if (nullptr == pSlot)
+        {
+            break;
+        }
+
+        pSlot->pOwner                = pOwner;
+        pSlot->pPacket               = new (pSlot->PacketStorage) AsyncUDPPacket (Packet);
+        pSlot->Length                = Packet.length ();
+        pSlot->RemoteIP              = uint32_t (Packet.remoteIP ());
+        pSlot->ArrivalTimeInMicroSec = micros ();
+        ++PacketsReferenced;
+
+        // publish the slot
+        Head.fetch_add (1, std::memory_order_release);
+        xTaskNotifyGive (DrainTaskHandle);
+#else
+        pOwner->ProcessQueuedPacket (Packet.data (), Packet.length (), Packet.remoteIP (), micros ());
+#endif // def ARDUINO_ARCH_ESP32
+
+        Response = true;
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return Response;
+
+} // Push
+
+//-----------------------------------------------------------------------------
+/*
+    Called by the consumer. Hands every queued packet to its input. A slot
+    is returned to the producer as soon as its packet has been processed.
+*/
+void c_InputPacketRing::Drain ()
+{
+    // DEBUG_START;
+
+#ifdef ARDUINO_ARCH_ESP32
+    uint32_t CurrentTail = Tail.load (std::memory_order_relaxed);
+    uint32_t CurrentHead = Head.load (std::memory_order_acquire);
+
+    if (CurrentTail != CurrentHead)
+    {
+        ++Batches;
+    }
+
+    while (CurrentTail != CurrentHead)
+    {
+        Slot_t & Slot = Slots[CurrentTail & (IPR_NUM_SLOTS - 1)];
+        uint8_t * Data = (nullptr != Slot.pPacket) ? Slot.pPacket->data () : Slot.Data;
+
+        // Announce the call before checking the owner again. Flush clears
+        // the owner before it checks ActiveOwner so one of us sees the other.
+        ActiveOwner.store (Slot.pOwner.load ());
+        c_InputCommon * pOwner = Slot.pOwner.load ();
+        if (nullptr != pOwner)
+        {
+            pOwner->ProcessQueuedPacket (Data, Slot.Length, IPAddress (Slot.RemoteIP), Slot.ArrivalTimeInMicroSec);
+        }
+        ActiveOwner.store (nullptr);
+
+        if (nullptr != Slot.pPacket)
+        {
+            // give the receive buffer back to the network stack
+            Slot.pPacket->~AsyncUDPPacket ();
+            Slot.pPacket = nullptr;
+        }
+
+        Tail.store (++CurrentTail, std::memory_order_release);
+
+        if (CurrentTail == CurrentHead)
+        {
+            // pick up anything that arrived while we were busy
+            CurrentHead = Head.load (std::memory_order_acquire);
+        }
+    }
+#endif // def ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+
+} // Drain
+
+//-----------------------------------------------------------------------------
+/*
+    Wait for the packets queued so far to be processed. Inputs call this
+    before they go away so that the drain task never calls a deleted input.
+    If the drain task does not catch up in time, the packets that are left
+    for pOwner are dropped instead. The drain task skips them and still
+    returns their buffers.
+*/
+void c_InputPacketRing::Flush (c_InputCommon * pOwner)
+{
+    // DEBUG_START;
+
+#ifdef ARDUINO_ARCH_ESP32
+    do // once
+    {
+        if (NULL == DrainTaskHandle)
+        {
+            // packets are processed as they arrive. Nothing is queued
+            break;
+        }
+
+        bool CalledByDrainTask = (xTaskGetCurrentTaskHandle () == DrainTaskHandle);
+        uint32_t TargetHead = Head.load (std::memory_order_acquire);
+        uint32_t WaitTimeMS = 0;
+
+        while (!CalledByDrainTask &&
+               (int32_t (TargetHead - Tail.load (std::memory_order_acquire)) > 0) &&
+               (WaitTimeMS++ < IPR_FLUSH_MAX_WAIT_MS))
+        {
+            vTaskDelay (pdMS_TO_TICKS (1));
+        }
+
+        // include anything that arrived while we were waiting
+        uint32_t CurrentHead = Head.load (std::memory_order_acquire);
+        for (uint32_t CurrentSlot = Tail.load (std::memory_order_acquire); CurrentSlot != CurrentHead; ++CurrentSlot)
+        {
+            c_InputCommon * pExpected = pOwner;
+            if (Slots[CurrentSlot & (IPR_NUM_SLOTS - 1)].pOwner.compare_exchange_strong (pExpected, nullptr))
+            {
+                ++PacketsDropped;
+            }
+        }
+
+        // a packet the drain task had already picked up is allowed to finish
+        while (!CalledByDrainTask && (pOwner == ActiveOwner.load ()))
+        {
+            vTaskDelay (pdMS_TO_TICKS (1));
+        }
+
+    } while (false);
+#endif // def ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+
+} // Flush
+
+//-----------------------------------------------------------------------------
+void c_InputPacketRing::AddTimerInput (c_InputCommon * pInput)
+{
+    // DEBUG_START;
+
+#ifdef ARDUINO_ARCH_ESP32
+    if (NULL != TimerInputLock) { xSemaphoreTake (TimerInputLock, portMAX_DELAY); }
+#endif // def ARDUINO_ARCH_ESP32
+
+    for (auto & CurrentInput : TimerInputs)
+    {
+        if (nullptr == CurrentInput)
+        {
+            CurrentInput = pInput;
+            break;
+        }
+    }
+
+#ifdef ARDUINO_ARCH_ESP32
+    if (NULL != TimerInputLock) { xSemaphoreGive (TimerInputLock); }
+#endif // def ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+
+} // AddTimerInput
+
+//-----------------------------------------------------------------------------
+void c_InputPacketRing::RemoveTimerInput (c_InputCommon * pInput)
+{
+    // DEBUG_START;
+
+#ifdef ARDUINO_ARCH_ESP32
+    // waits for a timer call that is in progress
+    if (NULL != TimerInputLock) { xSemaphoreTake (TimerInputLock, portMAX_DELAY); }
+#endif // def ARDUINO_ARCH_ESP32
+
+    for (auto & CurrentInput : TimerInputs)
+    {
+        if (pInput == CurrentInput)
+        {
+            CurrentInput = nullptr;
+        }
+    }
+
+#ifdef ARDUINO_ARCH_ESP32
+    if (NULL != TimerInputLock) { xSemaphoreGive (TimerInputLock); }
+#endif // def ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+
+} // RemoveTimerInput
+
+//-----------------------------------------------------------------------------
+/*
+    Called in the context that processes the packets: the drain task on the
+    ESP32 and loop() on the ESP8266.
+*/
+void c_InputPacketRing::ProcessTimers ()
+{
+    // DEBUG_START;
+
+#ifdef ARDUINO_ARCH_ESP32
+    if (NULL != TimerInputLock) { xSemaphoreTake (TimerInputLock, portMAX_DELAY); }
+#endif // def ARDUINO_ARCH_ESP32
+
+    for (auto CurrentInput : TimerInputs)
+    {
+        if (nullptr != CurrentInput)
+        {
+            CurrentInput->ProcessQueuedTimer ();
+        }
+    }
+
+#ifdef ARDUINO_ARCH_ESP32
+    if (NULL != TimerInputLock) { xSemaphoreGive (TimerInputLock); }
+#endif // def ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+
+} // ProcessTimers
+
+//-----------------------------------------------------------------------------
+void c_InputPacketRing::Poll ()
+{
+    // DEBUG_START;
+
+#ifndef ARDUINO_ARCH_ESP32
+    // the receive callbacks run in this context. There is no drain task to do it
+    ProcessTimers ();
+#endif // ndef ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+
+} // Poll
+
+//-----------------------------------------------------------------------------
+void c_InputPacketRing::GetStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+#ifdef ARDUINO_ARCH_ESP32
+    jsonStatus[F ("slots")]     = IPR_NUM_SLOTS;
+#else
+    jsonStatus[F ("slots")]     = 0;
+#endif // def ARDUINO_ARCH_ESP32
+    jsonStatus[F ("queued")]    = PacketsQueued;
+    jsonStatus[F ("dropped")]   = PacketsDropped.load ();
+    jsonStatus[F ("toolarge")]  = PacketsTooLarge;
+    jsonStatus[F ("zerocopy")]  = PacketsReferenced;
+    jsonStatus[F ("highwater")] = HighWaterMark;
+    jsonStatus[F ("batches")]   = Batches;
+
+    // DEBUG_END;
+
+} // GetStatus
+
+// create a global instance of the packet ring
+c_InputPacketRing InputPacketRing;
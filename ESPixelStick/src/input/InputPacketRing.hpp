@@ -0,0 +1,111 @@
+#pragma once
+/*
+* InputPacketRing.hpp - Hand off between the network receive callbacks and the output buffer
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The UDP receive callbacks copy each data packet into a preallocated slot
+*   and return. A single drain task hands the packets to their inputs, which
+*   are then the only network code writing into the output buffer.
+*
+*   There is one producer (the async UDP task) and one consumer (the drain
+*   task) so the ring needs no locks. On the ESP8266 the receive callbacks
+*   already run in the same context as loop() and the packets are passed on
+*   as they arrive.
+*
+*   Inputs that wait for more packets (sync timeouts and the like) register
+*   for a timer call. It is made in the same context as the packet calls so
+*   that the timeout can write into the output buffer without a lock.
+*
+*   Inputs that get the AsyncUDP packet can queue a reference to it instead
+*   of a copy. The slot then holds on to the received buffer and the payload
+*   is only copied once, by the input, into the output buffer.
+*
+*   Any input state that ProcessQueuedPacket or ProcessQueuedTimer use
+*   (sync and merge buffers, universe tables and the like) may only be freed
+*   or reallocated from those calls. The config path sets a flag or records
+*   the new size and the next packet or timer call applies it. Flush and
+*   RemoveTimerInput are the only way to stop the calls before the state is
+*   freed in a destructor.
+*
+*/
+
+#include "../ESPixelStick.h"
+#include <atomic>
+#ifdef ARDUINO_ARCH_ESP32
+#   include <AsyncUDP.h>
+#   include <freertos/semphr.h>
+#else
+#   include <ESPAsyncUDP.h>
+#endif
+
+class c_InputCommon;
+
+class c_InputPacketRing
+{
+public:
+    c_InputPacketRing ();
+    virtual ~c_InputPacketRing ();
+
+#define IPR_SLOT_SIZE   1460    ///< Largest UDP payload in an ethernet frame
+#define IPR_NUM_SLOTS   16      ///< Must be a power of two
+#define IPR_TIMER_PERIOD_MS     10  ///< Registered inputs get a timer call at least this often
+#define IPR_MAX_TIMER_INPUTS    4
+
+    void Begin     ();
+    bool Push      (c_InputCommon * pOwner, const uint8_t * Data, uint32_t Length, IPAddress RemoteIP);
+    bool Push      (c_InputCommon * pOwner, AsyncUDPPacket & Packet); ///< Queue the packet without copying its payload
+    void Flush     (c_InputCommon * pOwner);   ///< Returns once no packet for pOwner is queued or being processed
+    void Drain     ();
+    void GetStatus (JsonObject & jsonStatus);
+    void AddTimerInput    (c_InputCommon * pInput);
+    void RemoveTimerInput (c_InputCommon * pInput);   ///< Returns once the input is no longer being called
+    void ProcessTimers    ();   ///< Called by the drain task
+    void Poll             ();   ///< Call from loop()
+
+private:
+#ifdef ARDUINO_ARCH_ESP32
+    struct Slot_t
+    {
+        std::atomic<c_InputCommon *> pOwner;    ///< Set to nullptr when the input goes away before the packet is drained
+        uint32_t        Length;
+        uint32_t        RemoteIP;
+        uint32_t        ArrivalTimeInMicroSec;
+        AsyncUDPPacket* pPacket;                ///< Set when the slot holds a reference to a received packet
+        uint8_t         PacketStorage[sizeof (AsyncUDPPacket)] __attribute__ ((aligned (4)));
+        uint8_t         Data[IPR_SLOT_SIZE] __attribute__ ((aligned (4)));
+    };
+    Slot_t                  Slots[IPR_NUM_SLOTS];
+    std::atomic<uint32_t>   Head {0};       ///< Next slot to fill. Only written by the producer
+    std::atomic<uint32_t>   Tail {0};       ///< Next slot to drain. Only written by the consumer
+    std::atomic<c_InputCommon *> ActiveOwner {nullptr}; ///< Input the drain task is calling right now
+    TaskHandle_t            DrainTaskHandle = NULL;
+    SemaphoreHandle_t       TimerInputLock  = NULL;  ///< Held while the timer inputs are called or changed
+
+    Slot_t * GetFreeSlot ();
+#endif // def ARDUINO_ARCH_ESP32
+
+    c_InputCommon * TimerInputs[IPR_MAX_TIMER_INPUTS] = {nullptr};
+
+    uint32_t    PacketsQueued       = 0;
+    std::atomic<uint32_t> PacketsDropped {0};   ///< Ring was full or the owner went away. Counted by the producer and by Flush
+    uint32_t    PacketsTooLarge     = 0;
+    uint32_t    PacketsReferenced   = 0;    ///< Queued without a copy
+    uint32_t    HighWaterMark       = 0;    ///< Most slots in use at once
+    uint32_t    Batches             = 0;    ///< Times the drain task emptied the ring
+
+}; // c_InputPacketRing
+
+extern c_InputPacketRing InputPacketRing;
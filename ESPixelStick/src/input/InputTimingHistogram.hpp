@@ -0,0 +1,152 @@
+#pragma once
+/*
+* InputTimingHistogram.hpp - Fixed size timing histogram for the network inputs
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The samples are counted in units of 2^ITH_UNIT_SHIFT us. The first
+*   2 * ITH_SUB_BUCKETS buckets are one unit wide. After that every power of
+*   two is split into ITH_SUB_BUCKETS buckets, so a bucket is never wider
+*   than 1/8 of its lower bound: 24ms to 26ms, 26ms to 28ms and so on around
+*   a 40 fps frame. The last bucket counts everything from about half a
+*   second up. The counters are 16 bits wide. When one of them fills up all
+*   of the buckets are halved, which keeps the shape of the distribution and
+*   favors recent samples.
+*
+*   Only depends on the standard integer types so that it can be built and
+*   checked on a host as well as on the target.
+*
+*/
+
+#ifdef ARDUINO
+#   include "../ESPixelStick.h"
+#endif // def ARDUINO
+
+#include <stdint.h>
+#include <string.h>
+
+class c_InputTimingHistogram
+{
+public:
+#define ITH_UNIT_SHIFT      9       ///< 512us units
+#define ITH_SUB_BUCKET_BITS 3
+#define ITH_SUB_BUCKETS     (1 << ITH_SUB_BUCKET_BITS)
+#define ITH_NUM_BUCKETS     64
+
+    //-------------------------------------------------------------------------
+    void Add (uint32_t SampleInMicroSec)
+    {
+        uint32_t BucketId = GetBucketId (SampleInMicroSec);
+
+        if (uint16_t (-1) == Buckets[BucketId])
+        {
+            for (auto & CurrentBucket : Buckets)
+            {
+                CurrentBucket >>= 1;
+            }
+        }
+
+        Buckets[BucketId]++;
+        MaxInMicroSec = (SampleInMicroSec > MaxInMicroSec) ? SampleInMicroSec : MaxInMicroSec;
+
+    } // Add
+
+    //-------------------------------------------------------------------------
+    void Clear ()
+    {
+        memset (Buckets, 0x00, sizeof (Buckets));
+        MaxInMicroSec = 0;
+
+    } // Clear
+
+    //-------------------------------------------------------------------------
+    /*
+        Returns the upper bound of the bucket that contains the requested
+        percentile, limited to the largest sample seen.
+    */
+    uint32_t GetPercentile (uint32_t Percentile)
+    {
+        uint32_t Response    = 0;
+        uint32_t SampleCount = 0;
+
+        for (auto & CurrentBucket : Buckets)
+        {
+            SampleCount += CurrentBucket;
+        }
+
+        uint32_t Threshold = (SampleCount * Percentile + 99) / 100;
+        uint32_t Total     = 0;
+
+        for (uint32_t BucketId = 0; (BucketId < ITH_NUM_BUCKETS) && (0 != SampleCount); ++BucketId)
+        {
+            Total += Buckets[BucketId];
+            if (Total >= Threshold)
+            {
+                // the last bucket has no upper bound
+                uint32_t UpperBound = ((ITH_NUM_BUCKETS - 1) == BucketId) ? MaxInMicroSec : (GetBucketLowerBound (BucketId + 1) - 1);
+                Response = (UpperBound < MaxInMicroSec) ? UpperBound : MaxInMicroSec;
+                break;
+            }
+        }
+
+        return Response;
+
+    } // GetPercentile
+
+    //-------------------------------------------------------------------------
+    static uint32_t GetBucketId (uint32_t SampleInMicroSec)
+    {
+        uint32_t Units    = SampleInMicroSec >> ITH_UNIT_SHIFT;
+        uint32_t BucketId = Units;
+
+        if (Units >= (2 * ITH_SUB_BUCKETS))
+        {
+            // the top ITH_SUB_BUCKET_BITS + 1 bits select the bucket
+            uint32_t Exponent = (31 - __builtin_clz (Units)) - ITH_SUB_BUCKET_BITS;
+            BucketId = (Exponent * ITH_SUB_BUCKETS) + (Units >> Exponent);
+        }
+
+        return (BucketId < ITH_NUM_BUCKETS) ? BucketId : (ITH_NUM_BUCKETS - 1);
+
+    } // GetBucketId
+
+    //-------------------------------------------------------------------------
+    /// Smallest sample counted by a bucket. ITH_NUM_BUCKETS gives the end of the last regular bucket.
+    static uint32_t GetBucketLowerBound (uint32_t BucketId)
+    {
+        uint32_t Units = BucketId;
+
+        if (BucketId >= (2 * ITH_SUB_BUCKETS))
+        {
+            uint32_t Exponent = (BucketId / ITH_SUB_BUCKETS) - 1;
+            Units = ((BucketId % ITH_SUB_BUCKETS) + ITH_SUB_BUCKETS) << Exponent;
+        }
+
+        return Units << ITH_UNIT_SHIFT;
+
+    } // GetBucketLowerBound
+
+    uint16_t GetBucket (uint32_t BucketId) { return Buckets[BucketId]; }
+    uint32_t GetMax    () { return MaxInMicroSec; }
+
+#ifdef ARDUINO
+    void GetStatus (JsonObject & jsonStatus);
+#endif // def ARDUINO
+
+private:
+    uint16_t    Buckets[ITH_NUM_BUCKETS] = {0};
+    uint32_t    MaxInMicroSec            = 0;
+
+}; // c_InputTimingHistogram
@@ -0,0 +1,132 @@
+/*
+* InputTimingStats.cpp - Packet timing histograms for the network inputs
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "InputTimingStats.hpp"
+#include "../output/OutputMgr.hpp"
+
+//-----------------------------------------------------------------------------
+void c_InputTimingHistogram::GetStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+    jsonStatus[F ("p50")] = GetPercentile (50);
+    jsonStatus[F ("p99")] = GetPercentile (99);
+    jsonStatus[F ("max")] = MaxInMicroSec;
+
+    // only the buckets that have samples. Each entry is the lower bound in us and the count.
+    JsonArray BucketStatus = jsonStatus.createNestedArray (F ("buckets"));
+    for (uint32_t BucketId = 0; BucketId < ITH_NUM_BUCKETS; ++BucketId)
+    {
+        if (0 == Buckets[BucketId])
+        {
+            continue;
+        }
+
+        JsonArray CurrentBucket = BucketStatus.createNestedArray ();
+        CurrentBucket.add (GetBucketLowerBound (BucketId));
+        CurrentBucket.add (Buckets[BucketId]);
+    }
+
+    // DEBUG_END;
+
+} // GetStatus
+
+//-----------------------------------------------------------------------------
+void c_InputArrivalStats::PacketArrived (uint32_t ArrivalTimeInMicroSec)
+{
+    // DEBUG_START;
+
+    if (ResetRequested)
+    {
+        ResetRequested  = false;
+        HaveLastArrival = false;
+        InterArrival.Clear ();
+    }
+
+    if (HaveLastArrival)
+    {
+        InterArrival.Add (ArrivalTimeInMicroSec - LastArrivalTimeInMicroSec);
+    }
+
+    LastArrivalTimeInMicroSec = ArrivalTimeInMicroSec;
+    HaveLastArrival           = true;
+
+    // DEBUG_END;
+
+} // PacketArrived
+
+//-----------------------------------------------------------------------------
+/*
+    Only the oldest data that has not been sent yet is timed. Data that is
+    written again before the next frame starts is part of the same frame.
+*/
+void c_InputLatencyStats::DataWritten (uint32_t ArrivalTimeInMicroSec)
+{
+    // DEBUG_START;
+
+    if (ResetRequested)
+    {
+        ResetRequested  = false;
+        HavePendingData = false;
+        Latency.Clear ();
+    }
+
+    CheckPendingData ();
+
+    if (!HavePendingData)
+    {
+        PendingArrivalTimeInMicroSec = ArrivalTimeInMicroSec;
+        PendingFrameStartId          = OutputMgr.GetFrameStartCount ();
+        HavePendingData              = true;
+    }
+
+    // DEBUG_END;
+
+} // DataWritten
+
+//-----------------------------------------------------------------------------
+void c_InputLatencyStats::CheckPendingData ()
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if (!HavePendingData || (OutputMgr.GetFrameStartCount () == PendingFrameStartId))
+        {
+            // no frame has started since the data was written
+            break;
+        }
+
+        HavePendingData = false;
+
+        uint32_t FrameStartTimeInMicroSec = 0;
+        if (!OutputMgr.GetFrameStartTime (PendingFrameStartId, FrameStartTimeInMicroSec))
+        {
+            // too long ago to be measured
+            break;
+        }
+
+        int32_t LatencyInMicroSec = int32_t (FrameStartTimeInMicroSec - PendingArrivalTimeInMicroSec);
+        Latency.Add (uint32_t (max (LatencyInMicroSec, int32_t (0))));
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // CheckPendingData
@@ -0,0 +1,62 @@
+#pragma once
+/*
+* InputTimingStats.hpp - Packet timing histograms for the network inputs
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Inter-arrival and latency statistics built on c_InputTimingHistogram.
+*
+*   The statistics are only updated by the code that processes the packets.
+*   A reset is requested from any context and done by the next update.
+*
+*/
+
+#include "../ESPixelStick.h"
+#include "InputTimingHistogram.hpp"
+
+/// Inter-arrival time of the packets for one universe or stream
+class c_InputArrivalStats
+{
+public:
+    void PacketArrived (uint32_t ArrivalTimeInMicroSec);
+    void RequestReset  () { ResetRequested = true; }
+    void GetStatus     (JsonObject & jsonStatus) { InterArrival.GetStatus (jsonStatus); }
+
+private:
+    c_InputTimingHistogram  InterArrival;
+    uint32_t                LastArrivalTimeInMicroSec = 0;
+    bool                    HaveLastArrival           = false;
+    volatile bool           ResetRequested            = false;
+
+}; // c_InputArrivalStats
+
+/// Time from the receipt of a packet to the start of the first output frame that contains its data
+class c_InputLatencyStats
+{
+public:
+    void DataWritten   (uint32_t ArrivalTimeInMicroSec);   ///< Call after new data has been written to the output buffer
+    void RequestReset  () { ResetRequested = true; }
+    void GetStatus     (JsonObject & jsonStatus) { Latency.GetStatus (jsonStatus); }
+
+private:
+    c_InputTimingHistogram  Latency;
+    uint32_t                PendingArrivalTimeInMicroSec = 0;   ///< Oldest data not yet seen in an output frame
+    uint32_t                PendingFrameStartId          = 0;   ///< First frame that can contain the pending data
+    bool                    HavePendingData              = false;
+    volatile bool           ResetRequested               = false;
+
+    void CheckPendingData ();
+
+}; // c_InputLatencyStats
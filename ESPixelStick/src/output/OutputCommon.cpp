@@ -37,7 +37,9 @@ c_OutputCommon::c_OutputCommon (c_OutputMgr::e_OutputChannelIds _OutputChannelId
 	UartId                   = uart;
     OutputType               = outputType;
     pOutputBuffer            = OutputMgr.GetBufferAddress ();
+    pFrameBuffer             = pOutputBuffer;
     FrameStartTimeInMicroSec = 0;
+    memset ((void*)&JitterHistogram[0], 0x00, sizeof (JitterHistogram));
 
 	// logcon (String ("UartId:          '") + UartId + "'");
     // logcon (String ("OutputChannelId: '") + OutputChannelId + "'");
@@ -60,6 +62,7 @@ void c_OutputCommon::ClearBuffer ()
     // DEBUG_START;
 
     memset(GetBufferAddress(), 0x00, GetBufferUsedSize());
+    FrameIsDirty = true;
 
     // DEBUG_END;
 } // ClearBuffer
@@ -72,6 +75,14 @@ void c_OutputCommon::GetStatus (JsonObject & jsonStatus)
     jsonStatus[CN_id] = OutputChannelId;
     jsonStatus["framerefreshrate"] = (0 == FrameRefreshTimeInMicroSec) ? 0 : int(MicroSecondsInASecond / FrameRefreshTimeInMicroSec);
     jsonStatus["FrameCount"] = FrameCount;
+    jsonStatus["FramesSkipped"] = FramesSkipped;
+    jsonStatus["maxfps"] = (0 == FrameMinDurationInMicroSec) ? 0 : int(MicroSecondsInASecond / FrameMinDurationInMicroSec);
+
+    JsonObject JitterStatus = jsonStatus.createNestedObject ("jitter");
+    JitterStatus["min"] = (JitterSampleCount) ? JitterMinInMicroSec : 0;
+    JitterStatus["avg"] = (JitterSampleCount) ? uint32_t (JitterTotalInMicroSec / JitterSampleCount) : 0;
+    JitterStatus["max"] = JitterMaxInMicroSec;
+    JitterStatus["p99"] = GetJitterPercentile (99);
 
     // DEBUG_END;
 } // GetStatus
@@ -84,13 +95,127 @@ void c_OutputCommon::ReportNewFrame ()
     uint32_t Now = micros ();
     FrameRefreshTimeInMicroSec = Now - FrameStartTimeInMicroSec;
     FrameStartTimeInMicroSec = Now;
+    FrameSentTimeInMicroSec  = Now;
+
+    // Some drivers report the same frame twice. A frame cannot legitimately
+    // start before the minimum frame time has passed so ignore those.
+    if ((0 != FrameCount) && (FrameRefreshTimeInMicroSec >= FrameMinDurationInMicroSec))
+    {
+        UpdateJitterStats (FrameRefreshTimeInMicroSec - FrameMinDurationInMicroSec);
+    }
 
     FrameCount++;
+    OutputMgr.ReportFrameStart (Now);
 
     // DEBUG_END;
 
 } // ReportNewFrame
 
+//----------------------------------------------------------------------------
+/*
+    Returns true if the data has not changed since the last frame and the
+    keep alive time has not yet expired.
+*/
+bool c_OutputCommon::FrameIsUnchanged ()
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        if ((0 == KeepAliveIntervalInMs) || FrameIsDirty)
+        {
+            break;
+        }
+
+        if ((micros () - FrameSentTimeInMicroSec) >= (KeepAliveIntervalInMs * 1000))
+        {
+            // DEBUG_V ("Keep alive");
+            break;
+        }
+
+        Response = true;
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return Response;
+
+} // FrameIsUnchanged
+
+//----------------------------------------------------------------------------
+/*
+    Called when it is time to start a new frame. Returns true if the frame
+    should not be sent because the data has not changed since the last
+    frame and the keep alive time has not yet expired. A skipped frame
+    restarts the frame timer so that it is not counted as jitter.
+*/
+bool c_OutputCommon::SkipUnchangedFrame ()
+{
+    // DEBUG_START;
+
+    bool Response = FrameIsUnchanged ();
+
+    if (Response)
+    {
+        FrameStartTimeInMicroSec = micros ();
+        FramesSkipped++;
+    }
+
+    // DEBUG_END;
+
+    return Response;
+
+} // SkipUnchangedFrame
+
+//----------------------------------------------------------------------------
+void c_OutputCommon::UpdateJitterStats (uint32_t DelayInMicroSec)
+{
+    // DEBUG_START;
+
+    JitterMinInMicroSec    = min (JitterMinInMicroSec, DelayInMicroSec);
+    JitterMaxInMicroSec    = max (JitterMaxInMicroSec, DelayInMicroSec);
+    JitterTotalInMicroSec += DelayInMicroSec;
+    JitterSampleCount++;
+
+    uint32_t BucketId = (DelayInMicroSec) ? (32 - __builtin_clz (DelayInMicroSec)) : 0;
+    JitterHistogram[min (BucketId, uint32_t (OC_JITTER_HISTOGRAM_SIZE - 1))]++;
+
+    // DEBUG_END;
+
+} // UpdateJitterStats
+
+//----------------------------------------------------------------------------
+/*
+    Returns the upper bound of the histogram bucket that contains the
+    requested percentile, limited to the largest delay seen.
+*/
+uint32_t c_OutputCommon::GetJitterPercentile (uint32_t Percentile)
+{
+    // DEBUG_START;
+
+    uint32_t Response  = 0;
+    uint32_t Threshold = uint32_t ((uint64_t (JitterSampleCount) * Percentile + 99) / 100);
+    uint32_t Total     = 0;
+
+    for (uint32_t BucketId = 0; (BucketId < OC_JITTER_HISTOGRAM_SIZE) && (0 != JitterSampleCount); ++BucketId)
+    {
+        Total += JitterHistogram[BucketId];
+        if (Total >= Threshold)
+        {
+            Response = min ((uint32_t (1) << BucketId) - 1, JitterMaxInMicroSec);
+            break;
+        }
+    }
+
+    // DEBUG_END;
+
+    return Response;
+
+} // GetJitterPercentile
+
 //----------------------------------------------------------------------------
 bool c_OutputCommon::SetConfig (JsonObject & jsonConfig)
 {
@@ -98,8 +223,12 @@ bool c_OutputCommon::SetConfig (JsonObject & jsonConfig)
     uint8_t tempDataPin = uint8_t (DataPin);
 
     bool response = setFromJSON (tempDataPin, jsonConfig, CN_data_pin);
+    response |= setFromJSON (KeepAliveIntervalInMs, jsonConfig, CN_keepalive);
 
     DataPin = gpio_num_t (tempDataPin);
+
+    // the new config may change what is on the wire
+    FrameIsDirty = true;
     // DEBUG_V(String(" DataPin: ") + String(DataPin));
 
     // DEBUG_END;
@@ -115,6 +244,7 @@ void c_OutputCommon::GetConfig (JsonObject & jsonConfig)
 
     // enums need to be converted to uints for json
     jsonConfig[CN_data_pin] = uint8_t (DataPin);
+    jsonConfig[CN_keepalive] = KeepAliveIntervalInMs;
 
     // DEBUG_V(String(" DataPin: ") + String(DataPin));
 
@@ -128,7 +258,11 @@ void c_OutputCommon::WriteChannelData (uint32_t StartChannelId, uint32_t Channel
 
     // DEBUG_V(String("               StartChannelId: 0x") + String(StartChannelId, HEX));
     // DEBUG_V(String("&OutputBuffer[StartChannelId]: 0x") + String(uint(&OutputBuffer[StartChannelId]), HEX));
-    memcpy(&pOutputBuffer[StartChannelId], pSourceData, ChannelCount);
+    if (0 != memcmp (&pOutputBuffer[StartChannelId], pSourceData, ChannelCount))
+    {
+        memcpy(&pOutputBuffer[StartChannelId], pSourceData, ChannelCount);
+        FrameIsDirty = true;
+    }
 
     // DEBUG_END;
 
@@ -50,8 +50,13 @@ public:
             uint32_t     GetBufferUsedSize ()  { return OutputBufferSize;}     ///< Get the address of the buffer into which the E1.31 handler will stuff data
             gpio_num_t   GetOutputGpio ()      { return DataPin; }
             OTYPE_t      GetOutputType ()      { return OutputType; }          ///< Have the instance report its type.
+            uint32_t     GetFrameMinDurationInMicroSec () { return FrameMinDurationInMicroSec; }
     virtual void         GetStatus (ArduinoJson::JsonObject & jsonStatus);
-            void         SetOutputBufferAddress (uint8_t* pNewOutputBuffer) { pOutputBuffer = pNewOutputBuffer; }
+            void         SetOutputBufferAddress (uint8_t* pNewOutputBuffer) { pOutputBuffer = pNewOutputBuffer; pFrameBuffer = pNewOutputBuffer; }
+            void         SetFrameBufferAddress  (uint8_t* pNewFrameBuffer)  { pFrameBuffer = pNewFrameBuffer; } ///< Private copy of the output data used while a frame is being sent
+            void         SetBufferDirty () { FrameIsDirty = true; }            ///< Data was written directly into the output buffer
+            bool         FrameIsUnchanged ();                                  ///< Same test as SkipUnchangedFrame without counting a skipped frame
+            bool         SkipUnchangedFrame ();                                ///< true if nothing changed and the keep alive time has not expired
     virtual void         SetOutputBufferSize (uint32_t NewOutputBufferSize)  { OutputBufferSize = NewOutputBufferSize; };
     virtual uint32_t     GetNumOutputBufferBytesNeeded () = 0;
     virtual uint32_t     GetNumOutputBufferChannelsServiced () = 0;
@@ -59,6 +64,8 @@ public:
     virtual void         ClearBuffer ();
     virtual void         WriteChannelData (uint32_t StartChannelId, uint32_t ChannelCount, byte *pSourceData);
     virtual void         ReadChannelData (uint32_t StartChannelId, uint32_t ChannelCount, byte *pTargetData);
+    virtual bool         WritesChannelDataUnchanged () { return true; }      ///< WriteChannelData is a plain copy into the output buffer
+    virtual bool         UsesHighRefreshRate () { return false; }            ///< Not limited to 40 fps
 
 protected:
 
@@ -68,19 +75,48 @@ protected:
     OID_t       OutputChannelId            = OID_t::OutputChannelId_End;
     bool        HasBeenInitialized         = false;
     uint32_t    FrameMinDurationInMicroSec = 25000;
-    uint8_t   * pOutputBuffer              = nullptr;
+    uint8_t   * pOutputBuffer              = nullptr;  ///< Data written by the input side
+    uint8_t   * pFrameBuffer               = nullptr;  ///< Data read by the transmitter. Same as pOutputBuffer unless double buffering
     uint32_t    OutputBufferSize           = 0;
     uint32_t    FrameCount                 = 0;
+    volatile bool FrameIsDirty             = true;     ///< The output data changed since the last frame was started
+    uint32_t    KeepAliveIntervalInMs      = 0;        ///< Resend unchanged data this often. 0 = send every frame
 
     void ReportNewFrame ();
 
+    inline void LatchFrameBuffer ()
+    {
+        // clear before reading the data so that a write during the frame is not lost
+        FrameIsDirty = false;
+
+        if ((pFrameBuffer != pOutputBuffer) &&
+            !OutputMgr.CopyStableOutputData (pFrameBuffer, pOutputBuffer, OutputBufferSize))
+        {
+            // an input kept writing. Send what we have and latch again next frame.
+            FrameIsDirty = true;
+        }
+    }
+
     inline bool canRefresh ()
     {
-        return (micros () - FrameStartTimeInMicroSec) >= FrameMinDurationInMicroSec;
+        return ((micros () - FrameStartTimeInMicroSec) >= FrameMinDurationInMicroSec) && !SkipUnchangedFrame ();
     }
 
 private:
     uint32_t    FrameRefreshTimeInMicroSec = 0;
     uint32_t    FrameStartTimeInMicroSec   = 0;
+    uint32_t    FrameSentTimeInMicroSec    = 0;
+    uint32_t    FramesSkipped              = 0;
+
+    // Frame start jitter: how much later than allowed by FrameMinDurationInMicroSec a frame started
+#define OC_JITTER_HISTOGRAM_SIZE 24
+    uint32_t    JitterMinInMicroSec        = uint32_t(-1);
+    uint32_t    JitterMaxInMicroSec        = 0;
+    uint64_t    JitterTotalInMicroSec      = 0;
+    uint32_t    JitterSampleCount          = 0;
+    uint32_t    JitterHistogram[OC_JITTER_HISTOGRAM_SIZE]; ///< Bucket N counts delays of less than 2^N us
+
+    void     UpdateJitterStats (uint32_t DelayInMicroSec);
+    uint32_t GetJitterPercentile (uint32_t Percentile);
 
 }; // c_OutputCommon
@@ -0,0 +1,547 @@
+/*
+* OutputI2s.cpp - I2S parallel output driver code for ESPixelStick
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+#include "../ESPixelStick.h"
+#if defined(SUPPORT_I2S_OUTPUT) && defined(ARDUINO_ARCH_ESP32)
+
+#include "OutputI2s.hpp"
+#include <esp_heap_caps.h>
+#include <driver/periph_ctrl.h>
+#include <soc/i2s_struct.h>
+#include <soc/i2s_reg.h>
+#include <soc/gpio_sig_map.h>
+#include <esp32/rom/gpio.h>
+
+// 80 MHz / 10 / 2 = 4 MHz = 5 samples per 1.25 us WS2811 bit
+#define I2S_CLKM_DIV_NUM    10
+#define I2S_CLKM_DIV_B      0
+#define I2S_CLKM_DIV_A      1
+#define I2S_TX_BCK_DIV      2
+
+// In 16 bit LCD mode the samples come out on I2S1 data lines 8 to 23
+#define I2S_LANE_SIGNAL_IDX(LaneId) (I2S1O_DATA_OUT8_IDX + (LaneId))
+
+c_OutputI2s OutputI2s;
+
+// forward declaration for the isr handler
+static void IRAM_ATTR i2s_intr_handler (void* param);
+
+//----------------------------------------------------------------------------
+c_OutputI2s::c_OutputI2s ()
+{
+    // DEBUG_START;
+
+    memset ((void *)&pDmaBuffers[0],     0x00, sizeof (pDmaBuffers));
+    memset ((void *)&DmaDescriptors[0],  0x00, sizeof (DmaDescriptors));
+    memset ((void *)&DmaBufferIsIdle[0], 0x00, sizeof (DmaBufferIsIdle));
+
+    // DEBUG_END;
+} // c_OutputI2s
+
+//----------------------------------------------------------------------------
+c_OutputI2s::~c_OutputI2s ()
+{
+    // DEBUG_START;
+
+    End ();
+
+    // DEBUG_END;
+} // ~c_OutputI2s
+
+//----------------------------------------------------------------------------
+/* shell function to set the 'this' pointer of the real ISR
+   This allows me to use non static variables in the ISR.
+ */
+static void IRAM_ATTR i2s_intr_handler (void* param)
+{
+    if (param)
+    {
+        reinterpret_cast<c_OutputI2s *>(param)->ISR_Handler ();
+    }
+
+} // i2s_intr_handler
+
+//----------------------------------------------------------------------------
+/*
+    Set up the peripheral the first time a lane is added
+*/
+bool c_OutputI2s::Begin ()
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if (HasBeenInitialized)
+        {
+            break;
+        }
+
+        // the DMA engine can only read internal memory
+        for (uint32_t BufferId = 0; BufferId < I2S_NUM_DMA_BUFFERS; ++BufferId)
+        {
+            pDmaBuffers[BufferId] = (uint16_t *)heap_caps_malloc (I2S_WORDS_PER_BUFFER * sizeof (uint16_t), MALLOC_CAP_DMA);
+            if (nullptr == pDmaBuffers[BufferId])
+            {
+                break;
+            }
+            memset (pDmaBuffers[BufferId], 0x00, I2S_WORDS_PER_BUFFER * sizeof (uint16_t));
+
+            lldesc_t & Descriptor = DmaDescriptors[BufferId];
+            Descriptor.size             = I2S_WORDS_PER_BUFFER * sizeof (uint16_t);
+            Descriptor.length           = I2S_WORDS_PER_BUFFER * sizeof (uint16_t);
+            Descriptor.offset           = 0;
+            Descriptor.sosf             = 0;
+            Descriptor.eof              = 1;    // interrupt at the end of every buffer
+            Descriptor.owner            = 1;
+            Descriptor.buf              = (uint8_t *)pDmaBuffers[BufferId];
+            Descriptor.qe.stqe_next     = &DmaDescriptors[(BufferId + 1) % I2S_NUM_DMA_BUFFERS];
+        }
+
+        if ((nullptr == pDmaBuffers[0]) || (nullptr == pDmaBuffers[I2S_NUM_DMA_BUFFERS - 1]))
+        {
+            logcon (F ("Could not allocate the I2S DMA buffers"));
+            End ();
+            break;
+        }
+
+        periph_module_enable (PERIPH_I2S1_MODULE);
+
+        // reset the peripheral
+        I2S1.conf.tx_reset      = 1;
+        I2S1.conf.tx_reset      = 0;
+        I2S1.conf.tx_fifo_reset = 1;
+        I2S1.conf.tx_fifo_reset = 0;
+        I2S1.lc_conf.out_rst    = 1;
+        I2S1.lc_conf.out_rst    = 0;
+
+        // 16 bit parallel LCD mode
+        I2S1.conf2.val                      = 0;
+        I2S1.conf2.lcd_en                   = 1;
+        I2S1.sample_rate_conf.val           = 0;
+        I2S1.sample_rate_conf.tx_bits_mod   = 16;
+        I2S1.sample_rate_conf.tx_bck_div_num = I2S_TX_BCK_DIV;
+
+        I2S1.clkm_conf.val                  = 0;
+        I2S1.clkm_conf.clka_en              = 0;
+        I2S1.clkm_conf.clkm_div_num         = I2S_CLKM_DIV_NUM;
+        I2S1.clkm_conf.clkm_div_b           = I2S_CLKM_DIV_B;
+        I2S1.clkm_conf.clkm_div_a           = I2S_CLKM_DIV_A;
+
+        I2S1.fifo_conf.val                  = 0;
+        I2S1.fifo_conf.tx_fifo_mod_force_en = 1;
+        I2S1.fifo_conf.tx_fifo_mod          = 1;    // 16 bit single channel
+        I2S1.fifo_conf.tx_data_num          = 32;
+        I2S1.fifo_conf.dscr_en              = 1;
+
+        I2S1.conf1.val                      = 0;
+        I2S1.conf1.tx_stop_en               = 0;
+        I2S1.conf1.tx_pcm_bypass            = 1;
+
+        I2S1.conf_chan.val                  = 0;
+        I2S1.conf_chan.tx_chan_mod          = 1;
+        I2S1.timing.val                     = 0;
+
+        I2S1.lc_conf.val                    = 0;
+        I2S1.lc_conf.out_eof_mode           = 1;
+
+        I2S1.int_ena.val                    = 0;
+        I2S1.int_clr.val                    = 0xffffffff;
+        ESP_ERROR_CHECK (esp_intr_alloc (ETS_I2S1_INTR_SOURCE, ESP_INTR_FLAG_IRAM | ESP_INTR_FLAG_LEVEL3, i2s_intr_handler, this, &I2S_intr_handle));
+        I2S1.int_ena.out_eof                = 1;
+
+        // create a delay before starting to send data
+        LastFrameStartTime = micros ();
+        HasBeenInitialized = true;
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return HasBeenInitialized;
+
+} // Begin
+
+//----------------------------------------------------------------------------
+/*
+    Release the peripheral once the last lane is gone
+*/
+void c_OutputI2s::End ()
+{
+    // DEBUG_START;
+
+    if (HasBeenInitialized)
+    {
+        I2S1.int_ena.val = 0;
+        StopDma ();
+        esp_intr_free (I2S_intr_handle);
+        I2S_intr_handle = NULL;
+        periph_module_disable (PERIPH_I2S1_MODULE);
+        HasBeenInitialized = false;
+    }
+
+    for (auto & pBuffer : pDmaBuffers)
+    {
+        if (pBuffer)
+        {
+            free (pBuffer);
+            pBuffer = nullptr;
+        }
+    }
+
+    // DEBUG_END;
+} // End
+
+//----------------------------------------------------------------------------
+bool c_OutputI2s::AddLane (uint32_t LaneId, gpio_num_t DataPin, c_OutputPixel * pPixelDataSource)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        if ((LaneId >= I2S_MAX_NUM_LANES) || (nullptr == pPixelDataSource))
+        {
+            logcon (String (F ("Invalid I2S lane: ")) + String (LaneId));
+            break;
+        }
+
+        if (!Begin ())
+        {
+            break;
+        }
+
+        // keep the ISR away from the lane while it changes
+        I2S1.int_ena.out_eof = 0;
+        StopDma ();
+
+        Lane_t & Lane = Lanes[LaneId];
+        if ((gpio_num_t (-1) != Lane.DataPin) && (DataPin != Lane.DataPin))
+        {
+            // give the old pin back
+            gpio_matrix_out (Lane.DataPin, SIG_GPIO_OUT_IDX, false, false);
+        }
+
+        Lane.pPixelDataSource = pPixelDataSource;
+        Lane.DataPin          = DataPin;
+        ActiveLaneMask       |= uint16_t (1 << LaneId);
+
+        if (gpio_num_t (-1) != DataPin)
+        {
+            pinMode (DataPin, OUTPUT);
+            digitalWrite (DataPin, LOW);
+            gpio_matrix_out (DataPin, I2S_LANE_SIGNAL_IDX (LaneId), false, false);
+        }
+
+        UpdateFrameMinDuration ();
+        I2S1.int_ena.out_eof = 1;
+        Response = true;
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return Response;
+
+} // AddLane
+
+//----------------------------------------------------------------------------
+void c_OutputI2s::RemoveLane (uint32_t LaneId)
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if ((LaneId >= I2S_MAX_NUM_LANES) || (nullptr == Lanes[LaneId].pPixelDataSource))
+        {
+            break;
+        }
+
+        // the ISR may be reading from this lane
+        I2S1.int_ena.out_eof = 0;
+        StopDma ();
+
+        Lane_t & Lane = Lanes[LaneId];
+        if (gpio_num_t (-1) != Lane.DataPin)
+        {
+            gpio_matrix_out (Lane.DataPin, SIG_GPIO_OUT_IDX, false, false);
+            digitalWrite (Lane.DataPin, LOW);
+        }
+
+        Lane = Lane_t ();
+        ActiveLaneMask &= ~uint16_t (1 << LaneId);
+
+        if (0 == ActiveLaneMask)
+        {
+            End ();
+            break;
+        }
+
+        UpdateFrameMinDuration ();
+        I2S1.int_ena.out_eof = 1;
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // RemoveLane
+
+//----------------------------------------------------------------------------
+void c_OutputI2s::SetMinFrameDurationInUs (uint32_t LaneId, uint32_t value)
+{
+    // DEBUG_START;
+
+    if (LaneId < I2S_MAX_NUM_LANES)
+    {
+        Lanes[LaneId].FrameMinDurationInMicroSec = value;
+        UpdateFrameMinDuration ();
+    }
+
+    // DEBUG_END;
+
+} // SetMinFrameDurationInUs
+
+//----------------------------------------------------------------------------
+/*
+    All of the lanes are sent together so the longest lane sets the frame rate
+*/
+void c_OutputI2s::UpdateFrameMinDuration ()
+{
+    // DEBUG_START;
+
+    FrameMinDurationInMicroSec = 0;
+    for (auto & Lane : Lanes)
+    {
+        if (nullptr != Lane.pPixelDataSource)
+        {
+            FrameMinDurationInMicroSec = max (FrameMinDurationInMicroSec, Lane.FrameMinDurationInMicroSec);
+        }
+    }
+
+    // DEBUG_END;
+
+} // UpdateFrameMinDuration
+
+//----------------------------------------------------------------------------
+inline void IRAM_ATTR c_OutputI2s::StopDma ()
+{
+    I2S1.conf.tx_start   = 0;
+    I2S1.out_link.stop   = 1;
+    I2S1.out_link.start  = 0;
+    FrameInProgress      = false;
+
+} // StopDma
+
+//----------------------------------------------------------------------------
+/*
+    Pull the next block of intensities from every lane, transpose them into
+    bit planes and expand the planes into I2S samples.
+
+    returns false if none of the lanes had any data left. The buffer is then
+    filled with low output.
+*/
+inline bool IRAM_ATTR c_OutputI2s::FillDmaBuffer (uint16_t * pBuffer)
+{
+    uint32_t LaneCounts[I2S_MAX_NUM_LANES];
+    uint32_t MaxCount = 0;
+
+    for (uint32_t LaneId = 0; LaneId < I2S_MAX_NUM_LANES; ++LaneId)
+    {
+        c_OutputPixel * pPixelDataSource = Lanes[LaneId].pPixelDataSource;
+        LaneCounts[LaneId] = 0;
+        if ((nullptr != pPixelDataSource) && pPixelDataSource->ISR_MoreDataToSend ())
+        {
+            LaneCounts[LaneId] = pPixelDataSource->ISR_GetNextIntensities (&LaneData[LaneId][0], I2S_INTENSITIES_PER_BUFFER);
+            MaxCount = max (MaxCount, LaneCounts[LaneId]);
+        }
+    }
+
+    if (0 == MaxCount)
+    {
+        memset (pBuffer, 0x00, I2S_WORDS_PER_BUFFER * sizeof (uint16_t));
+        return false;
+    }
+
+    uint8_t  LaneBytes[I2S_MAX_NUM_LANES];
+    uint16_t Planes[I2S_BITS_PER_INTENSITY];
+
+    for (uint32_t IntensityIndex = 0; IntensityIndex < I2S_INTENSITIES_PER_BUFFER; ++IntensityIndex)
+    {
+        // lanes that have run out of data stay low
+        uint16_t ActiveLanes = 0;
+        for (uint32_t LaneId = 0; LaneId < I2S_MAX_NUM_LANES; ++LaneId)
+        {
+            if (IntensityIndex < LaneCounts[LaneId])
+            {
+                ActiveLanes |= uint16_t (1 << LaneId);
+                LaneBytes[LaneId] = LaneData[LaneId][IntensityIndex];
+            }
+            else
+            {
+                LaneBytes[LaneId] = 0;
+            }
+        }
+
+        I2sTranspose16x8 (LaneBytes, Planes);
+        I2sEncodeIntensity (Planes, ActiveLanes, &pBuffer[IntensityIndex * I2S_WORDS_PER_INTENSITY]);
+    }
+
+    return true;
+
+} // FillDmaBuffer
+
+//----------------------------------------------------------------------------
+void IRAM_ATTR c_OutputI2s::ISR_Handler ()
+{
+    uint32_t InterruptStatus = I2S1.int_st.val;
+    I2S1.int_clr.val = InterruptStatus;
+
+    do // once
+    {
+        if (0 == (InterruptStatus & I2S_OUT_EOF_INT_ST))
+        {
+            break;
+        }
+
+        if (!FrameInProgress)
+        {
+            break;
+        }
+
+        uint32_t BufferId = (I2S1.out_eof_des_addr == uint32_t (&DmaDescriptors[0])) ? 0 : 1;
+        if (DmaBufferIsIdle[BufferId])
+        {
+            // a full buffer of low output has gone out. That is the reset time.
+            StopDma ();
+            break;
+        }
+
+        // the DMA has moved on to the other buffer. Refill this one.
+        DmaBufferIsIdle[BufferId] = !FillDmaBuffer (pDmaBuffers[BufferId]);
+
+    } while (false);
+
+} // ISR_Handler
+
+//----------------------------------------------------------------------------
+bool c_OutputI2s::Render ()
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        if (!HasBeenInitialized)
+        {
+            break;
+        }
+
+        uint32_t Now = micros ();
+        uint32_t FrameDeltaTimeMicroSeconds = Now - LastFrameStartTime;
+
+        if (FrameInProgress)
+        {
+            if (FrameDeltaTimeMicroSeconds <= (FrameMinDurationInMicroSec * 3))
+            {
+                break;
+            }
+
+            // DEBUG_V ("Frame is stuck");
+            StuckFrameCount++;
+            StopDma ();
+        }
+
+        if (FrameDeltaTimeMicroSeconds < FrameMinDurationInMicroSec)
+        {
+            break;
+        }
+        LastFrameStartTime = Now;
+
+        // The lanes share one waveform. Only skip the frame if none of them changed.
+        bool AllLanesAreUnchanged = true;
+        for (auto & Lane : Lanes)
+        {
+            if ((nullptr != Lane.pPixelDataSource) && !Lane.pPixelDataSource->FrameIsUnchanged ())
+            {
+                AllLanesAreUnchanged = false;
+                break;
+            }
+        }
+
+        if (AllLanesAreUnchanged)
+        {
+            for (auto & Lane : Lanes)
+            {
+                if (nullptr != Lane.pPixelDataSource)
+                {
+                    Lane.pPixelDataSource->SkipUnchangedFrame ();
+                }
+            }
+            // DEBUG_V ("Nothing changed");
+            break;
+        }
+
+        // every lane starts a new frame at the same time
+        for (auto & Lane : Lanes)
+        {
+            if (nullptr != Lane.pPixelDataSource)
+            {
+                Lane.pPixelDataSource->StartNewFrame ();
+            }
+        }
+
+        for (uint32_t BufferId = 0; BufferId < I2S_NUM_DMA_BUFFERS; ++BufferId)
+        {
+            DmaBufferIsIdle[BufferId] = !FillDmaBuffer (pDmaBuffers[BufferId]);
+        }
+
+        I2S1.conf.tx_reset      = 1;
+        I2S1.conf.tx_reset      = 0;
+        I2S1.conf.tx_fifo_reset = 1;
+        I2S1.conf.tx_fifo_reset = 0;
+        I2S1.lc_conf.out_rst    = 1;
+        I2S1.lc_conf.out_rst    = 0;
+        I2S1.int_clr.val        = 0xffffffff;
+
+        FrameInProgress         = true;
+        I2S1.out_link.addr      = uint32_t (&DmaDescriptors[0]);
+        I2S1.out_link.start     = 1;
+        I2S1.conf.tx_start      = 1;
+        Response = true;
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return Response;
+
+} // Render
+
+//----------------------------------------------------------------------------
+void c_OutputI2s::GetStatus (ArduinoJson::JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+    jsonStatus[F ("I2sLanes")]       = ActiveLaneMask;
+    jsonStatus[F ("I2sStuckFrames")] = StuckFrameCount;
+
+    // DEBUG_END;
+} // GetStatus
+
+#endif // defined(SUPPORT_I2S_OUTPUT) && defined(ARDUINO_ARCH_ESP32)
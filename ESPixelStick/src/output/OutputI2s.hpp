@@ -0,0 +1,87 @@
+#pragma once
+/*
+* OutputI2s.hpp - I2S parallel output driver code for ESPixelStick
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Drives up to 16 WS2811 style strings in parallel using the I2S1
+*   peripheral in LCD mode with DMA. Each string (lane) is an output port
+*   with its own c_OutputPixel data source. All of the lanes share the one
+*   peripheral and start their frames together.
+*
+*   A platform enables this by defining SUPPORT_I2S_OUTPUT and one
+*   DEFAULT_I2S_<n>_GPIO per lane.
+*
+*/
+#include "../ESPixelStick.h"
+#if defined(SUPPORT_I2S_OUTPUT) && defined(ARDUINO_ARCH_ESP32)
+
+#include "OutputPixel.hpp"
+#include "OutputI2sTranspose.hpp"
+#include <esp32/rom/lldesc.h>
+#include <esp_intr_alloc.h>
+
+class c_OutputI2s
+{
+public:
+    c_OutputI2s ();
+    virtual ~c_OutputI2s ();
+
+#define I2S_MAX_NUM_LANES           16
+#define I2S_INTENSITIES_PER_BUFFER  32  ///< per lane. One buffer of idle output (320 us) is the reset time
+#define I2S_WORDS_PER_BUFFER        (I2S_INTENSITIES_PER_BUFFER * I2S_WORDS_PER_INTENSITY)
+#define I2S_NUM_DMA_BUFFERS         2
+
+    bool AddLane                 (uint32_t LaneId, gpio_num_t DataPin, c_OutputPixel * pPixelDataSource);
+    void RemoveLane              (uint32_t LaneId);
+    bool Render                  ();
+    void GetStatus               (ArduinoJson::JsonObject & jsonStatus);
+    void SetMinFrameDurationInUs (uint32_t LaneId, uint32_t value);
+
+    void IRAM_ATTR ISR_Handler ();
+
+private:
+    struct Lane_t
+    {
+        c_OutputPixel * pPixelDataSource            = nullptr;
+        gpio_num_t      DataPin                     = gpio_num_t (-1);
+        uint32_t        FrameMinDurationInMicroSec  = 0;
+    };
+    Lane_t              Lanes[I2S_MAX_NUM_LANES];
+    uint16_t            ActiveLaneMask              = 0;    ///< Lanes with a data source
+
+    uint8_t             LaneData[I2S_MAX_NUM_LANES][I2S_INTENSITIES_PER_BUFFER];
+    uint16_t          * pDmaBuffers[I2S_NUM_DMA_BUFFERS];
+    lldesc_t            DmaDescriptors[I2S_NUM_DMA_BUFFERS];
+    volatile bool       DmaBufferIsIdle[I2S_NUM_DMA_BUFFERS];
+    intr_handle_t       I2S_intr_handle             = NULL;
+
+    bool                HasBeenInitialized          = false;
+    volatile bool       FrameInProgress             = false;
+    uint32_t            LastFrameStartTime          = 0;
+    uint32_t            FrameMinDurationInMicroSec  = 25000;
+    uint32_t            StuckFrameCount             = 0;
+
+    bool                Begin ();
+    void                End ();
+    void                UpdateFrameMinDuration ();
+    inline void         IRAM_ATTR StopDma ();
+    inline bool         IRAM_ATTR FillDmaBuffer (uint16_t * pBuffer);
+
+}; // c_OutputI2s
+
+extern c_OutputI2s OutputI2s;
+
+#endif // defined(SUPPORT_I2S_OUTPUT) && defined(ARDUINO_ARCH_ESP32)
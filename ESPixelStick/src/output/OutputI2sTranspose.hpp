@@ -0,0 +1,117 @@
+#pragma once
+/*
+* OutputI2sTranspose.hpp - Bit transpose and waveform helpers for the I2S parallel output
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   These functions only depend on the standard integer types so that they
+*   can be built and checked on a host as well as on the target.
+*
+*/
+
+#include <stdint.h>
+
+#ifndef IRAM_ATTR
+#   define IRAM_ATTR
+#endif // ndef IRAM_ATTR
+
+// Samples on the wire for each data bit: start (high), data, data, low, low
+#define I2S_SAMPLES_PER_BIT         5
+#define I2S_BITS_PER_INTENSITY      8
+#define I2S_WORDS_PER_INTENSITY     (I2S_BITS_PER_INTENSITY * I2S_SAMPLES_PER_BIT)
+
+//----------------------------------------------------------------------------
+/*
+    Transpose 8 lanes of one byte each into 8 bit planes.
+
+    x holds lanes 7 to 4 (lane 7 in the top byte) and y holds lanes 3 to 0.
+    On return Planes[n] holds bit (7 - n) of every lane with lane L in bit L.
+    The MSB of each intensity is sent first so Planes[0] goes out first.
+*/
+inline void IRAM_ATTR I2sTranspose8x8 (uint32_t x, uint32_t y, uint8_t * Planes)
+{
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    Planes[0] = uint8_t (x >> 24);
+    Planes[1] = uint8_t (x >> 16);
+    Planes[2] = uint8_t (x >>  8);
+    Planes[3] = uint8_t (x);
+    Planes[4] = uint8_t (y >> 24);
+    Planes[5] = uint8_t (y >> 16);
+    Planes[6] = uint8_t (y >>  8);
+    Planes[7] = uint8_t (y);
+
+} // I2sTranspose8x8
+
+//----------------------------------------------------------------------------
+/*
+    Transpose one intensity byte from each of 16 lanes into 8 16 bit words.
+    Bit L of Planes[n] is bit (7 - n) of LaneBytes[L].
+*/
+inline void IRAM_ATTR I2sTranspose16x8 (const uint8_t * LaneBytes, uint16_t * Planes)
+{
+    uint8_t LowPlanes[I2S_BITS_PER_INTENSITY];
+    uint8_t HighPlanes[I2S_BITS_PER_INTENSITY];
+
+    I2sTranspose8x8 ((uint32_t (LaneBytes[7])  << 24) | (uint32_t (LaneBytes[6])  << 16) | (uint32_t (LaneBytes[5])  << 8) | uint32_t (LaneBytes[4]),
+                     (uint32_t (LaneBytes[3])  << 24) | (uint32_t (LaneBytes[2])  << 16) | (uint32_t (LaneBytes[1])  << 8) | uint32_t (LaneBytes[0]),
+                     LowPlanes);
+    I2sTranspose8x8 ((uint32_t (LaneBytes[15]) << 24) | (uint32_t (LaneBytes[14]) << 16) | (uint32_t (LaneBytes[13]) << 8) | uint32_t (LaneBytes[12]),
+                     (uint32_t (LaneBytes[11]) << 24) | (uint32_t (LaneBytes[10]) << 16) | (uint32_t (LaneBytes[9])  << 8) | uint32_t (LaneBytes[8]),
+                     HighPlanes);
+
+    for (uint32_t PlaneId = 0; PlaneId < I2S_BITS_PER_INTENSITY; ++PlaneId)
+    {
+        Planes[PlaneId] = uint16_t (LowPlanes[PlaneId]) | (uint16_t (HighPlanes[PlaneId]) << 8);
+    }
+
+} // I2sTranspose16x8
+
+//----------------------------------------------------------------------------
+/*
+    Build the I2S samples for one intensity on every lane. Each bit is a
+    high start sample, two data samples and two low samples. At 4 MHz a
+    zero is 250 ns high and a one is 750 ns high in a 1.25 us bit. That is
+    inside both the WS2811 (fast mode) and the WS2812B T0H / T1H windows.
+
+    Lanes that are not in ActiveLanes stay low. The ESP32 sends the two 16
+    bit halves of each 32 bit DMA word in swapped order so the sample index
+    is flipped in its lowest bit. I2S_WORDS_PER_INTENSITY is even so that
+    works across the odd number of samples per bit. pTarget receives
+    I2S_WORDS_PER_INTENSITY words.
+*/
+inline void IRAM_ATTR I2sEncodeIntensity (const uint16_t * Planes, uint16_t ActiveLanes, uint16_t * pTarget)
+{
+    for (uint32_t PlaneId = 0; PlaneId < I2S_BITS_PER_INTENSITY; ++PlaneId)
+    {
+        uint32_t SampleIndex = PlaneId * I2S_SAMPLES_PER_BIT;
+        pTarget[(SampleIndex + 0) ^ 1] = ActiveLanes;
+        pTarget[(SampleIndex + 1) ^ 1] = Planes[PlaneId] & ActiveLanes;
+        pTarget[(SampleIndex + 2) ^ 1] = Planes[PlaneId] & ActiveLanes;
+        pTarget[(SampleIndex + 3) ^ 1] = 0;
+        pTarget[(SampleIndex + 4) ^ 1] = 0;
+    }
+
+} // I2sEncodeIntensity
@@ -23,6 +23,13 @@
 
 #include "../ESPixelStick.h"
 #include "../FileMgr.hpp"
+#include <new>
+
+#ifdef ARDUINO_ARCH_ESP32
+#   include <esp_heap_caps.h>
+#   include <esp_task.h>
+#   include "OutputRmt.hpp"
+#endif // def ARDUINO_ARCH_ESP32
 
 //-----------------------------------------------------------------------------
 // bring in driver definitions
@@ -41,6 +48,7 @@
 #include "OutputWS2801Spi.hpp"
 #include "OutputWS2811Rmt.hpp"
 #include "OutputWS2811Uart.hpp"
+#include "OutputWS2811I2s.hpp"
 #include "OutputGS8208Uart.hpp"
 #include "OutputGS8208Rmt.hpp"
 #include "OutputUCS8903Uart.hpp"
@@ -171,6 +179,71 @@ static const OutputChannelIdToGpioAndPortEntry_t OutputChannelIdToGpioAndPort[]
     {DEFAULT_RMT_7_GPIO, uart_port_t(7), c_OutputMgr::OM_PortType_t::Rmt},
 #endif // def DEFAULT_RMT_7_GPIO
 
+    // I2S parallel lanes
+#ifdef DEFAULT_I2S_0_GPIO
+    {DEFAULT_I2S_0_GPIO, uart_port_t(0), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_0_GPIO
+
+#ifdef DEFAULT_I2S_1_GPIO
+    {DEFAULT_I2S_1_GPIO, uart_port_t(1), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_1_GPIO
+
+#ifdef DEFAULT_I2S_2_GPIO
+    {DEFAULT_I2S_2_GPIO, uart_port_t(2), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_2_GPIO
+
+#ifdef DEFAULT_I2S_3_GPIO
+    {DEFAULT_I2S_3_GPIO, uart_port_t(3), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_3_GPIO
+
+#ifdef DEFAULT_I2S_4_GPIO
+    {DEFAULT_I2S_4_GPIO, uart_port_t(4), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_4_GPIO
+
+#ifdef DEFAULT_I2S_5_GPIO
+    {DEFAULT_I2S_5_GPIO, uart_port_t(5), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_5_GPIO
+
+#ifdef DEFAULT_I2S_6_GPIO
+    {DEFAULT_I2S_6_GPIO, uart_port_t(6), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_6_GPIO
+
+#ifdef DEFAULT_I2S_7_GPIO
+    {DEFAULT_I2S_7_GPIO, uart_port_t(7), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_7_GPIO
+
+#ifdef DEFAULT_I2S_8_GPIO
+    {DEFAULT_I2S_8_GPIO, uart_port_t(8), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_8_GPIO
+
+#ifdef DEFAULT_I2S_9_GPIO
+    {DEFAULT_I2S_9_GPIO, uart_port_t(9), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_9_GPIO
+
+#ifdef DEFAULT_I2S_10_GPIO
+    {DEFAULT_I2S_10_GPIO, uart_port_t(10), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_10_GPIO
+
+#ifdef DEFAULT_I2S_11_GPIO
+    {DEFAULT_I2S_11_GPIO, uart_port_t(11), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_11_GPIO
+
+#ifdef DEFAULT_I2S_12_GPIO
+    {DEFAULT_I2S_12_GPIO, uart_port_t(12), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_12_GPIO
+
+#ifdef DEFAULT_I2S_13_GPIO
+    {DEFAULT_I2S_13_GPIO, uart_port_t(13), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_13_GPIO
+
+#ifdef DEFAULT_I2S_14_GPIO
+    {DEFAULT_I2S_14_GPIO, uart_port_t(14), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_14_GPIO
+
+#ifdef DEFAULT_I2S_15_GPIO
+    {DEFAULT_I2S_15_GPIO, uart_port_t(15), c_OutputMgr::OM_PortType_t::I2s},
+#endif // def DEFAULT_I2S_15_GPIO
+
 #ifdef SUPPORT_SPI_OUTPUT
     {DEFAULT_SPI_DATA_GPIO, uart_port_t(-1), c_OutputMgr::OM_PortType_t::Spi},
 #endif
@@ -181,6 +254,33 @@ static const OutputChannelIdToGpioAndPortEntry_t OutputChannelIdToGpioAndPort[]
 
 };
 
+#ifdef ARDUINO_ARCH_ESP32
+//-----------------------------------------------------------------------------
+static void RenderTimerCallback (void * pvParameters)
+{
+    // runs in the esp_timer task. Wake up the render task.
+    xTaskNotifyGive (*reinterpret_cast<TaskHandle_t *> (pvParameters));
+
+} // RenderTimerCallback
+
+//-----------------------------------------------------------------------------
+static void RenderTask (void * pvParameters)
+{
+    // DEBUG_START;
+    c_OutputMgr * pOutputMgr = reinterpret_cast<c_OutputMgr *> (pvParameters);
+
+    do
+    {
+        // wait for the timer
+        ulTaskNotifyTake (pdTRUE, portMAX_DELAY);
+        pOutputMgr->RenderDrivers ();
+
+    } while (true);
+    // DEBUG_END;
+
+} // RenderTask
+#endif // def ARDUINO_ARCH_ESP32
+
 //-----------------------------------------------------------------------------
 // Methods
 //-----------------------------------------------------------------------------
@@ -192,6 +292,17 @@ c_OutputMgr::c_OutputMgr ()
     // clear the input data buffer
     memset ((char*)&OutputBuffer[0], 0, sizeof (OutputBuffer));
 
+    for (auto & CurrentGammaTable : GammaTables)
+    {
+        CurrentGammaTable = nullptr;
+    }
+
+    for (uint32_t i = 0; i < sizeof (IdentityGammaTable.Forward); ++i)
+    {
+        IdentityGammaTable.Forward[i] = uint8_t (i);
+        IdentityGammaTable.Inverse[i] = uint8_t (i);
+    }
+
 } // c_OutputMgr
 
 //-----------------------------------------------------------------------------
@@ -200,12 +311,32 @@ c_OutputMgr::~c_OutputMgr()
 {
     // DEBUG_START;
 
+#ifdef ARDUINO_ARCH_ESP32
+    // do not delete the render task while it holds the lock
+    LockDrivers ();
+    UseRenderTask = false;
+    UpdateRenderTask ();
+    UnlockDrivers ();
+#endif // def ARDUINO_ARCH_ESP32
+
     // delete pOutputInstances;
     for (DriverInfo_t & CurrentOutput : OutputChannelDrivers)
     {
         // the drivers will put the hardware in a safe state
         delete CurrentOutput.pOutputChannelDriver;
     }
+
+    for (auto & CurrentGammaTable : GammaTables)
+    {
+        delete CurrentGammaTable;
+        CurrentGammaTable = nullptr;
+    }
+
+    if (pFrameBuffer)
+    {
+        free (pFrameBuffer);
+        pFrameBuffer = nullptr;
+    }
     // DEBUG_END;
 
 } // ~c_OutputMgr
@@ -236,6 +367,11 @@ void c_OutputMgr::Begin ()
 
         HasBeenInitialized = true;
 
+#ifdef ARDUINO_ARCH_ESP32
+        // recursive so that a locked config load can call the locked helpers
+        DriverLock = xSemaphoreCreateRecursiveMutex ();
+#endif // def ARDUINO_ARCH_ESP32
+
 #ifdef LED_FLASH_GPIO
         pinMode (LED_FLASH_GPIO, OUTPUT);
         digitalWrite (LED_FLASH_GPIO, LED_FLASH_OFF);
@@ -271,6 +407,11 @@ void c_OutputMgr::CreateJsonConfig (JsonObject& jsonConfig)
     // PrettyPrint (jsonConfig, String ("jsonConfig"));
 
     // add OM config parameters
+    jsonConfig[CN_doublebuffer] = UseDoubleBuffer;
+#ifdef ARDUINO_ARCH_ESP32
+    jsonConfig[CN_rendertask] = UseRenderTask;
+    jsonConfig[CN_syncstart]  = UseSyncStart;
+#endif // def ARDUINO_ARCH_ESP32
     // DEBUG_V ();
 
     // add the channels header
@@ -289,6 +430,7 @@ void c_OutputMgr::CreateJsonConfig (JsonObject& jsonConfig)
 
     // add the channel configurations
     // DEBUG_V ("For Each Output Channel");
+    LockDrivers ();
     for (auto & CurrentChannel : OutputChannelDrivers)
     {
         // DEBUG_V (String("Create Section in Config file for the output channel: '") + CurrentChannel.pOutputChannelDriver->GetOutputChannelId() + "'");
@@ -348,6 +490,7 @@ void c_OutputMgr::CreateJsonConfig (JsonObject& jsonConfig)
         // DEBUG_V ();
 
     } // for each output channel
+    UnlockDrivers ();
 
     // DEBUG_V ();
     // PrettyPrint (jsonConfig, String ("jsonConfig"));
@@ -467,6 +610,8 @@ void c_OutputMgr::GetStatus (JsonObject & jsonStatus)
 {
     // DEBUG_START;
 
+    LockDrivers ();
+
     JsonArray OutputStatus = jsonStatus.createNestedArray (CN_output);
     for (auto & CurrentOutput : OutputChannelDrivers)
     {
@@ -476,6 +621,8 @@ void c_OutputMgr::GetStatus (JsonObject & jsonStatus)
         // DEBUG_V ();
     }
 
+    UnlockDrivers ();
+
     // DEBUG_END;
 } // GetStatus
 
@@ -748,6 +895,17 @@ void c_OutputMgr::InstantiateNewOutputChannel(DriverInfo_t & CurrentOutputChanne
                 }
                 #endif // defined(ARDUINO_ARCH_ESP32)
 
+                #if defined(SUPPORT_I2S_OUTPUT) && defined(ARDUINO_ARCH_ESP32)
+                if (OM_IS_I2S)
+                {
+                    // DEBUG_V ("I2S");
+                    // logcon (CN_stars + String (F (" Starting WS2811 I2S for channel '")) + CurrentOutputChannelDriver.DriverId + "'. " + CN_stars);
+                    CurrentOutputChannelDriver.pOutputChannelDriver = new c_OutputWS2811I2s(CurrentOutputChannelDriver.DriverId, CurrentOutputChannelDriver.GpioPin,  CurrentOutputChannelDriver.PortId, OutputType_WS2811);
+                    // DEBUG_V ();
+                    break;
+                }
+                #endif // defined(SUPPORT_I2S_OUTPUT) && defined(ARDUINO_ARCH_ESP32)
+
                 if (!BuildingNewConfig)
                 {
                     logcon(CN_stars + String(F(" Cannot Start WS2811 for channel '")) + CurrentOutputChannelDriver.DriverId + "'. " + CN_stars);
@@ -1041,6 +1199,13 @@ bool c_OutputMgr::ProcessJsonConfig (JsonObject& jsonConfig)
             // break;
         }
 
+        setFromJSON (UseDoubleBuffer, OutputChannelMgrData, CN_doublebuffer);
+#ifdef ARDUINO_ARCH_ESP32
+        setFromJSON (UseRenderTask, OutputChannelMgrData, CN_rendertask);
+        setFromJSON (UseSyncStart, OutputChannelMgrData, CN_syncstart);
+        c_OutputRmt::SetSynchronizedStart (UseSyncStart);
+#endif // def ARDUINO_ARCH_ESP32
+
         // do we have a channel configuration array?
         if (false == OutputChannelMgrData.containsKey (CN_channels))
         {
@@ -1127,6 +1292,10 @@ bool c_OutputMgr::ProcessJsonConfig (JsonObject& jsonConfig)
 
     SetSerialUart();
 
+#ifdef ARDUINO_ARCH_ESP32
+    UpdateRenderTask ();
+#endif // def ARDUINO_ARCH_ESP32
+
     // DEBUG_END;
     return Response;
 
@@ -1244,19 +1413,154 @@ void c_OutputMgr::Render()
     if (true == ConfigLoadNeeded)
     {
         ConfigLoadNeeded = false;
+        // the drivers may get replaced. Keep the render task out of them.
+        LockDrivers ();
         LoadConfig ();
+        UnlockDrivers ();
     } // done need to save the current config
 
+#ifdef ARDUINO_ARCH_ESP32
+    // the render task takes care of the drivers
+    if (NULL == RenderTaskHandle)
+#endif // def ARDUINO_ARCH_ESP32
+    {
+        RenderDrivers ();
+    }
+    // DEBUG_END;
+} // render
+
+//-----------------------------------------------------------------------------
+void c_OutputMgr::RenderDrivers ()
+{
+    // DEBUG_START;
+
+    LockDrivers ();
+
+    PassFrameStarted = false;
+
     if (false == IsOutputPaused)
     {
-        // DEBUG_START;
         for (DriverInfo_t & OutputChannel : OutputChannelDrivers)
         {
             OutputChannel.pOutputChannelDriver->Render ();
         }
     }
+
+#ifdef ARDUINO_ARCH_ESP32
+    // start the RMT channels that were armed above
+    c_OutputRmt::StartArmedChannels ();
+#endif // def ARDUINO_ARCH_ESP32
+    UnlockDrivers ();
+
+    // one entry per render pass no matter how many drivers started a frame
+    if (PassFrameStarted)
+    {
+        FrameStartTimes[FrameStartCount & (OM_FRAME_START_HISTORY_SIZE - 1)] = PassFrameStartTime;
+        FrameStartCount = FrameStartCount + 1;
+    }
+
     // DEBUG_END;
-} // render
+} // RenderDrivers
+
+#ifdef ARDUINO_ARCH_ESP32
+//-----------------------------------------------------------------------------
+/*
+    Start, stop or retime the render task. Each driver decides for itself
+    if it is time to start a new frame, so the timer ticks several times per
+    shortest frame time. A tick at the frame time would race the check in
+    the driver and could skip every other frame.
+*/
+void c_OutputMgr::UpdateRenderTask ()
+{
+    // DEBUG_START;
+
+    uint32_t NewPeriodInMicroSec = 0;
+    if (UseRenderTask)
+    {
+        NewPeriodInMicroSec = uint32_t (-1);
+        for (auto & OutputChannel : OutputChannelDrivers)
+        {
+            if (nullptr != OutputChannel.pOutputChannelDriver)
+            {
+                NewPeriodInMicroSec = min (NewPeriodInMicroSec, OutputChannel.pOutputChannelDriver->GetFrameMinDurationInMicroSec ());
+            }
+        }
+        NewPeriodInMicroSec = NewPeriodInMicroSec / OM_RENDER_TASK_TICKS_PER_FRAME;
+        NewPeriodInMicroSec = min (NewPeriodInMicroSec, uint32_t (OM_RENDER_TASK_MAX_PERIOD_US));
+        NewPeriodInMicroSec = max (NewPeriodInMicroSec, uint32_t (OM_RENDER_TASK_MIN_PERIOD_US));
+    }
+
+    do // once
+    {
+        if (NewPeriodInMicroSec == RenderTimerPeriodInMicroSec)
+        {
+            // DEBUG_V ("Nothing changed");
+            break;
+        }
+
+        if (nullptr != RenderTimerHandle)
+        {
+            esp_timer_stop (RenderTimerHandle);
+        }
+        RenderTimerPeriodInMicroSec = 0;
+
+        if (0 == NewPeriodInMicroSec)
+        {
+            // back to rendering from loop()
+            if (nullptr != RenderTimerHandle)
+            {
+                esp_timer_delete (RenderTimerHandle);
+                RenderTimerHandle = nullptr;
+            }
+
+            if (NULL != RenderTaskHandle)
+            {
+                vTaskDelete (RenderTaskHandle);
+                RenderTaskHandle = NULL;
+            }
+            logcon (F ("Outputs are rendered from the main loop"));
+            break;
+        }
+
+        if (NULL == RenderTaskHandle)
+        {
+            // run above loop() so that web and network work cannot delay a frame
+            xTaskCreatePinnedToCore (RenderTask, "OutputTask", 4096, this, ESP_TASK_PRIO_MIN + 5, &RenderTaskHandle, OM_RENDER_TASK_CORE);
+            if (NULL == RenderTaskHandle)
+            {
+                logcon (F ("Could not start the output render task"));
+                break;
+            }
+        }
+
+        if (nullptr == RenderTimerHandle)
+        {
+            esp_timer_create_args_t TimerArgs;
+            memset ((void*)&TimerArgs, 0x00, sizeof (TimerArgs));
+            TimerArgs.callback        = &RenderTimerCallback;
+            TimerArgs.arg             = (void*)&RenderTaskHandle;
+            TimerArgs.dispatch_method = ESP_TIMER_TASK;
+            TimerArgs.name            = "OutputTimer";
+            if (ESP_OK != esp_timer_create (&TimerArgs, &RenderTimerHandle))
+            {
+                logcon (F ("Could not create the output render timer"));
+                RenderTimerHandle = nullptr;
+                vTaskDelete (RenderTaskHandle);
+                RenderTaskHandle = NULL;
+                break;
+            }
+        }
+
+        esp_timer_start_periodic (RenderTimerHandle, NewPeriodInMicroSec);
+        RenderTimerPeriodInMicroSec = NewPeriodInMicroSec;
+        logcon (String (F ("Outputs are rendered by a task every ")) + String (NewPeriodInMicroSec) + F (" us"));
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // UpdateRenderTask
+#endif // def ARDUINO_ARCH_ESP32
 
 //-----------------------------------------------------------------------------
 void c_OutputMgr::UpdateDisplayBufferReferences (void)
@@ -1274,6 +1578,8 @@ void c_OutputMgr::UpdateDisplayBufferReferences (void)
     */
     uint32_t OutputBufferOffset     = 0;    // offset into the raw data in the output buffer
     uint32_t OutputChannelOffset    = 0;    // Virtual channel offset to the output buffer.
+    bool     ChannelDataIsUnchanged = true;
+    bool     HighRefreshRate        = false;
 
     // DEBUG_V (String ("        BufferSize: ") + String (sizeof(OutputBuffer)));
     // DEBUG_V (String ("OutputBufferOffset: ") + String (OutputBufferOffset));
@@ -1315,24 +1621,111 @@ void c_OutputMgr::UpdateDisplayBufferReferences (void)
         OutputChannel.OutputChannelSize      = VirtualOutputBufferDataBytesNeeded;
         OutputChannel.OutputChannelEndOffset = OutputChannelOffset;
 
+        if (!OutputChannel.pOutputChannelDriver->WritesChannelDataUnchanged () ||
+            (OutputBufferDataBytesNeeded != VirtualOutputBufferDataBytesNeeded))
+        {
+            ChannelDataIsUnchanged = false;
+        }
+
+        HighRefreshRate |= OutputChannel.pOutputChannelDriver->UsesHighRefreshRate ();
+
         // DEBUG_V (String("OutputChannel.GetBufferUsedSize: ") + String(OutputChannel.pOutputChannelDriver->GetBufferUsedSize()));
         // DEBUG_V (String ("OutputBufferOffset: ") + String(OutputBufferOffset));
     }
 
     // DEBUG_V (String ("   TotalBufferSize: ") + String (OutputBufferOffset));
     UsedBufferSize = OutputBufferOffset;
+    AllChannelDataIsUnchanged = ChannelDataIsUnchanged && (OutputBufferOffset == OutputChannelOffset);
+    AnyHighRefreshRate = HighRefreshRate;
     // DEBUG_V (String ("       OutputBuffer: 0x") + String (uint32_t (OutputBuffer), HEX));
     // DEBUG_V (String ("     UsedBufferSize: ") + String (uint32_t (UsedBufferSize)));
+    UpdateFrameBuffers ();
     InputMgr.SetBufferInfo (OutputChannelOffset);
 
     // DEBUG_END;
 
 } // UpdateDisplayBufferReferences
 
+//-----------------------------------------------------------------------------
+/*
+    In double buffer mode the inputs keep writing into OutputBuffer and each
+    driver copies its slice into the frame buffer when it starts a new frame.
+    The transmitters only ever read the frame buffer so a packet that lands
+    in the middle of a frame can no longer tear it.
+*/
+void c_OutputMgr::UpdateFrameBuffers ()
+{
+    // DEBUG_START;
+
+    uint32_t NeededSize = (UseDoubleBuffer) ? UsedBufferSize : 0;
+
+    do // once
+    {
+        if (NeededSize == FrameBufferSize)
+        {
+            // DEBUG_V ("Frame buffer does not need to change");
+            break;
+        }
+
+        // point the drivers back at the shared buffer before we touch the frame buffer
+        for (auto & OutputChannel : OutputChannelDrivers)
+        {
+            OutputChannel.pOutputChannelDriver->SetFrameBufferAddress (&OutputBuffer[OutputChannel.OutputBufferStartingOffset]);
+        }
+
+        if (pFrameBuffer)
+        {
+            free (pFrameBuffer);
+            pFrameBuffer = nullptr;
+        }
+        FrameBufferSize = 0;
+
+        if (0 == NeededSize)
+        {
+            break;
+        }
+
+#ifdef ARDUINO_ARCH_ESP32
+        // the ISRs read this buffer so it must not end up in PSRAM
+        pFrameBuffer = (uint8_t *)heap_caps_malloc (NeededSize, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#else
+        pFrameBuffer = (uint8_t *)malloc (NeededSize);
+#endif // def ARDUINO_ARCH_ESP32
+
+        if (nullptr == pFrameBuffer)
+        {
+            logcon (String (F ("--- OutputMgr: ERROR: Could not allocate the frame buffer. Double buffering is disabled.")));
+            break;
+        }
+
+        memcpy (pFrameBuffer, OutputBuffer, NeededSize);
+        FrameBufferSize = NeededSize;
+
+    } while (false);
+
+    if (pFrameBuffer)
+    {
+        for (auto & OutputChannel : OutputChannelDrivers)
+        {
+            // channels that did not fit in the output buffer stay on the shared buffer
+            if ((OutputChannel.OutputBufferStartingOffset + OutputChannel.pOutputChannelDriver->GetBufferUsedSize ()) > FrameBufferSize)
+            {
+                continue;
+            }
+            OutputChannel.pOutputChannelDriver->SetFrameBufferAddress (&pFrameBuffer[OutputChannel.OutputBufferStartingOffset]);
+        }
+    }
+
+    // DEBUG_END;
+
+} // UpdateFrameBuffers
+
 //-----------------------------------------------------------------------------
 void c_OutputMgr::PauseOutputs(bool PauseTheOutput)
 {
     // DEBUG_START;
+    LockDrivers ();
+
     IsOutputPaused = PauseTheOutput;
 
     for (auto & CurrentOutput : OutputChannelDrivers)
@@ -1340,6 +1733,8 @@ void c_OutputMgr::PauseOutputs(bool PauseTheOutput)
         CurrentOutput.pOutputChannelDriver->PauseOutput(PauseTheOutput);
     }
 
+    UnlockDrivers ();
+
     // DEBUG_END;
 } // PauseOutputs
 
@@ -1360,6 +1755,7 @@ void c_OutputMgr::WriteChannelData(uint32_t StartChannelId, uint32_t ChannelCoun
         }
 
         // DEBUG_V (String("&OutputBuffer[StartChannelId]: 0x") + String(uint(&OutputBuffer[StartChannelId]), HEX));
+        BeginInputWrite ();
         uint32_t EndChannelId = StartChannelId + ChannelCount;
         // Serial.print('1');
         for (auto & currentOutputChannelDriver : OutputChannelDrivers)
@@ -1396,6 +1792,7 @@ void c_OutputMgr::WriteChannelData(uint32_t StartChannelId, uint32_t ChannelCoun
             pSourceData += ChannelsToSet;
             // memcpy(&OutputBuffer[StartChannelId], pSourceData, ChannelCount);
         }
+        EndInputWrite ();
 
     } while (false);
     // DEBUG_END;
@@ -1462,6 +1859,9 @@ void c_OutputMgr::ClearBuffer()
 {
     // DEBUG_START;
 
+    LockDrivers ();
+    BeginInputWrite ();
+
     for (auto & currentOutputChannelDriver : OutputChannelDrivers)
     {
         if(nullptr != currentOutputChannelDriver.pOutputChannelDriver)
@@ -1470,9 +1870,231 @@ void c_OutputMgr::ClearBuffer()
         }
     }
 
+    EndInputWrite ();
+    UnlockDrivers ();
+
     // DEBUG_END;
 
 } // ClearBuffer
 
+//-----------------------------------------------------------------------------
+void c_OutputMgr::SetBufferDirty()
+{
+    // DEBUG_START;
+
+    LockDrivers ();
+
+    for (auto & currentOutputChannelDriver : OutputChannelDrivers)
+    {
+        if(nullptr != currentOutputChannelDriver.pOutputChannelDriver)
+        {
+            currentOutputChannelDriver.pOutputChannelDriver->SetBufferDirty();
+        }
+    }
+
+    UnlockDrivers ();
+
+    // DEBUG_END;
+
+} // SetBufferDirty
+
+//-----------------------------------------------------------------------------
+/*
+    Called by a driver when it latches the frame it is about to send. The
+    inputs write from another task, so the copy is retried if a write was in
+    progress at the start or finished during it. Checking the writers after
+    the copy and the generation last catches a write that started and ended
+    while the data was being copied.
+*/
+bool c_OutputMgr::CopyStableOutputData (uint8_t * pTarget, const uint8_t * pSource, uint32_t NumBytes)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    for (uint32_t Attempt = 0; Attempt < OM_LATCH_MAX_ATTEMPTS; ++Attempt)
+    {
+        uint32_t WritersBefore    = InputWritersActive;
+        uint32_t GenerationBefore = InputWriteGeneration;
+
+        memcpy (pTarget, pSource, NumBytes);
+
+        uint32_t WritersAfter    = InputWritersActive;
+        uint32_t GenerationAfter = InputWriteGeneration;
+
+        if ((0 == WritersBefore) && (0 == WritersAfter) && (GenerationBefore == GenerationAfter))
+        {
+            Response = true;
+            break;
+        }
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // CopyStableOutputData
+
+//-----------------------------------------------------------------------------
+void c_OutputMgr::ReportFrameStart (uint32_t StartTimeInMicroSec)
+{
+    // DEBUG_START;
+
+    if (!PassFrameStarted)
+    {
+        PassFrameStartTime = StartTimeInMicroSec;
+        PassFrameStarted   = true;
+    }
+
+    // DEBUG_END;
+
+} // ReportFrameStart
+
+//-----------------------------------------------------------------------------
+/*
+    Get the start time of a frame by its position in the frame start count.
+    Returns false if the frame has not started yet or is no longer in the
+    history.
+*/
+bool c_OutputMgr::GetFrameStartTime (uint32_t FrameStartId, uint32_t & StartTimeInMicroSec)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        uint32_t FramesSince = FrameStartCount - FrameStartId;
+        if ((0 == FramesSince) || (FramesSince > (OM_FRAME_START_HISTORY_SIZE - 1)))
+        {
+            break;
+        }
+
+        StartTimeInMicroSec = FrameStartTimes[FrameStartId & (OM_FRAME_START_HISTORY_SIZE - 1)];
+
+        // make sure the entry was not replaced while we were reading it
+        Response = ((FrameStartCount - FrameStartId) <= (OM_FRAME_START_HISTORY_SIZE - 1));
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return Response;
+
+} // GetFrameStartTime
+
+//-----------------------------------------------------------------------------
+/*
+    Find or build a gamma table for the requested settings. Outputs that use
+    the same gamma and brightness share a single table.
+
+    needs
+        gamma value
+        brightness (0 - 100 percent)
+    returns
+        pointer to the table. The identity table if no table could be allocated
+*/
+const c_OutputMgr::GammaTable_t * c_OutputMgr::AcquireGammaTable (float gamma, uint8_t brightness)
+{
+    // DEBUG_START;
+
+    GammaTable_t * Response = nullptr;
+    GammaTable_t ** pFreeSlot = nullptr;
+
+    do // once
+    {
+        for (auto & CurrentGammaTable : GammaTables)
+        {
+            if (nullptr == CurrentGammaTable)
+            {
+                if (nullptr == pFreeSlot)
+                {
+                    pFreeSlot = &CurrentGammaTable;
+                }
+                continue;
+            }
+
+            if ((CurrentGammaTable->gamma == gamma) && (CurrentGammaTable->brightness == brightness))
+            {
+                Response = CurrentGammaTable;
+                break;
+            }
+        }
+
+        if (nullptr != Response)
+        {
+            // DEBUG_V ("Reuse an existing table");
+            break;
+        }
+
+        if (nullptr == pFreeSlot)
+        {
+            logcon (String (F ("ERROR: No free gamma table slots")));
+            break;
+        }
+
+        Response = new (std::nothrow) GammaTable_t;
+        if (nullptr == Response)
+        {
+            logcon (String (F ("ERROR: Could not allocate a gamma table")));
+            break;
+        }
+        Response->gamma      = gamma;
+        Response->brightness = brightness;
+
+        double   tempBrightness     = double (brightness) / 100.0;
+        uint32_t AdjustedBrightness = map (brightness, 0, 100, 0, 256);
+        // DEBUG_V (String ("tempBrightness: ") + String (tempBrightness));
+        // DEBUG_V (String ("AdjustedBrightness: ") + String (AdjustedBrightness));
+
+        for (uint32_t i = 0; i < sizeof (Response->Forward); ++i)
+        {
+            uint32_t GammaCorrectedValue = (uint8_t)min ((255.0 * pow (i * tempBrightness / 255, gamma) + 0.5), 255.0);
+            Response->Forward[i] = uint8_t ((GammaCorrectedValue * AdjustedBrightness) >> 8);
+            Response->Inverse[i] = (0 == AdjustedBrightness) ? 0 : uint8_t (min ((i << 8) / AdjustedBrightness, uint32_t (255)));
+        }
+
+        *pFreeSlot = Response;
+
+    } while (false);
+
+    if (nullptr != Response)
+    {
+        Response->RefCount++;
+    }
+    else
+    {
+        // keep the output running without gamma and brightness. Never released.
+        Response = &IdentityGammaTable;
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // AcquireGammaTable
+
+//-----------------------------------------------------------------------------
+void c_OutputMgr::ReleaseGammaTable (const GammaTable_t * pGammaTable)
+{
+    // DEBUG_START;
+
+    for (auto & CurrentGammaTable : GammaTables)
+    {
+        if ((nullptr == pGammaTable) || (CurrentGammaTable != pGammaTable))
+        {
+            continue;
+        }
+
+        if (0 == --CurrentGammaTable->RefCount)
+        {
+            // DEBUG_V ("Last user is gone. Free the table");
+            delete CurrentGammaTable;
+            CurrentGammaTable = nullptr;
+        }
+        break;
+    }
+
+    // DEBUG_END;
+} // ReleaseGammaTable
+
 // create a global instance of the output channel factory
 c_OutputMgr OutputMgr;
@@ -26,6 +26,18 @@
 
 #include "../memdebug.h"
 #include "../FileMgr.hpp"
+#include <atomic>
+
+#ifdef ARDUINO_ARCH_ESP32
+#   include <esp_timer.h>
+#   include <freertos/semphr.h>
+
+    // WiFi and lwIP run on core 0. The render task runs on the other core.
+#   define OM_RENDER_TASK_CORE             1
+#   define OM_RENDER_TASK_MIN_PERIOD_US    500
+#   define OM_RENDER_TASK_MAX_PERIOD_US    1000
+#   define OM_RENDER_TASK_TICKS_PER_FRAME  4
+#endif // def ARDUINO_ARCH_ESP32
 
 class c_OutputCommon; ///< forward declaration to the pure virtual output class that will be defined later.
 
@@ -43,6 +55,7 @@ public:
 
     void      Begin             ();                        ///< set up the operating environment based on the current config (or defaults)
     void      Render            ();                        ///< Call from loop(),  renders output data
+    void      RenderDrivers     ();                        ///< Give each driver a chance to start a new frame
     void      LoadConfig        ();                        ///< Read the current configuration data from nvram
     void      GetConfig         (byte * Response, uint32_t maxlen);
     void      GetConfig         (String & Response);
@@ -59,6 +72,26 @@ public:
     void      WriteChannelData  (uint32_t StartChannelId, uint32_t ChannelCount, byte * pData);
     void      ReadChannelData   (uint32_t StartChannelId, uint32_t ChannelCount, byte *pTargetData);
     void      ClearBuffer       ();
+    void      SetBufferDirty    (); ///< Call after writing directly into the buffer returned by GetBufferAddress
+    void      BeginInputWrite   () { ++InputWritersActive; }   ///< Call before writing directly into the buffer returned by GetBufferAddress
+    void      EndInputWrite     () { ++InputWriteGeneration; --InputWritersActive; }
+    bool      CopyStableOutputData (uint8_t * pTarget, const uint8_t * pSource, uint32_t NumBytes); ///< false if an input kept writing during the copy
+    bool      ChannelDataIsUnchanged () { return AllChannelDataIsUnchanged; } ///< true if channel N is byte N of the buffer returned by GetBufferAddress
+    bool      HighRefreshRateIsEnabled () { return AnyHighRefreshRate; } ///< true if at least one output may refresh faster than 40 fps
+    void      ReportFrameStart  (uint32_t StartTimeInMicroSec); ///< Called by the drivers when they start sending a frame
+    uint32_t  GetFrameStartCount () { return FrameStartCount; }  ///< Number of render passes that started at least one frame
+    bool      GetFrameStartTime (uint32_t FrameStartId, uint32_t & StartTimeInMicroSec);
+
+    struct GammaTable_t
+    {
+        float       gamma       = 1.0;      ///< gamma value used to build the table
+        uint8_t     brightness  = 100;      ///< brightness (0 - 100 percent) used to build the table
+        uint32_t    RefCount    = 0;        ///< Number of outputs using this table
+        uint8_t     Forward[256];           ///< input intensity to gamma and brightness adjusted output intensity
+        uint8_t     Inverse[256];           ///< output intensity to input intensity with the brightness removed
+    };
+    const GammaTable_t * AcquireGammaTable (float gamma, uint8_t brightness);
+    void      ReleaseGammaTable (const GammaTable_t * pGammaTable);
 
     // handles to determine which output channel we are dealing with
     enum e_OutputChannelIds
@@ -107,6 +140,70 @@ public:
         OutputChannelId_RMT_7,
         #endif // def DEFAULT_RMT_3_GPIO
 
+        #ifdef DEFAULT_I2S_0_GPIO
+        OutputChannelId_I2S_0,
+        #endif // def DEFAULT_I2S_0_GPIO
+
+        #ifdef DEFAULT_I2S_1_GPIO
+        OutputChannelId_I2S_1,
+        #endif // def DEFAULT_I2S_1_GPIO
+
+        #ifdef DEFAULT_I2S_2_GPIO
+        OutputChannelId_I2S_2,
+        #endif // def DEFAULT_I2S_2_GPIO
+
+        #ifdef DEFAULT_I2S_3_GPIO
+        OutputChannelId_I2S_3,
+        #endif // def DEFAULT_I2S_3_GPIO
+
+        #ifdef DEFAULT_I2S_4_GPIO
+        OutputChannelId_I2S_4,
+        #endif // def DEFAULT_I2S_4_GPIO
+
+        #ifdef DEFAULT_I2S_5_GPIO
+        OutputChannelId_I2S_5,
+        #endif // def DEFAULT_I2S_5_GPIO
+
+        #ifdef DEFAULT_I2S_6_GPIO
+        OutputChannelId_I2S_6,
+        #endif // def DEFAULT_I2S_6_GPIO
+
+        #ifdef DEFAULT_I2S_7_GPIO
+        OutputChannelId_I2S_7,
+        #endif // def DEFAULT_I2S_7_GPIO
+
+        #ifdef DEFAULT_I2S_8_GPIO
+        OutputChannelId_I2S_8,
+        #endif // def DEFAULT_I2S_8_GPIO
+
+        #ifdef DEFAULT_I2S_9_GPIO
+        OutputChannelId_I2S_9,
+        #endif // def DEFAULT_I2S_9_GPIO
+
+        #ifdef DEFAULT_I2S_10_GPIO
+        OutputChannelId_I2S_10,
+        #endif // def DEFAULT_I2S_10_GPIO
+
+        #ifdef DEFAULT_I2S_11_GPIO
+        OutputChannelId_I2S_11,
+        #endif // def DEFAULT_I2S_11_GPIO
+
+        #ifdef DEFAULT_I2S_12_GPIO
+        OutputChannelId_I2S_12,
+        #endif // def DEFAULT_I2S_12_GPIO
+
+        #ifdef DEFAULT_I2S_13_GPIO
+        OutputChannelId_I2S_13,
+        #endif // def DEFAULT_I2S_13_GPIO
+
+        #ifdef DEFAULT_I2S_14_GPIO
+        OutputChannelId_I2S_14,
+        #endif // def DEFAULT_I2S_14_GPIO
+
+        #ifdef DEFAULT_I2S_15_GPIO
+        OutputChannelId_I2S_15,
+        #endif // def DEFAULT_I2S_15_GPIO
+
         #ifdef SUPPORT_SPI_OUTPUT
         OutputChannelId_SPI_1,
         #endif // def SUPPORT_SPI_OUTPUT
@@ -204,6 +301,7 @@ public:
         Rmt,
         Spi,
         Relay,
+        I2s,
     };
 
 private:
@@ -227,6 +325,10 @@ private:
     // pointer(s) to the current active output drivers
     DriverInfo_t OutputChannelDrivers[OutputChannelId_End];
 
+    // Shared gamma tables. One extra slot allows a driver to acquire its new table before releasing the old one.
+    GammaTable_t * GammaTables[OutputChannelId_End + 1];
+    GammaTable_t   IdentityGammaTable;  ///< Used when a table cannot be allocated
+
     // configuration parameter names for the channel manager within the config file
 
     bool HasBeenInitialized = false;
@@ -237,6 +339,7 @@ private:
     bool ProcessJsonConfig (JsonObject & jsonConfig);
     void CreateJsonConfig  (JsonObject & jsonConfig);
     void UpdateDisplayBufferReferences (void);
+    void UpdateFrameBuffers ();
     void InstantiateNewOutputChannel(DriverInfo_t &ChannelIndex, e_OutputType NewChannelType, bool StartDriver = true);
     void CreateNewConfig();
     void SetSerialUart();
@@ -245,12 +348,50 @@ private:
 
     uint8_t OutputBuffer[OM_MAX_NUM_CHANNELS];
     uint32_t  UsedBufferSize = 0;
+    bool      AllChannelDataIsUnchanged = false; ///< No driver maps or modifies the channel data it is given
+
+    // Lets a driver that latches its frame see an input write that overlaps the copy
+#define OM_LATCH_MAX_ATTEMPTS 4
+    std::atomic<uint32_t> InputWritersActive   {0};
+    std::atomic<uint32_t> InputWriteGeneration {0};   ///< Bumped at the end of every input write
+    bool      AnyHighRefreshRate = false;
+
+    // Optional second buffer. The drivers send from here while the inputs fill OutputBuffer.
+    bool      UseDoubleBuffer = false;
+    uint8_t * pFrameBuffer    = nullptr;
+    uint32_t  FrameBufferSize = 0;
+
+    // Recent frame start times. Used by the inputs to measure the time from packet receipt to output.
+#define OM_FRAME_START_HISTORY_SIZE 8   ///< Must be a power of two
+    volatile uint32_t FrameStartCount    = 0;
+    uint32_t  FrameStartTimes[OM_FRAME_START_HISTORY_SIZE];
+    uint32_t  PassFrameStartTime         = 0;     ///< First frame start seen in the current render pass
+    bool      PassFrameStarted           = false;
+
+#ifdef ARDUINO_ARCH_ESP32
+    // Optional task that renders the outputs on a timer instead of from loop()
+    bool                UseRenderTask               = false;
+    TaskHandle_t        RenderTaskHandle            = NULL;
+    esp_timer_handle_t  RenderTimerHandle           = nullptr;
+    uint32_t            RenderTimerPeriodInMicroSec = 0;
+    SemaphoreHandle_t   DriverLock                  = NULL;   ///< Keeps the render task away from the drivers while they are in use by loop(), the web or the inputs
+
+    void UpdateRenderTask ();
+    inline void LockDrivers   () { if (NULL != DriverLock) { xSemaphoreTakeRecursive (DriverLock, portMAX_DELAY); } }
+    inline void UnlockDrivers () { if (NULL != DriverLock) { xSemaphoreGiveRecursive (DriverLock); } }
+
+    bool                UseSyncStart                = false;  ///< Start all of the ready RMT channels together
+#else
+    inline void LockDrivers   () {}
+    inline void UnlockDrivers () {}
+#endif // def ARDUINO_ARCH_ESP32
     gpio_num_t ConsoleTxGpio = gpio_num_t::GPIO_NUM_1;
     gpio_num_t ConsoleRxGpio = gpio_num_t::GPIO_NUM_3;
     bool       SerialUartIsActive = true;
 
 #define OM_IS_UART (CurrentOutputChannelDriver.PortType == OM_PortType_t::Uart)
 #define OM_IS_RMT  (CurrentOutputChannelDriver.PortType == OM_PortType_t::Rmt)
+#define OM_IS_I2S  (CurrentOutputChannelDriver.PortType == OM_PortType_t::I2s)
 
 }; // c_OutputMgr
 
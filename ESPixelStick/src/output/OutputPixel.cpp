@@ -21,6 +21,10 @@
 #include "OutputPixel.hpp"
 #include "OutputGECEFrame.hpp"
 
+#ifdef USE_PIXEL_COMPILED_LAYOUT
+static_assert(OM_MAX_NUM_CHANNELS <= 0x10000, "Channel map entries cannot address the full output buffer");
+#endif // def USE_PIXEL_COMPILED_LAYOUT
+
 //----------------------------------------------------------------------------
 c_OutputPixel::c_OutputPixel (c_OutputMgr::e_OutputChannelIds OutputChannelId,
                               gpio_num_t outputGpio,
@@ -41,6 +45,17 @@ c_OutputPixel::~c_OutputPixel ()
 {
     // DEBUG_START;
 
+    OutputMgr.ReleaseGammaTable (pGammaTable);
+    pGammaTable = nullptr;
+
+#ifdef USE_PIXEL_COMPILED_LAYOUT
+    if (nullptr != pChannelMap)
+    {
+        free (pChannelMap);
+        pChannelMap = nullptr;
+    }
+#endif // def USE_PIXEL_COMPILED_LAYOUT
+
     // DEBUG_END;
 } // ~c_OutputPixel
 
@@ -56,6 +71,7 @@ void c_OutputPixel::GetConfig (ArduinoJson::JsonObject& jsonConfig)
     jsonConfig[CN_gamma] = gamma;
     jsonConfig[CN_brightness] = brightness; // save as a 0 - 100 percentage
     jsonConfig[CN_interframetime] = InterFrameGapInMicroSec;
+    jsonConfig[CN_highrefresh] = HighRefreshRate;
     jsonConfig[CN_prependnullcount] = PrependNullPixelCount;
     jsonConfig[CN_appendnullcount] = AppendNullPixelCount;
 
@@ -99,6 +115,33 @@ void c_OutputPixel::GetStatus (ArduinoJson::JsonObject& jsonStatus)
     // DEBUG_END;
 } // GetStatus
 
+//----------------------------------------------------------------------------
+/*
+    The channel data is copied as it is when the layout is the identity: RGB
+    (or RGBW) order, no gamma, full brightness, no groups, no zigzag and no
+    nulls. Inverted data is only applied while sending so it does not count.
+*/
+bool c_OutputPixel::WritesChannelDataUnchanged ()
+{
+    // DEBUG_START;
+
+    bool Response = (0 == ColorOffsets.offset.r) &&
+                    (1 == ColorOffsets.offset.g) &&
+                    (2 == ColorOffsets.offset.b) &&
+                    (3 == ColorOffsets.offset.w) &&
+                    (1.0 == gamma) &&
+                    (100 == brightness) &&
+                    (1 == PixelGroupSize) &&
+                    (1 == zig_size) &&
+                    (0 == PrependNullPixelCount) &&
+                    (0 == AppendNullPixelCount) &&
+                    (0 == PixelPrependDataSize);
+
+    // DEBUG_END;
+    return Response;
+
+} // WritesChannelDataUnchanged
+
 //----------------------------------------------------------------------------
 void c_OutputPixel::SetOutputBufferSize(uint32_t NumChannelsAvailable)
 {
@@ -177,6 +220,7 @@ bool c_OutputPixel::SetConfig (ArduinoJson::JsonObject& jsonConfig)
     setFromJSON (gamma, jsonConfig, CN_gamma);
     setFromJSON (brightness, jsonConfig, CN_brightness);
     setFromJSON (InterFrameGapInMicroSec, jsonConfig, CN_interframetime);
+    setFromJSON (HighRefreshRate, jsonConfig, CN_highrefresh);
     setFromJSON (PrependNullPixelCount, jsonConfig, CN_prependnullcount);
     setFromJSON (AppendNullPixelCount, jsonConfig, CN_appendnullcount);
 
@@ -202,6 +246,8 @@ bool c_OutputPixel::SetConfig (ArduinoJson::JsonObject& jsonConfig)
     PixelGroupSize = (2 > PixelGroupSize) ? 1 : PixelGroupSize;
     // DEBUG_V (String ("PixelGroupSize: ") + String (PixelGroupSize));
 
+    UpdateChannelMap ();
+
     SetFrameDurration(IntensityBitTimeInUs, BlockSize, BlockDelayUs);
 
     // DEBUG_V (String ("     zig_size: ") + String (zig_size));
@@ -215,15 +261,14 @@ bool c_OutputPixel::SetConfig (ArduinoJson::JsonObject& jsonConfig)
 void c_OutputPixel::updateGammaTable ()
 {
     // DEBUG_START;
-    double tempBrightness = double (brightness) / 100.0;
-    // DEBUG_V (String ("tempBrightness: ") + String (tempBrightness));
 
-    for (unsigned int i = 0; i < sizeof (gamma_table); ++i)
+    // get the new table before letting go of the old one so that an unchanged table is not rebuilt
+    const c_OutputMgr::GammaTable_t * pNewGammaTable = OutputMgr.AcquireGammaTable (gamma, brightness);
+    if (nullptr != pNewGammaTable)
     {
-        // ESP.wdtFeed ();
-        gamma_table[i] = (uint8_t)min ((255.0 * pow (i * tempBrightness / 255, gamma) + 0.5), 255.0);
-        // DEBUG_V (String ("i: ") + String (i));
-        // DEBUG_V (String ("gamma_table[i]: ") + String (gamma_table[i]));
+        const c_OutputMgr::GammaTable_t * pOldGammaTable = pGammaTable;
+        pGammaTable = pNewGammaTable;
+        OutputMgr.ReleaseGammaTable (pOldGammaTable);
     }
 
     // DEBUG_END;
@@ -310,13 +355,15 @@ void c_OutputPixel::SetFrameDurration (float IntensityBitTimeInUs, uint16_t Bloc
 
     float TotalIntensityBytes       = OutputBufferSize;
     float TotalNullBytes            = (PrependNullPixelCount + AppendNullPixelCount) * NumIntensityBytesPerPixel;
-    float TotalBytesOfIntensityData = (TotalIntensityBytes + TotalNullBytes + FramePrependDataSize);
+    float TotalBytesOfIntensityData = (TotalIntensityBytes + TotalNullBytes + FramePrependDataSize + FrameAppendDataSize);
     float TotalBits                 = TotalBytesOfIntensityData * 8.0;
     uint16_t NumBlocks              = uint16_t (TotalBytesOfIntensityData / float (BlockSize));
     int TotalBlockDelayUs           = int (float (NumBlocks) * BlockDelayUs);
 
     uint32_t _FrameMinDurationInMicroSec = (IntensityBitTimeInUs * TotalBits) + InterFrameGapInMicroSec + TotalBlockDelayUs;
-    FrameMinDurationInMicroSec = max(uint32_t(25000), _FrameMinDurationInMicroSec);
+
+    // high refresh mode runs the port as fast as the wire time allows
+    FrameMinDurationInMicroSec = (HighRefreshRate) ? max(uint32_t(1), _FrameMinDurationInMicroSec) : max(uint32_t(25000), _FrameMinDurationInMicroSec);
 
     // DEBUG_V (String ("           OutputBufferSize: ") + String (OutputBufferSize));
     // DEBUG_V (String ("             PixelGroupSize: ") + String (PixelGroupSize));
@@ -354,7 +401,10 @@ void IRAM_ATTR c_OutputPixel::StartNewFrame ()
     FrameStartCounter++;
 #endif // def USE_PIXEL_DEBUG_COUNTERS
 
-    NextPixelToSend = GetBufferAddress();
+    // take a stable copy of the input data before we start sending it
+    LatchFrameBuffer ();
+
+    NextPixelToSend = pFrameBuffer;
     FramePrependDataCurrentIndex    = 0;
     FrameAppendDataCurrentIndex     = 0;
     SentPixelsCount                 = 0;
@@ -589,6 +639,87 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_GetNextIntensityToSend ()
 
 } // NextIntensityToSend
 
+//----------------------------------------------------------------------------
+/*
+    Fill the target with up to MaxCount intensities. Pixel data is copied
+    and null pixels are cleared in runs. The last byte of each run goes
+    through ISR_GetNextIntensityToSend so the frame and pixel state
+    transitions only happen at segment boundaries.
+
+    Only valid for outputs that send 8 bit intensities (not GECE and not
+    16 bit pixels).
+*/
+uint32_t IRAM_ATTR c_OutputPixel::ISR_GetNextIntensities (uint8_t * pTarget, uint32_t MaxCount)
+{
+    uint32_t NumIntensities = 0;
+
+    while ((NumIntensities < MaxCount) && ISR_MoreDataToSend ())
+    {
+        uint8_t * pRunStart = &pTarget[NumIntensities];
+        uint32_t  RunLength = 0;
+        uint32_t  RunSpace  = MaxCount - NumIntensities - 1;
+
+        do // once
+        {
+            if ((FrameState_t::FrameSendPixels != FrameState) ||
+                (PixelPrependDataCurrentIndex < PixelPrependDataSize))
+            {
+                // header and prepend data go through the state machine
+                break;
+            }
+
+            if (PixelSendState_t::PixelSendIntensity == PixelSendState)
+            {
+                if ((PixelIntensityCurrentIndex + 1) >= OutputBufferSize)
+                {
+                    break;
+                }
+
+                RunLength = min (RunSpace, OutputBufferSize - PixelIntensityCurrentIndex - 1);
+                memcpy (pRunStart, &pFrameBuffer[PixelIntensityCurrentIndex], RunLength);
+                PixelIntensityCurrentIndex += RunLength;
+#ifdef USE_PIXEL_DEBUG_COUNTERS
+                IntensityBytesSent += RunLength;
+#endif // def USE_PIXEL_DEBUG_COUNTERS
+                if (InvertData)
+                {
+                    for (uint32_t Index = 0; Index < RunLength; ++Index)
+                    {
+                        pRunStart[Index] = ~pRunStart[Index];
+                    }
+                }
+                break;
+            }
+
+            // null pixels
+            uint32_t & NullPixelCurrentCount = (PixelSendState_t::PixelPrependNulls == PixelSendState) ? PrependNullPixelCurrentCount : AppendNullPixelCurrentCount;
+            uint32_t   NullPixelCount        = (PixelSendState_t::PixelPrependNulls == PixelSendState) ? PrependNullPixelCount        : AppendNullPixelCount;
+
+            // without per pixel prepend data the nulls for all of the remaining pixels are contiguous
+            uint32_t NumPixelsInRun = (PixelPrependDataSize) ? 1 : (NullPixelCount - NullPixelCurrentCount);
+            uint32_t NumNullsInRun  = (NumPixelsInRun * NumIntensityBytesPerPixel) - PixelIntensityCurrentIndex;
+            if (1 >= NumNullsInRun)
+            {
+                break;
+            }
+
+            RunLength = min (RunSpace, NumNullsInRun - 1);
+            memset (pRunStart, (InvertData) ? 0xff : 0x00, RunLength);
+
+            uint32_t NumNullsSent       = PixelIntensityCurrentIndex + RunLength;
+            NullPixelCurrentCount      += NumNullsSent / NumIntensityBytesPerPixel;
+            PixelIntensityCurrentIndex  = NumNullsSent % NumIntensityBytesPerPixel;
+
+        } while (false);
+
+        NumIntensities += RunLength;
+        pTarget[NumIntensities++] = uint8_t (ISR_GetNextIntensityToSend ());
+    }
+
+    return NumIntensities;
+
+} // ISR_GetNextIntensities
+
 //----------------------------------------------------------------------------
 uint32_t IRAM_ATTR c_OutputPixel::GetIntensityData()
 {
@@ -596,7 +727,7 @@ uint32_t IRAM_ATTR c_OutputPixel::GetIntensityData()
 
     do // once
     {
-        response = pOutputBuffer[PixelIntensityCurrentIndex];
+        response = pFrameBuffer[PixelIntensityCurrentIndex];
 
         ++PixelIntensityCurrentIndex;
         if (PixelIntensityCurrentIndex >= OutputBufferSize)
@@ -631,61 +762,66 @@ uint32_t IRAM_ATTR c_OutputPixel::GetIntensityData()
     return response;
 }
 
+//----------------------------------------------------------------------------
+inline PixelLayout_t c_OutputPixel::GetLayout ()
+{
+    return PixelLayout_t {NumIntensityBytesPerPixel, PixelGroupSize, zig_size, ColorOffsets.Array};
+
+} // GetLayout
+
 //----------------------------------------------------------------------------
 inline uint32_t c_OutputPixel::CalculateIntensityOffset(uint32_t ChannelId)
+{
+    return PixelLayoutCalculateOffset (GetLayout (), ChannelId);
+
+} // CalculateIntensityOffset
+
+//----------------------------------------------------------------------------
+/*
+    Pre-compute the output buffer offset for every input channel so that the
+    write path does not need to redo the zig zag, group and color order math
+    for every byte of every packet.
+*/
+void c_OutputPixel::UpdateChannelMap ()
 {
     // DEBUG_START;
 
-    // DEBUG_V(String("              ChannelId: ") + String(ChannelId));
-    uint32_t PixelId = ChannelId / uint32_t(NumIntensityBytesPerPixel);
-    // DEBUG_V(String("               PixelId0: ") + String(PixelId));
+#ifdef USE_PIXEL_COMPILED_LAYOUT
+    uint32_t NewChannelMapSize = GetNumOutputBufferChannelsServiced ();
+    // DEBUG_V (String ("NewChannelMapSize: ") + String (NewChannelMapSize));
 
-    // are we doing a zig zag operation?
-    if ((zig_size > 1) && (PixelId >= zig_size))
+    do // once
     {
-        // DEBUG_V(String("               PixelId1: ") + String(PixelId));
-        // DEBUG_V(String("               zig_size: ") + String(zig_size));
-        uint32_t ZigZagGroupId = PixelId / zig_size;
-        // DEBUG_V(String("          ZigZagGroupId: ") + String(ZigZagGroupId));
-
-        // is this a backwards group
-        if (0 != (ZigZagGroupId & 0x1))
+        if (NewChannelMapSize != ChannelMapSize)
         {
-            // DEBUG_V("Backwards Group");
-            uint32_t zigoffset = PixelId % zig_size;
-            // DEBUG_V(String("              zigoffset: ") + String(zigoffset));
-            uint32_t BaseGroupPixelId = ZigZagGroupId * zig_size;
-            // DEBUG_V(String("      BaseGroupPixelId1: ") + String(BaseGroupPixelId));
-            PixelId = BaseGroupPixelId + (zig_size - 1) - zigoffset;
-            // DEBUG_V(String("      BaseGroupPixelId2: ") + String(BaseGroupPixelId));
-            // DEBUG_V(String("                PixelId: 0x") + String(PixelId, HEX));
+            if (nullptr != pChannelMap)
+            {
+                free (pChannelMap);
+                pChannelMap = nullptr;
+            }
+            ChannelMapSize = 0;
+
+            if (0 == NewChannelMapSize)
+            {
+                break;
+            }
+
+            pChannelMap = (uint16_t*)malloc (NewChannelMapSize * sizeof (pChannelMap[0]));
+            if (nullptr == pChannelMap)
+            {
+                logcon (String (F ("Could not allocate the channel map. Using calculated offsets.")));
+                break;
+            }
+            ChannelMapSize = NewChannelMapSize;
         }
-        // DEBUG_V(String("               PixelId2: ") + String(PixelId));
-    }
-    // DEBUG_V(String("          Final PixelId: ") + String(PixelId));
 
-    uint32_t ColorOrderIndex = ChannelId % NumIntensityBytesPerPixel;
-    if (uint32_t(NumIntensityBytesPerPixel) > ChannelId)
-    {
-        ColorOrderIndex = ChannelId;
-    }
-    uint32_t ColorOrderId = ColorOffsets.Array[ColorOrderIndex];
-    uint32_t PixelIntensityBaseId = PixelId * PixelGroupSize * NumIntensityBytesPerPixel;
-    uint32_t TargetBufferIntensityId = PixelIntensityBaseId + ColorOrderId;
-
-    // DEBUG_V(String("                ChannelId: 0x") + String(ChannelId, HEX));
-    // DEBUG_V(String("                  PixelId: 0x") + String(PixelId, HEX));
-    // DEBUG_V(String("          ColorOrderIndex: 0x") + String(ColorOrderIndex, HEX));
-    // DEBUG_V(String("             ColorOrderId: 0x") + String(ColorOrderId, HEX));
-    // DEBUG_V(String("NumIntensityBytesPerPixel: 0x") + String(NumIntensityBytesPerPixel, HEX));
-    // DEBUG_V(String("           PixelGroupSize: 0x") + String(PixelGroupSize, HEX));
-    // DEBUG_V(String("     PixelIntensityBaseId: 0x") + String(PixelIntensityBaseId, HEX));
-    // DEBUG_V(String("  TargetBufferIntensityId: 0x") + String(TargetBufferIntensityId, HEX));
+        PixelLayoutBuildMap (GetLayout (), pChannelMap, ChannelMapSize);
 
-    // DEBUG_END;
-    return TargetBufferIntensityId;
+    } while (false);
+#endif // def USE_PIXEL_COMPILED_LAYOUT
 
-} // CalculateIntensityOffset
+    // DEBUG_END;
+} // UpdateChannelMap
 
 //----------------------------------------------------------------------------
 void c_OutputPixel::WriteChannelData(uint32_t StartChannelId, uint32_t ChannelCount, byte *pSourceData)
@@ -695,22 +831,22 @@ void c_OutputPixel::WriteChannelData(uint32_t StartChannelId, uint32_t ChannelCo
     // DEBUG_V(String("         StartChannelId: 0x") + String(StartChannelId, HEX));
     // DEBUG_V(String("           ChannelCount: 0x") + String(ChannelCount, HEX));
 
-    uint32_t EndChannelId = StartChannelId + ChannelCount;
-    uint32_t SourceDataIndex = 0;
-    for (uint32_t currentChannelId = StartChannelId; currentChannelId < EndChannelId; ++currentChannelId, ++SourceDataIndex)
-    {
-        uint32_t CurrentIntensityData = gamma_table[pSourceData[SourceDataIndex]];
-        CurrentIntensityData = uint8_t((uint32_t(CurrentIntensityData) * AdjustedBrightness) >> 8);
+    uint32_t ChangedBits = 0;
 
-        uint32_t CalculatedChannelId = CalculateIntensityOffset(currentChannelId);
+#ifdef USE_PIXEL_COMPILED_LAYOUT
+    if ((StartChannelId + ChannelCount) <= ChannelMapSize)
+    {
+        ChangedBits = PixelLayoutWriteMapped (GetLayout (), pChannelMap, pGammaTable->Forward, StartChannelId, ChannelCount, pSourceData, pOutputBuffer);
+    }
+    else
+#endif // def USE_PIXEL_COMPILED_LAYOUT
+    {
+        ChangedBits = PixelLayoutWriteCalculated (GetLayout (), pGammaTable->Forward, StartChannelId, ChannelCount, pSourceData, pOutputBuffer);
+    }
 
-        for(uint32_t CurrentGroupIndex = 0; CurrentGroupIndex < PixelGroupSize; ++CurrentGroupIndex)
-        {
-            // DEBUG_V(String("      CurrentGroupIndex: 0x") + String(CurrentGroupIndex, HEX));
-            // DEBUG_V(String("    CalculatedChannelId: 0x") + String(CalculatedChannelId, HEX));
-            pOutputBuffer[CalculatedChannelId] = CurrentIntensityData;
-            CalculatedChannelId += NumIntensityBytesPerPixel;
-        }
+    if (ChangedBits)
+    {
+        FrameIsDirty = true;
     }
 
     // DEBUG_END;
@@ -729,10 +865,12 @@ void c_OutputPixel::ReadChannelData(uint32_t StartChannelId, uint32_t ChannelCou
     uint32_t SourceDataIndex = 0;
     for (uint32_t currentChannelId = StartChannelId; currentChannelId < EndChannelId; ++currentChannelId, ++SourceDataIndex)
     {
-        uint8_t CurrentIntensityData = pOutputBuffer[CalculateIntensityOffset(currentChannelId)];
-        // CurrentIntensityData = gamma_table[CurrentIntensityData];
-        CurrentIntensityData = uint8_t((uint32_t(CurrentIntensityData << 8) / AdjustedBrightness));
-        pTargetData[SourceDataIndex] = CurrentIntensityData;
+#ifdef USE_PIXEL_COMPILED_LAYOUT
+        uint32_t BufferOffset = (currentChannelId < ChannelMapSize) ? pChannelMap[currentChannelId] : CalculateIntensityOffset(currentChannelId);
+#else
+        uint32_t BufferOffset = CalculateIntensityOffset(currentChannelId);
+#endif // def USE_PIXEL_COMPILED_LAYOUT
+        pTargetData[SourceDataIndex] = pGammaTable->Inverse[pOutputBuffer[BufferOffset]];
     }
 
     // DEBUG_END;
@@ -23,6 +23,7 @@
 */
 
 #include "OutputCommon.hpp"
+#include "OutputPixelLayout.hpp"
 
 class c_OutputPixel : public c_OutputCommon
 {
@@ -53,12 +54,15 @@ public:
              void         SetInvertData (bool _InvertData) { InvertData = _InvertData; }
     virtual  void         WriteChannelData (uint32_t StartChannelId, uint32_t ChannelCount, byte *pSourceData);
     virtual  void         ReadChannelData (uint32_t StartChannelId, uint32_t ChannelCount, byte *pTargetData);
+    virtual  bool         WritesChannelDataUnchanged ();                   ///< true when gamma, color order and groups leave the data as it is
+    virtual  bool         UsesHighRefreshRate () { return HighRefreshRate; }
     inline   void         SetIntensityBitTimeInUS (float value) { IntensityBitTimeInUs = value; }
              void         SetIntensityDataWidth(uint32_t value);
              void         StartNewFrame();
     bool     IRAM_ATTR    ISR_MoreDataToSend () { return FrameState_t::FrameDone != FrameState; }
     uint32_t IRAM_ATTR    ISR_GetNextIntensityToSend ();
-    void                  SetPixelCount(uint32_t value) {pixel_count = value;}
+    uint32_t IRAM_ATTR    ISR_GetNextIntensities (uint8_t * pTarget, uint32_t MaxCount); ///< 8 bit intensities only
+    void                  SetPixelCount(uint32_t value) {pixel_count = value; UpdateChannelMap ();}
     uint32_t              GetPixelCount() {return pixel_count;}
 
 protected:
@@ -68,12 +72,18 @@ protected:
     void SetPixelPrependInformation (const uint8_t* data, uint32_t len);
 
     uint16_t  InterFrameGapInMicroSec = 300;
+    bool      HighRefreshRate         = false;  ///< Do not limit the frame rate to 40 fps
 
     void SetFrameDurration (float IntensityBitTimeInUs, uint16_t BlockSize = 1, float BlockDelayUs = 0.0);
 
 private:
 #define PIXEL_DEFAULT_INTENSITY_BYTES_PER_PIXEL 3
 
+#ifdef ARDUINO_ARCH_ESP32
+    // Translate input channels to output buffer offsets using a table built at config time
+#   define USE_PIXEL_COMPILED_LAYOUT
+#endif // def ARDUINO_ARCH_ESP32
+
     uint32_t      NumIntensityBytesPerPixel = PIXEL_DEFAULT_INTENSITY_BYTES_PER_PIXEL;
 
     uint8_t     * NextPixelToSend             = nullptr;
@@ -116,6 +126,11 @@ private:
     bool        InvertData                  = false;
     uint32_t    IntensityMultiplier         = 1;
 
+#ifdef USE_PIXEL_COMPILED_LAYOUT
+    uint16_t  * pChannelMap                 = nullptr;  ///< Virtual channel ID to output buffer offset
+    uint32_t    ChannelMapSize              = 0;        ///< Number of entries in the channel map
+#endif // def USE_PIXEL_COMPILED_LAYOUT
+
 // #define USE_PIXEL_DEBUG_COUNTERS
 #ifdef USE_PIXEL_DEBUG_COUNTERS
     uint32_t     PixelsToSend                     = 0;
@@ -152,7 +167,7 @@ private:
     } ColorOffsets_t;
     ColorOffsets_t  ColorOffsets;
 
-    uint8_t     gamma_table[256]    = { 0 };    ///< Gamma Adjustment table
+    const c_OutputMgr::GammaTable_t * pGammaTable = nullptr; ///< Shared gamma and brightness adjustment table
     float       gamma               = 1.0;      ///< gamma value to use
     uint8_t     brightness          = 100;
     uint32_t    AdjustedBrightness  = 256;
@@ -167,7 +182,9 @@ private:
     void updateGammaTable(); ///< Generate gamma correction table
     void updateColorOrderOffsets(); ///< Update color order
     bool validate ();        ///< confirm that the current configuration is valid
+    inline PixelLayout_t GetLayout ();
     inline uint32_t CalculateIntensityOffset(uint32_t ChannelId);
+    void UpdateChannelMap ();   ///< Rebuild the channel to buffer offset table
     uint32_t IRAM_ATTR GetIntensityData();
 
     enum PixelSendState_t
@@ -0,0 +1,145 @@
+#pragma once
+/*
+* OutputPixelLayout.hpp - Input channel to output buffer layout helpers for the pixel outputs
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   These functions only depend on the standard integer types so that they
+*   can be built and checked on a host as well as on the target.
+*
+*/
+
+#include <stdint.h>
+
+#ifndef IRAM_ATTR
+#   define IRAM_ATTR
+#endif // ndef IRAM_ATTR
+
+struct PixelLayout_t
+{
+    uint32_t        NumIntensityBytesPerPixel;
+    uint32_t        PixelGroupSize;
+    uint32_t        zig_size;
+    const uint8_t * ColorOffsets;               ///< Output position of each color within a pixel
+};
+
+//----------------------------------------------------------------------------
+/*
+    Translate an input channel into its output buffer offset. This applies
+    the zig zag, the pixel group size and the color order.
+*/
+inline uint32_t PixelLayoutCalculateOffset (const PixelLayout_t & Layout, uint32_t ChannelId)
+{
+    uint32_t PixelId = ChannelId / Layout.NumIntensityBytesPerPixel;
+
+    // are we doing a zig zag operation?
+    if ((Layout.zig_size > 1) && (PixelId >= Layout.zig_size))
+    {
+        uint32_t ZigZagGroupId = PixelId / Layout.zig_size;
+
+        // is this a backwards group
+        if (0 != (ZigZagGroupId & 0x1))
+        {
+            uint32_t zigoffset = PixelId % Layout.zig_size;
+            uint32_t BaseGroupPixelId = ZigZagGroupId * Layout.zig_size;
+            PixelId = BaseGroupPixelId + (Layout.zig_size - 1) - zigoffset;
+        }
+    }
+
+    uint32_t ColorOrderIndex = ChannelId % Layout.NumIntensityBytesPerPixel;
+    uint32_t ColorOrderId = Layout.ColorOffsets[ColorOrderIndex];
+    uint32_t PixelIntensityBaseId = PixelId * Layout.PixelGroupSize * Layout.NumIntensityBytesPerPixel;
+
+    return PixelIntensityBaseId + ColorOrderId;
+
+} // PixelLayoutCalculateOffset
+
+//----------------------------------------------------------------------------
+inline void PixelLayoutBuildMap (const PixelLayout_t & Layout, uint16_t * pChannelMap, uint32_t ChannelMapSize)
+{
+    for (uint32_t ChannelId = 0; ChannelId < ChannelMapSize; ++ChannelId)
+    {
+        pChannelMap[ChannelId] = uint16_t (PixelLayoutCalculateOffset (Layout, ChannelId));
+    }
+
+} // PixelLayoutBuildMap
+
+//----------------------------------------------------------------------------
+/*
+    Gamma adjust the source data and write it to every pixel in its group.
+    The offsets are calculated for every channel. Returns the bits that
+    changed in the output buffer.
+*/
+inline uint32_t PixelLayoutWriteCalculated (const PixelLayout_t & Layout,
+                                            const uint8_t * Forward,
+                                            uint32_t        StartChannelId,
+                                            uint32_t        ChannelCount,
+                                            const uint8_t * pSourceData,
+                                            uint8_t       * pOutputBuffer)
+{
+    uint32_t ChangedBits  = 0;
+    uint32_t EndChannelId = StartChannelId + ChannelCount;
+
+    for (uint32_t currentChannelId = StartChannelId; currentChannelId < EndChannelId; ++currentChannelId)
+    {
+        uint8_t CurrentIntensityData = Forward[*pSourceData++];
+
+        uint32_t CalculatedChannelId = PixelLayoutCalculateOffset (Layout, currentChannelId);
+
+        for (uint32_t CurrentGroupIndex = 0; CurrentGroupIndex < Layout.PixelGroupSize; ++CurrentGroupIndex)
+        {
+            ChangedBits |= pOutputBuffer[CalculatedChannelId] ^ CurrentIntensityData;
+            pOutputBuffer[CalculatedChannelId] = CurrentIntensityData;
+            CalculatedChannelId += Layout.NumIntensityBytesPerPixel;
+        }
+    }
+
+    return ChangedBits;
+
+} // PixelLayoutWriteCalculated
+
+//----------------------------------------------------------------------------
+/*
+    Same as PixelLayoutWriteCalculated but the offsets come from a map built
+    by PixelLayoutBuildMap. The caller makes sure every channel is in the map.
+*/
+inline uint32_t PixelLayoutWriteMapped (const PixelLayout_t & Layout,
+                                        const uint16_t * pChannelMap,
+                                        const uint8_t  * Forward,
+                                        uint32_t         StartChannelId,
+                                        uint32_t         ChannelCount,
+                                        const uint8_t  * pSourceData,
+                                        uint8_t        * pOutputBuffer)
+{
+    uint32_t ChangedBits = 0;
+    const uint16_t * pCurrentMapEntry = &pChannelMap[StartChannelId];
+    const uint8_t  * pEndOfSourceData = &pSourceData[ChannelCount];
+
+    while (pSourceData < pEndOfSourceData)
+    {
+        uint8_t CurrentIntensityData = Forward[*pSourceData++];
+
+        uint8_t * pTarget = &pOutputBuffer[*pCurrentMapEntry++];
+        for (uint32_t CurrentGroupIndex = Layout.PixelGroupSize; 0 != CurrentGroupIndex; --CurrentGroupIndex)
+        {
+            ChangedBits |= *pTarget ^ CurrentIntensityData;
+            *pTarget = CurrentIntensityData;
+            pTarget += Layout.NumIntensityBytesPerPixel;
+        }
+    }
+
+    return ChangedBits;
+
+} // PixelLayoutWriteMapped
@@ -21,9 +21,128 @@
 
 #include "OutputRmt.hpp"
 
+#ifdef USE_RMT_EXPANSION_TABLE
+#   include <esp_heap_caps.h>
+#endif // def USE_RMT_EXPANSION_TABLE
+
 // forward declaration for the isr handler
 static void IRAM_ATTR rmt_intr_handler (void* param);
 
+#ifdef USE_RMT_EXPANSION_TABLE
+//----------------------------------------------------------------------------
+/*
+    Each entry holds the eight RMT slots that represent one byte of intensity
+    data. Channels that use the same bit values and bit order share a table.
+*/
+struct c_OutputRmt::ExpansionTable_t
+{
+    uint32_t     ZeroBitValue = 0;
+    uint32_t     OneBitValue  = 0;
+    bool         MsbFirst     = true;
+    uint32_t     RefCount     = 0;
+    RmtExpansionRow_t Slots[256];
+};
+
+// One extra slot allows a channel to acquire its new table before releasing the old one.
+static c_OutputRmt::ExpansionTable_t * RmtExpansionTables[RMT_CHANNEL_MAX + 1];
+
+//----------------------------------------------------------------------------
+static c_OutputRmt::ExpansionTable_t * AcquireRmtExpansionTable (uint32_t ZeroBitValue, uint32_t OneBitValue, bool MsbFirst)
+{
+    // DEBUG_START;
+
+    c_OutputRmt::ExpansionTable_t * Response = nullptr;
+
+    do // once
+    {
+        for (auto CurrentTable : RmtExpansionTables)
+        {
+            if ((nullptr != CurrentTable) &&
+                (ZeroBitValue == CurrentTable->ZeroBitValue) &&
+                (OneBitValue  == CurrentTable->OneBitValue) &&
+                (MsbFirst     == CurrentTable->MsbFirst))
+            {
+                Response = CurrentTable;
+                break;
+            }
+        }
+
+        if (nullptr != Response)
+        {
+            // DEBUG_V ("Reuse an existing table");
+            break;
+        }
+
+        for (auto & CurrentTable : RmtExpansionTables)
+        {
+            if (nullptr != CurrentTable)
+            {
+                continue;
+            }
+
+            // the ISR reads the table so it must be in internal memory
+            CurrentTable = (c_OutputRmt::ExpansionTable_t *)heap_caps_malloc (sizeof (c_OutputRmt::ExpansionTable_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+            if (nullptr == CurrentTable)
+            {
+                logcon (F ("Could not allocate an RMT expansion table"));
+                break;
+            }
+
+            CurrentTable->ZeroBitValue = ZeroBitValue;
+            CurrentTable->OneBitValue  = OneBitValue;
+            CurrentTable->MsbFirst     = MsbFirst;
+            CurrentTable->RefCount     = 0;
+
+            RmtBuildExpansionTable (ZeroBitValue, OneBitValue, MsbFirst, CurrentTable->Slots);
+
+            Response = CurrentTable;
+            break;
+        }
+
+    } while (false);
+
+    if (nullptr != Response)
+    {
+        Response->RefCount++;
+    }
+
+    // DEBUG_END;
+
+    return Response;
+
+} // AcquireRmtExpansionTable
+
+//----------------------------------------------------------------------------
+static void ReleaseRmtExpansionTable (c_OutputRmt::ExpansionTable_t * pTable)
+{
+    // DEBUG_START;
+
+    for (auto & CurrentTable : RmtExpansionTables)
+    {
+        if ((nullptr == pTable) || (CurrentTable != pTable))
+        {
+            continue;
+        }
+
+        if (0 == --CurrentTable->RefCount)
+        {
+            free (CurrentTable);
+            CurrentTable = nullptr;
+        }
+        break;
+    }
+
+    // DEBUG_END;
+
+} // ReleaseRmtExpansionTable
+#endif // def USE_RMT_EXPANSION_TABLE
+
+// Channels that are waiting for a synchronized start
+static bool          RmtSynchronizedStart = false;
+static c_OutputRmt * RmtArmedChannels[RMT_CHANNEL_MAX];
+static uint32_t      RmtNumArmedChannels  = 0;
+static portMUX_TYPE  RmtSyncStartLock     = portMUX_INITIALIZER_UNLOCKED;
+
 //----------------------------------------------------------------------------
 c_OutputRmt::c_OutputRmt()
 {
@@ -63,6 +182,19 @@ c_OutputRmt::~c_OutputRmt ()
         EnableInterrupts;
     }
 
+#ifdef USE_RMT_EXPANSION_TABLE
+    ReleaseRmtExpansionTable (pExpansionTable);
+    pExpansionTable = nullptr;
+#endif // def USE_RMT_EXPANSION_TABLE
+
+#ifdef USE_RMT_PREENCODE
+    if (pStagingBuffer)
+    {
+        free (pStagingBuffer);
+        pStagingBuffer = nullptr;
+    }
+#endif // def USE_RMT_PREENCODE
+
     // DEBUG_END;
 } // ~c_OutputRmt
 
@@ -100,17 +232,8 @@ void c_OutputRmt::Begin (OutputRmtConfig_t config )
         }
 
         NumRmtSlotsPerIntensityValue = OutputRmtConfig.IntensityDataWidth + ((OutputRmtConfig.SendInterIntensityBits) ? 1 : 0);
-        if(OutputRmtConfig_t::DataDirection_t::MSB2LSB == OutputRmtConfig.DataDirection)
-        {
-            TxIntensityDataStartingMask = 1 << (OutputRmtConfig.IntensityDataWidth - 1);
-        }
-        else
-        {
-            TxIntensityDataStartingMask = 1;
-        }
         // DEBUG_V (String("          IntensityDataWidth: ") + String(OutputRmtConfig.IntensityDataWidth));
         // DEBUG_V (String("NumRmtSlotsPerIntensityValue: ") + String (NumRmtSlotsPerIntensityValue));
-        // DEBUG_V(String("  TxIntensityDataStartingMask: 0x") + String(TxIntensityDataStartingMask, HEX));
         // DEBUG_V (String ("                    DataPin: ") + String (OutputRmtConfig.DataPin));
         // DEBUG_V (String ("               RmtChannelId: ") + String (OutputRmtConfig.RmtChannelId));
 
@@ -169,8 +292,23 @@ void c_OutputRmt::Begin (OutputRmtConfig_t config )
             }
         }
 
+#ifdef USE_RMT_PREENCODE
+        // the expansion tables only handle whole bytes
+        if ((8 == OutputRmtConfig.IntensityDataWidth) || (16 == OutputRmtConfig.IntensityDataWidth))
+        {
+            // the ISR reads the staging buffer so it must be in internal memory
+            pStagingBuffer = (uint32_t *)heap_caps_malloc (RMT_PREENCODE_NUM_ITEMS * sizeof (pStagingBuffer[0]), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+            if (nullptr == pStagingBuffer)
+            {
+                logcon (F ("Could not allocate the RMT staging buffer. Using ISR encoding."));
+            }
+        }
+        pStagingCurrent = pStagingBuffer;
+        pStagingEnd     = pStagingBuffer;
+#endif // def USE_RMT_PREENCODE
+
         // create a delay before starting to send data
-        LastFrameStartTime = millis();
+        LastFrameStartTime = micros();
 
         // DEBUG_V (String ("                Intensity2Rmt[0]: 0x") + String (uint32_t (Intensity2Rmt[0].val), HEX));
         // DEBUG_V (String ("                Intensity2Rmt[1]: 0x") + String (uint32_t (Intensity2Rmt[1].val), HEX));
@@ -330,6 +468,13 @@ inline void IRAM_ATTR c_OutputRmt::ISR_EnqueueData(uint32_t value)
 //----------------------------------------------------------------------------
 inline bool IRAM_ATTR c_OutputRmt::MoreDataToSend()
 {
+#ifdef USE_RMT_PREENCODE
+    if (pStagingCurrent < pStagingEnd)
+    {
+        return true;
+    }
+#endif // def USE_RMT_PREENCODE
+
     if (nullptr != OutputRmtConfig.pPixelDataSource)
     {
         return OutputRmtConfig.pPixelDataSource->ISR_MoreDataToSend();
@@ -361,6 +506,23 @@ inline uint32_t IRAM_ATTR c_OutputRmt::GetNextIntensityToSend()
 #endif // defined(SUPPORT_OutputType_DMX) || defined(SUPPORT_OutputType_Serial) || defined(SUPPORT_OutputType_Renard)
 } // GetNextIntensityToSend
 
+//----------------------------------------------------------------------------
+inline uint32_t IRAM_ATTR c_OutputRmt::GetNextIntensities(uint8_t * pTarget, uint32_t MaxCount)
+{
+    if (nullptr != OutputRmtConfig.pPixelDataSource)
+    {
+        return OutputRmtConfig.pPixelDataSource->ISR_GetNextIntensities(pTarget, MaxCount);
+    }
+#if defined(SUPPORT_OutputType_DMX) || defined(SUPPORT_OutputType_Serial) || defined(SUPPORT_OutputType_Renard)
+    else
+    {
+        return OutputRmtConfig.pSerialDataSource->ISR_GetNextIntensities(pTarget, MaxCount);
+    }
+#else
+    return 0;
+#endif // defined(SUPPORT_OutputType_DMX) || defined(SUPPORT_OutputType_Serial) || defined(SUPPORT_OutputType_Renard)
+} // GetNextIntensities
+
 //----------------------------------------------------------------------------
 inline void IRAM_ATTR c_OutputRmt::StartNewDataFrame()
 {
@@ -417,8 +579,16 @@ void c_OutputRmt::StartNewFrame ()
 
     // set up to send a new frame
     StartNewDataFrame ();
+    UpdateEncodeConfig ();
+#ifdef USE_RMT_EXPANSION_TABLE
+    UpdateExpansionTable ();
+#endif // def USE_RMT_EXPANSION_TABLE
     // DEBUG_V();
 
+#ifdef USE_RMT_PREENCODE
+    PreEncodeFrame ();
+#endif // def USE_RMT_PREENCODE
+
     ISR_Handler_SendIntensityData ();
     // DEBUG_V();
 /*
@@ -432,39 +602,190 @@ void c_OutputRmt::StartNewFrame ()
 
 } // ISR_Handler_StartNewFrame
 
+//----------------------------------------------------------------------------
+void c_OutputRmt::UpdateEncodeConfig ()
+{
+    // DEBUG_START;
+
+    // the bit values can be changed by the driver after Begin
+    EncodeConfig.ZeroBitValue           = Intensity2Rmt[RmtDataBitIdType_t::RMT_DATA_BIT_ZERO_ID].val;
+    EncodeConfig.OneBitValue            = Intensity2Rmt[RmtDataBitIdType_t::RMT_DATA_BIT_ONE_ID].val;
+    EncodeConfig.InterIntensityValue    = Intensity2Rmt[RmtDataBitIdType_t::RMT_STOP_START_BIT_ID].val;
+    EncodeConfig.EndOfFrameValue        = Intensity2Rmt[RmtDataBitIdType_t::RMT_END_OF_FRAME].val;
+    EncodeConfig.IntensityDataWidth     = OutputRmtConfig.IntensityDataWidth;
+    EncodeConfig.MsbFirst               = (OutputRmtConfig_t::DataDirection_t::MSB2LSB == OutputRmtConfig.DataDirection);
+    EncodeConfig.SendInterIntensityBits = OutputRmtConfig.SendInterIntensityBits;
+    EncodeConfig.SendEndOfFrameBits     = OutputRmtConfig.SendEndOfFrameBits;
+
+    // DEBUG_END;
+
+} // UpdateEncodeConfig
+
+#ifdef USE_RMT_EXPANSION_TABLE
+//----------------------------------------------------------------------------
+/*
+    Called before the ISR is started for a frame. Leaves pExpansionTable
+    set to nullptr when the data cannot be encoded a byte at a time.
+*/
+void c_OutputRmt::UpdateExpansionTable ()
+{
+    // DEBUG_START;
+
+    uint32_t ZeroBitValue = EncodeConfig.ZeroBitValue;
+    uint32_t OneBitValue  = EncodeConfig.OneBitValue;
+    bool     MsbFirst     = EncodeConfig.MsbFirst;
+
+    if ((8 != EncodeConfig.IntensityDataWidth) && (16 != EncodeConfig.IntensityDataWidth))
+    {
+        ReleaseRmtExpansionTable (pExpansionTable);
+        pExpansionTable = nullptr;
+    }
+    else if ((nullptr == pExpansionTable) ||
+             (ZeroBitValue != pExpansionTable->ZeroBitValue) ||
+             (OneBitValue  != pExpansionTable->OneBitValue) ||
+             (MsbFirst     != pExpansionTable->MsbFirst))
+    {
+        ExpansionTable_t * pNewTable = AcquireRmtExpansionTable (ZeroBitValue, OneBitValue, MsbFirst);
+        ReleaseRmtExpansionTable (pExpansionTable);
+        pExpansionTable = pNewTable;
+    }
+
+    // DEBUG_END;
+
+} // UpdateExpansionTable
+#endif // def USE_RMT_EXPANSION_TABLE
+
+#ifdef USE_RMT_PREENCODE
+
+//----------------------------------------------------------------------------
+/*
+    Translate as much of the frame as fits in the staging buffer into RMT
+    slots. The ISR copies the staged slots into the RMT memory and then
+    encodes the rest of the frame itself using the same expansion table.
+*/
+void c_OutputRmt::PreEncodeFrame ()
+{
+    // DEBUG_START;
+
+    pStagingCurrent = pStagingBuffer;
+    pStagingEnd     = pStagingBuffer;
+
+    do // once
+    {
+        if (nullptr == pStagingBuffer)
+        {
+            break;
+        }
+
+        if (nullptr == pExpansionTable)
+        {
+            break;
+        }
+
+        // leave room for a full intensity value plus an end of frame slot
+        uint32_t * pCurrentSlot  = pStagingBuffer;
+        uint32_t * pStagingLimit = &pStagingBuffer[RMT_PREENCODE_NUM_ITEMS - (NumRmtSlotsPerIntensityValue + 1)];
+
+        // 8 bit data is pulled from the data source in runs
+        bool     UseSpans = (8 == OutputRmtConfig.IntensityDataWidth);
+        uint8_t  IntensityData[64];
+
+        while ((pCurrentSlot <= pStagingLimit) && MoreDataToSend())
+        {
+            uint32_t NumValues = 1;
+            if (UseSpans)
+            {
+                uint32_t MaxValues = min (uint32_t (sizeof (IntensityData)), uint32_t ((pStagingLimit - pCurrentSlot) / NumRmtSlotsPerIntensityValue) + 1);
+                NumValues = GetNextIntensities (IntensityData, MaxValues);
+            }
+
+            for (uint32_t ValueIndex = 0; ValueIndex < NumValues; ++ValueIndex)
+            {
+                uint32_t IntensityValue = (UseSpans) ? IntensityData[ValueIndex] : GetNextIntensityToSend();
+#ifdef USE_RMT_DEBUG_COUNTERS
+                IntensityValuesSent++;
+                IntensityBitsSent += OutputRmtConfig.IntensityDataWidth;
+#endif // def USE_RMT_DEBUG_COUNTERS
+
+                bool LastValueInFrame = ((ValueIndex + 1) == NumValues) && !MoreDataToSend();
+                pCurrentSlot += RmtEncodeIntensityExpanded (EncodeConfig, pExpansionTable->Slots, IntensityValue, LastValueInFrame, pCurrentSlot);
+            }
+        } // end while there is space in the staging buffer
+
+        pStagingEnd = pCurrentSlot;
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // PreEncodeFrame
+
+//----------------------------------------------------------------------------
+inline void IRAM_ATTR c_OutputRmt::ISR_SendStagedData ()
+{
+    // keep one slot free for the end of data marker
+    while ((NumAvailableRmtSlotsToFill > 1) && (pStagingCurrent < pStagingEnd))
+    {
+        uint32_t NumSlotsToCopy = min (uint32_t (NumAvailableRmtSlotsToFill - 1), uint32_t (pStagingEnd - pStagingCurrent));
+        NumSlotsToCopy = min (NumSlotsToCopy, uint32_t ((RmtEndAddr - RmtCurrentAddr) + 1));
+        NumAvailableRmtSlotsToFill -= NumSlotsToCopy;
+
+        // RMT memory must be written one word at a time
+        while (NumSlotsToCopy--)
+        {
+            (RmtCurrentAddr++)->val = *pStagingCurrent++;
+        }
+
+        if (RmtCurrentAddr > RmtEndAddr)
+        {
+            RmtCurrentAddr = RmtStartAddr;
+        }
+    }
+
+} // ISR_SendStagedData
+#endif // def USE_RMT_PREENCODE
+
 //----------------------------------------------------------------------------
 void IRAM_ATTR c_OutputRmt::ISR_Handler_SendIntensityData ()
 {
     // //DEBUG_START;
 
-    uint32_t OneBitValue  = Intensity2Rmt[RmtDataBitIdType_t::RMT_DATA_BIT_ONE_ID].val;
-    uint32_t ZeroBitValue = Intensity2Rmt[RmtDataBitIdType_t::RMT_DATA_BIT_ZERO_ID].val;
+#ifdef USE_RMT_PREENCODE
+    // send the staged slots first. Anything left over is encoded below.
+    ISR_SendStagedData ();
+#endif // def USE_RMT_PREENCODE
+
+    uint32_t RmtSlots[RMT_ENCODE_MAX_SLOTS_PER_VALUE];
 
     while ((NumAvailableRmtSlotsToFill > NumRmtSlotsPerIntensityValue) && MoreDataToSend())
     {
         uint32_t IntensityValue = GetNextIntensityToSend();
 #ifdef USE_RMT_DEBUG_COUNTERS
         IntensityValuesSent++;
+        IntensityBitsSent += OutputRmtConfig.IntensityDataWidth;
 #endif // def USE_RMT_DEBUG_COUNTERS
 
         // convert the intensity data into RMT slot data
-        uint32_t bitmask = TxIntensityDataStartingMask;
-        for (uint32_t BitCount = OutputRmtConfig.IntensityDataWidth; 0 < BitCount; --BitCount)
+#ifdef USE_RMT_EXPANSION_TABLE
+        uint32_t NumRmtSlots = (nullptr != pExpansionTable) ?
+            RmtEncodeIntensityExpanded (EncodeConfig, pExpansionTable->Slots, IntensityValue, !MoreDataToSend(), RmtSlots) :
+            RmtEncodeIntensityBits (EncodeConfig, IntensityValue, !MoreDataToSend(), RmtSlots);
+#else
+        uint32_t NumRmtSlots = RmtEncodeIntensityBits (EncodeConfig, IntensityValue, !MoreDataToSend(), RmtSlots);
+#endif // def USE_RMT_EXPANSION_TABLE
+        for (uint32_t SlotIndex = 0; SlotIndex < NumRmtSlots; ++SlotIndex)
         {
+            ISR_EnqueueData (RmtSlots[SlotIndex]);
+        }
+
 #ifdef USE_RMT_DEBUG_COUNTERS
-            IntensityBitsSent++;
-#endif // def USE_RMT_DEBUG_COUNTERS
-            ISR_EnqueueData((IntensityValue & bitmask) ? OneBitValue : ZeroBitValue);
-            if(OutputRmtConfig_t::DataDirection_t::MSB2LSB == OutputRmtConfig.DataDirection)
-            {
-                bitmask >>= 1;
-            }
-            else
+        for (uint32_t SlotIndex = 0; SlotIndex < NumRmtSlots; ++SlotIndex)
+        {
+            if (SlotIndex >= OutputRmtConfig.IntensityDataWidth)
             {
-                bitmask <<= 1;
+                BitTypeCounters[int((OutputRmtConfig.SendEndOfFrameBits && !MoreDataToSend()) ? RmtDataBitIdType_t::RMT_END_OF_FRAME : RmtDataBitIdType_t::RMT_STOP_START_BIT_ID)]++;
             }
-#ifdef USE_RMT_DEBUG_COUNTERS
-            if (IntensityValue & bitmask)
+            else if (RmtSlots[SlotIndex] == EncodeConfig.OneBitValue)
             {
                 BitTypeCounters[int(RmtDataBitIdType_t::RMT_DATA_BIT_ONE_ID)]++;
             }
@@ -472,23 +793,8 @@ void IRAM_ATTR c_OutputRmt::ISR_Handler_SendIntensityData ()
             {
                 BitTypeCounters[int(RmtDataBitIdType_t::RMT_DATA_BIT_ZERO_ID)]++;
             }
-#endif // def USE_RMT_DEBUG_COUNTERS
-        } // end send one intensity value
-
-        if (OutputRmtConfig.SendEndOfFrameBits && !MoreDataToSend())
-        {
-            ISR_EnqueueData(Intensity2Rmt[RmtDataBitIdType_t::RMT_END_OF_FRAME].val);
-#ifdef USE_RMT_DEBUG_COUNTERS
-            BitTypeCounters[int(RmtDataBitIdType_t::RMT_END_OF_FRAME)]++;
-#endif // def USE_RMT_DEBUG_COUNTERS
         }
-        else if (OutputRmtConfig.SendInterIntensityBits)
-        {
-            ISR_EnqueueData(Intensity2Rmt[RmtDataBitIdType_t::RMT_STOP_START_BIT_ID].val);
-#ifdef USE_RMT_DEBUG_COUNTERS
-            BitTypeCounters[int(RmtDataBitIdType_t::RMT_STOP_START_BIT_ID)]++;
 #endif // def USE_RMT_DEBUG_COUNTERS
-        }
     } // end while there is space in the buffer
 
     // terminate the current data in the buffer
@@ -512,8 +818,9 @@ bool c_OutputRmt::Render ()
             break;
         }
 
-        uint32_t Now = millis();
-        uint32_t FrameDeltaTimeMicroSeconds = (Now - LastFrameStartTime) * 1000;
+        // use micros so that short strings can run faster than one frame per ms
+        uint32_t Now = micros();
+        uint32_t FrameDeltaTimeMicroSeconds = Now - LastFrameStartTime;
         // _ DEBUG_V(String("FrameDeltaTimeMicroSeconds: ") + String(FrameDeltaTimeMicroSeconds));
         // _ DEBUG_V(String("FrameMinDurationInMicroSec: ") + String(FrameMinDurationInMicroSec));
 
@@ -537,6 +844,19 @@ bool c_OutputRmt::Render ()
         }
         LastFrameStartTime = Now;
 
+        c_OutputCommon * pDataSource = OutputRmtConfig.pPixelDataSource;
+#if defined(SUPPORT_OutputType_DMX) || defined(SUPPORT_OutputType_Serial) || defined(SUPPORT_OutputType_Renard)
+        if (nullptr == pDataSource)
+        {
+            pDataSource = OutputRmtConfig.pSerialDataSource;
+        }
+#endif // defined(SUPPORT_OutputType_DMX) || defined(SUPPORT_OutputType_Serial) || defined(SUPPORT_OutputType_Renard)
+        if ((nullptr != pDataSource) && pDataSource->SkipUnchangedFrame ())
+        {
+            // _ DEBUG_V("Nothing changed");
+            break;
+        }
+
 #ifdef USE_RMT_DEBUG_COUNTERS
         if (MoreDataToSend())
         {
@@ -564,7 +884,15 @@ bool c_OutputRmt::Render ()
         // _ DEBUG_V("Start Transmit");
         // enable the threshold event interrupt
         EnableInterrupts;
-        RMT.conf_ch[OutputRmtConfig.RmtChannelId].conf1.tx_start = 1;
+        if (RmtSynchronizedStart && (RmtNumArmedChannels < RMT_CHANNEL_MAX))
+        {
+            // _ DEBUG_V("Wait for the other channels");
+            RmtArmedChannels[RmtNumArmedChannels++] = this;
+        }
+        else
+        {
+            RMT.conf_ch[OutputRmtConfig.RmtChannelId].conf1.tx_start = 1;
+        }
         // _ DEBUG_V("Transmit Started");
         Response = true;
 
@@ -576,12 +904,78 @@ bool c_OutputRmt::Render ()
 
 } // render
 
+//----------------------------------------------------------------------------
+/*
+    When set, Render only arms a channel. The channels that were armed
+    during a pass over the drivers are then started together by
+    StartArmedChannels so that adjacent strings latch at the same time.
+*/
+void c_OutputRmt::SetSynchronizedStart (bool value)
+{
+    // DEBUG_START;
+
+    // do not leave any channel waiting
+    StartArmedChannels ();
+    RmtSynchronizedStart = value;
+
+    // DEBUG_END;
+
+} // SetSynchronizedStart
+
+//----------------------------------------------------------------------------
+/*
+    The ESP32 RMT has no simultaneous transmit control so the channels are
+    started back to back with interrupts blocked. The time each channel was
+    started relative to the first one is kept as its skew.
+*/
+void c_OutputRmt::StartArmedChannels ()
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if (0 == RmtNumArmedChannels)
+        {
+            break;
+        }
+
+        uint32_t StartTimeInCycles[RMT_CHANNEL_MAX];
+
+        portENTER_CRITICAL (&RmtSyncStartLock);
+        for (uint32_t ChannelIndex = 0; ChannelIndex < RmtNumArmedChannels; ++ChannelIndex)
+        {
+            StartTimeInCycles[ChannelIndex] = ESP.getCycleCount ();
+            RMT.conf_ch[RmtArmedChannels[ChannelIndex]->OutputRmtConfig.RmtChannelId].conf1.tx_start = 1;
+        }
+        portEXIT_CRITICAL (&RmtSyncStartLock);
+
+        uint32_t CyclesPerMicroSec = getCpuFrequencyMhz ();
+        for (uint32_t ChannelIndex = 0; ChannelIndex < RmtNumArmedChannels; ++ChannelIndex)
+        {
+            c_OutputRmt * pChannel = RmtArmedChannels[ChannelIndex];
+            pChannel->SyncStartSkewInNs    = ((StartTimeInCycles[ChannelIndex] - StartTimeInCycles[0]) * 1000) / CyclesPerMicroSec;
+            pChannel->SyncStartMaxSkewInNs = max (pChannel->SyncStartMaxSkewInNs, pChannel->SyncStartSkewInNs);
+        }
+
+        RmtNumArmedChannels = 0;
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // StartArmedChannels
+
 //----------------------------------------------------------------------------
 void c_OutputRmt::GetStatus (ArduinoJson::JsonObject& jsonStatus)
 {
     // //DEBUG_START;
 
     jsonStatus[F("NumRmtSlotOverruns")] = NumRmtSlotOverruns;
+    if (RmtSynchronizedStart)
+    {
+        jsonStatus[F("SyncStartSkewNs")]    = SyncStartSkewInNs;
+        jsonStatus[F("SyncStartMaxSkewNs")] = SyncStartMaxSkewInNs;
+    }
 #ifdef USE_RMT_DEBUG_COUNTERS
     JsonObject debugStatus = jsonStatus.createNestedObject("RMT Debug");
     debugStatus["RmtChannelId"]                 = OutputRmtConfig.RmtChannelId;
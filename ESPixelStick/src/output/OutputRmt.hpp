@@ -23,6 +23,37 @@
 #include <driver/rmt.h>
 #include "OutputPixel.hpp"
 #include "OutputSerial.hpp"
+#include "OutputRmtEncode.hpp"
+
+// How intensity data is turned into RMT slots. Override with -D RMT_ENCODE_MODE=...
+//  RMT_ENCODE_MODE_BITS        The ISR encodes one bit at a time.
+//  RMT_ENCODE_MODE_TABLE       The ISR encodes a byte at a time using a 256 entry expansion table.
+//  RMT_ENCODE_MODE_PREENCODE   As TABLE, plus the start of each frame is encoded outside of the ISR.
+// Only 8 and 16 bit intensity data can use the table. Other widths always use BITS.
+#define RMT_ENCODE_MODE_BITS        0
+#define RMT_ENCODE_MODE_TABLE       1
+#define RMT_ENCODE_MODE_PREENCODE   2
+#ifndef RMT_ENCODE_MODE
+#   define RMT_ENCODE_MODE RMT_ENCODE_MODE_PREENCODE
+#endif // ndef RMT_ENCODE_MODE
+
+#if RMT_ENCODE_MODE != RMT_ENCODE_MODE_BITS
+#   define USE_RMT_EXPANSION_TABLE
+#endif // RMT_ENCODE_MODE != RMT_ENCODE_MODE_BITS
+
+#if RMT_ENCODE_MODE == RMT_ENCODE_MODE_PREENCODE
+#   define USE_RMT_PREENCODE
+#endif // RMT_ENCODE_MODE == RMT_ENCODE_MODE_PREENCODE
+
+// Each item is 4 bytes of internal RAM per channel. Boards without PSRAM keep
+// their frame buffers in internal RAM so they only stage the first few pixels.
+#ifndef RMT_PREENCODE_NUM_ITEMS
+#   ifdef BOARD_HAS_PSRAM
+#       define RMT_PREENCODE_NUM_ITEMS 2048
+#   else
+#       define RMT_PREENCODE_NUM_ITEMS 256
+#   endif // def BOARD_HAS_PSRAM
+#endif // ndef RMT_PREENCODE_NUM_ITEMS
 
 class c_OutputRmt
 {
@@ -50,6 +81,10 @@ public:
     };
     typedef ConvertIntensityToRmtDataStreamEntry_t CitrdsArray_t;
 
+#ifdef USE_RMT_EXPANSION_TABLE
+    struct ExpansionTable_t;
+#endif // def USE_RMT_EXPANSION_TABLE
+
     struct OutputRmtConfig_t
     {
         rmt_channel_t       RmtChannelId           = rmt_channel_t(-1);
@@ -100,22 +135,40 @@ private:
     volatile rmt_item32_t *RmtEndAddr      = nullptr;
 
 #define NUM_RMT_SLOTS (sizeof(RMTMEM.chan[0].data32) / sizeof(RMTMEM.chan[0].data32[0]))
-#define MIN_FRAME_TIME_MS 25
 
     volatile uint32_t     NumAvailableRmtSlotsToFill  = NUM_RMT_SLOTS;
     const uint32_t        NumRmtSlotsPerInterrupt     = NUM_RMT_SLOTS * 0.75;
     uint32_t            LastFrameStartTime          = 0;
     uint32_t            FrameMinDurationInMicroSec  = 1000;
-    uint32_t            TxIntensityDataStartingMask = 0x80;
     RmtDataBitIdType_t  InterIntensityValueId       = RMT_INVALID_VALUE;
+    RmtEncodeConfig_t   EncodeConfig;               ///< Bit values and framing used by the encoders for the current frame
+    uint32_t            SyncStartSkewInNs           = 0;    ///< Start time relative to the first channel of the last synchronized start
+    uint32_t            SyncStartMaxSkewInNs        = 0;
 
     void                  StartNewFrame ();
+    void                  UpdateEncodeConfig ();
     inline void     IRAM_ATTR ISR_Handler_SendIntensityData ();
     inline void     IRAM_ATTR ISR_EnqueueData(uint32_t value);
     inline bool     IRAM_ATTR MoreDataToSend();
     inline uint32_t IRAM_ATTR GetNextIntensityToSend();
+    inline uint32_t IRAM_ATTR GetNextIntensities(uint8_t * pTarget, uint32_t MaxCount);
     inline void     IRAM_ATTR StartNewDataFrame();
 
+#ifdef USE_RMT_EXPANSION_TABLE
+    ExpansionTable_t      * pExpansionTable = nullptr;  ///< Byte to RMT slot translation. Shared by channels with the same timing. nullptr: encode a bit at a time
+
+    void                    UpdateExpansionTable ();
+#endif // def USE_RMT_EXPANSION_TABLE
+
+#ifdef USE_RMT_PREENCODE
+    uint32_t              * pStagingBuffer  = nullptr;  ///< RMT slots encoded outside of the ISR
+    volatile uint32_t     * pStagingCurrent = nullptr;
+    volatile uint32_t     * pStagingEnd     = nullptr;
+
+    void                    PreEncodeFrame ();
+    inline void IRAM_ATTR   ISR_SendStagedData ();
+#endif // def USE_RMT_PREENCODE
+
 #ifndef HasBeenInitialized
         bool HasBeenInitialized = false;
 #endif // ndef HasBeenInitialized
@@ -134,6 +187,8 @@ public:
     void SetMinFrameDurationInUs                (uint32_t value) { FrameMinDurationInMicroSec = value; }
     inline uint32_t IRAM_ATTR GetRmtIntMask     ()               { return ((RMT_INT_TX_END_BIT | RMT_INT_ERROR_BIT | RMT_INT_ERROR_BIT | RMT_INT_THR_EVNT_BIT)); }
     void GetDriverName                          (String &value)  { value = CN_RMT; }
+    static void SetSynchronizedStart            (bool value);
+    static void StartArmedChannels              ();
 
 #define DisableInterrupts RMT.int_ena.val &= ~(RMT_INT_TX_END_BIT | RMT_INT_THR_EVNT_BIT)
 #define EnableInterrupts  RMT.int_ena.val |=  (RMT_INT_TX_END_BIT | RMT_INT_THR_EVNT_BIT)
@@ -0,0 +1,136 @@
+#pragma once
+/*
+* OutputRmtEncode.hpp - Intensity to RMT slot encoders for the RMT output
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   These functions only depend on the standard integer types so that they
+*   can be built and checked on a host as well as on the target. RMT slots
+*   are handled as the raw 32 bit value of an rmt_item32_t.
+*
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef IRAM_ATTR
+#   define IRAM_ATTR
+#endif // ndef IRAM_ATTR
+
+// Widest intensity value (GECE uses 26 bits) plus one stop or end of frame slot
+#define RMT_ENCODE_MAX_SLOTS_PER_VALUE  (32 + 1)
+
+struct RmtEncodeConfig_t
+{
+    uint32_t    ZeroBitValue            = 0;
+    uint32_t    OneBitValue             = 0;
+    uint32_t    InterIntensityValue     = 0;
+    uint32_t    EndOfFrameValue         = 0;
+    uint32_t    IntensityDataWidth      = 8;
+    bool        MsbFirst                = true;
+    bool        SendInterIntensityBits  = false;
+    bool        SendEndOfFrameBits      = false;
+};
+
+// The RMT slots for each bit of one byte in the order they are sent
+typedef uint32_t RmtExpansionRow_t[8];
+
+//----------------------------------------------------------------------------
+/*
+    Add the end of frame or the inter intensity slot that follows an
+    intensity value. Returns the number of slots written (0 or 1).
+*/
+inline uint32_t IRAM_ATTR RmtEncodeValueTrailer (const RmtEncodeConfig_t & Config, bool LastValueInFrame, uint32_t * pTarget)
+{
+    if (Config.SendEndOfFrameBits && LastValueInFrame)
+    {
+        *pTarget = Config.EndOfFrameValue;
+        return 1;
+    }
+
+    if (Config.SendInterIntensityBits)
+    {
+        *pTarget = Config.InterIntensityValue;
+        return 1;
+    }
+
+    return 0;
+
+} // RmtEncodeValueTrailer
+
+//----------------------------------------------------------------------------
+/*
+    Encode one intensity value one bit at a time. This works for any data
+    width. pTarget must have room for RMT_ENCODE_MAX_SLOTS_PER_VALUE slots.
+    Returns the number of slots written.
+*/
+inline uint32_t IRAM_ATTR RmtEncodeIntensityBits (const RmtEncodeConfig_t & Config, uint32_t IntensityValue, bool LastValueInFrame, uint32_t * pTarget)
+{
+    uint32_t * pCurrentSlot = pTarget;
+    uint32_t   bitmask      = (Config.MsbFirst) ? (uint32_t (1) << (Config.IntensityDataWidth - 1)) : 1;
+
+    for (uint32_t BitCount = Config.IntensityDataWidth; 0 < BitCount; --BitCount)
+    {
+        *pCurrentSlot++ = (IntensityValue & bitmask) ? Config.OneBitValue : Config.ZeroBitValue;
+        bitmask = (Config.MsbFirst) ? (bitmask >> 1) : (bitmask << 1);
+    }
+
+    pCurrentSlot += RmtEncodeValueTrailer (Config, LastValueInFrame, pCurrentSlot);
+
+    return uint32_t (pCurrentSlot - pTarget);
+
+} // RmtEncodeIntensityBits
+
+//----------------------------------------------------------------------------
+inline void RmtBuildExpansionTable (uint32_t ZeroBitValue, uint32_t OneBitValue, bool MsbFirst, RmtExpansionRow_t * Slots)
+{
+    for (uint32_t ByteValue = 0; ByteValue < 256; ++ByteValue)
+    {
+        uint32_t bitmask = (MsbFirst) ? 0x80 : 0x01;
+        for (auto & CurrentSlot : Slots[ByteValue])
+        {
+            CurrentSlot = (ByteValue & bitmask) ? OneBitValue : ZeroBitValue;
+            bitmask = (MsbFirst) ? (bitmask >> 1) : (bitmask << 1);
+        }
+    }
+
+} // RmtBuildExpansionTable
+
+//----------------------------------------------------------------------------
+/*
+    Encode one 8 or 16 bit intensity value a byte at a time using a table
+    built by RmtBuildExpansionTable with the same bit values and order.
+    Used by the ISR as well. Returns the number of slots written.
+*/
+inline uint32_t IRAM_ATTR RmtEncodeIntensityExpanded (const RmtEncodeConfig_t & Config, const RmtExpansionRow_t * Slots, uint32_t IntensityValue, bool LastValueInFrame, uint32_t * pTarget)
+{
+    uint32_t * pCurrentSlot = pTarget;
+    uint32_t   Shift        = (Config.MsbFirst) ? (Config.IntensityDataWidth - 8) : 0;
+
+    for (uint32_t ByteCount = Config.IntensityDataWidth >> 3; 0 < ByteCount; --ByteCount)
+    {
+        const uint32_t * pRow = Slots[(IntensityValue >> Shift) & 0xff];
+        for (uint32_t SlotIndex = 0; SlotIndex < 8; ++SlotIndex)
+        {
+            *pCurrentSlot++ = pRow[SlotIndex];
+        }
+        Shift = (Config.MsbFirst) ? (Shift - 8) : (Shift + 8);
+    }
+
+    pCurrentSlot += RmtEncodeValueTrailer (Config, LastValueInFrame, pCurrentSlot);
+
+    return uint32_t (pCurrentSlot - pTarget);
+
+} // RmtEncodeIntensityExpanded
@@ -279,7 +279,10 @@ void c_OutputSerial::StartNewFrame ()
     FrameStartCounter++;
 #endif // def USE_SERIAL_DEBUG_COUNTERS
 
-    NextIntensityToSend = GetBufferAddress();
+    // take a stable copy of the input data before we start sending it
+    LatchFrameBuffer ();
+
+    NextIntensityToSend = pFrameBuffer;
     intensity_count     = Num_Channels;
     SentIntensityCount  = 0;
     SerialHeaderIndex   = 0;
@@ -477,4 +480,37 @@ uint32_t IRAM_ATTR c_OutputSerial::ISR_GetNextIntensityToSend ()
     return data;
 } // NextIntensityToSend
 
+//----------------------------------------------------------------------------
+/*
+    Fill the target with up to MaxCount intensities. The channel data is
+    copied in runs. The last byte of each run goes through the per byte
+    state machine so that the frame state transitions stay in one place.
+*/
+uint32_t IRAM_ATTR c_OutputSerial::ISR_GetNextIntensities (uint8_t * pTarget, uint32_t MaxCount)
+{
+    uint32_t NumIntensities = 0;
+
+    while ((NumIntensities < MaxCount) && ISR_MoreDataToSend ())
+    {
+        if (((SerialFrameState_t::DMXSendData    == SerialFrameState) ||
+             (SerialFrameState_t::GenSerSendData == SerialFrameState)) &&
+            (1 < intensity_count))
+        {
+            uint32_t RunLength = min (MaxCount - NumIntensities, intensity_count) - 1;
+            memcpy (&pTarget[NumIntensities], NextIntensityToSend, RunLength);
+            NextIntensityToSend += RunLength;
+            intensity_count     -= RunLength;
+            NumIntensities      += RunLength;
+#ifdef USE_SERIAL_DEBUG_COUNTERS
+            IntensityBytesSent  += RunLength;
+#endif // def USE_SERIAL_DEBUG_COUNTERS
+        }
+
+        pTarget[NumIntensities++] = uint8_t (ISR_GetNextIntensityToSend ());
+    }
+
+    return NumIntensities;
+
+} // ISR_GetNextIntensities
+
 #endif // defined(SUPPORT_OutputType_DMX) || defined(SUPPORT_OutputType_Serial) || defined(SUPPORT_OutputType_Renard)
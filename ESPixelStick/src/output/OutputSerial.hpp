@@ -48,6 +48,7 @@ public:
             void        StartNewFrame();
 
     uint32_t IRAM_ATTR   ISR_GetNextIntensityToSend();
+    uint32_t IRAM_ATTR   ISR_GetNextIntensities(uint8_t * pTarget, uint32_t MaxCount);
     bool     IRAM_ATTR   ISR_MoreDataToSend() { return (SerialFrameState_t::SerialIdle != SerialFrameState); }
 
 protected:
@@ -560,6 +560,23 @@ uint32_t IRAM_ATTR c_OutputUart::GetNextIntensityToSend()
     }
 } // GetNextIntensityToSend
 
+//----------------------------------------------------------------------------
+uint32_t IRAM_ATTR c_OutputUart::GetNextIntensities(uint8_t * pTarget, uint32_t MaxCount)
+{
+    if (nullptr != OutputUartConfig.pPixelDataSource)
+    {
+        return OutputUartConfig.pPixelDataSource->ISR_GetNextIntensities(pTarget, MaxCount);
+    }
+    else
+    {
+#if defined(SUPPORT_OutputType_DMX) || defined(SUPPORT_OutputType_Serial) || defined(SUPPORT_OutputType_Renard)
+        return OutputUartConfig.pSerialDataSource->ISR_GetNextIntensities(pTarget, MaxCount);
+#else
+        return 0;
+#endif // defined(SUPPORT_OutputType_DMX) || defined(SUPPORT_OutputType_Serial) || defined(SUPPORT_OutputType_Renard)
+    }
+} // GetNextIntensities
+
 //----------------------------------------------------------------------------
 void IRAM_ATTR c_OutputUart::StartNewDataFrame()
 {
@@ -720,6 +737,55 @@ void IRAM_ATTR c_OutputUart::ISR_Timer_Handler()
 } // ISR_Timer_Handler
 #endif // def ARDUINO_ARCH_ESP8266
 
+//----------------------------------------------------------------------------
+inline void IRAM_ATTR c_OutputUart::EnqueueIntensity(uint32_t IntensityValue)
+{
+    if (OutputUartConfig.TranslateIntensityData == TranslateIntensityData_t::NoTranslation)
+    {
+        for (uint32_t count = 0; count < NumUartSlotsPerIntensityValue; count++)
+        {
+            enqueueUartData(IntensityValue & 0xFF);
+            IntensityValue >>= 8;
+#ifdef USE_UART_DEBUG_COUNTERS
+            IntensityBitsSent += 8;
+#endif // def USE_UART_DEBUG_COUNTERS
+        }
+    } // end no translation
+
+    else if (OutputUartConfig.TranslateIntensityData == TranslateIntensityData_t::OneToOne)
+    { // 1:1
+        for (uint32_t mask = TxIntensityDataStartingMask; 0 != mask; mask >>= 1)
+        {
+            // convert the intensity data into UART data
+            enqueueUartData(Intensity2Uart[(IntensityValue & mask) ? UartDataBitTranslationId_t::Uart_DATA_BIT_01_ID : UartDataBitTranslationId_t::Uart_DATA_BIT_00_ID]);
+#ifdef USE_UART_DEBUG_COUNTERS
+            IntensityBitsSent += 1;
+#endif // def USE_UART_DEBUG_COUNTERS
+        }
+    } // end 1:1
+
+    else // 2:1
+    {
+        // Mask is used as a shift counter that is decremented by 2.
+        for (uint32_t NumBitsToShift = TxIntensityDataStartingMask - 2;
+             0 < NumBitsToShift;
+             NumBitsToShift -= 2)
+        {
+            // convert the intensity data into UART data
+            enqueueUartData(Intensity2Uart[(IntensityValue >> NumBitsToShift) & 0x3]);
+#ifdef USE_UART_DEBUG_COUNTERS
+            IntensityBitsSent += 2;
+#endif // def USE_UART_DEBUG_COUNTERS
+        }
+        // handle the last two bits
+        enqueueUartData(Intensity2Uart[IntensityValue & 0x3]);
+#ifdef USE_UART_DEBUG_COUNTERS
+        IntensityBitsSent += 2;
+#endif    // def USE_UART_DEBUG_COUNTERS
+    } // end 2:1
+
+} // EnqueueIntensity
+
 //----------------------------------------------------------------------------
 void IRAM_ATTR c_OutputUart::ISR_Handler_SendIntensityData ()
 {
@@ -735,58 +801,30 @@ void IRAM_ATTR c_OutputUart::ISR_Handler_SendIntensityData ()
     }
 #endif // def USE_UART_DEBUG_COUNTERS
 
-    while (MoreDataToSend() && NumAvailableIntensitySlotsToFill)
+    if ((8 == OutputUartConfig.IntensityDataWidth) && (0 == OutputUartConfig.NumInterIntensityBreakBits))
     {
-#ifdef USE_UART_DEBUG_COUNTERS
-        IntensityValuesSent++;
-#endif // def USE_UART_DEBUG_COUNTERS
-
-        NumAvailableIntensitySlotsToFill--;
-
-        uint32_t IntensityValue = GetNextIntensityToSend();
-        if (OutputUartConfig.TranslateIntensityData == TranslateIntensityData_t::NoTranslation)
+        // pull the intensities in runs instead of one at a time
+        uint8_t  IntensityData[UART_TX_FIFO_SIZE];
+        uint32_t NumIntensities = GetNextIntensities(IntensityData, min(NumAvailableIntensitySlotsToFill, uint32_t(sizeof(IntensityData))));
+        for (uint32_t Index = 0; Index < NumIntensities; ++Index)
         {
-            for (uint32_t count = 0; count < NumUartSlotsPerIntensityValue; count++)
-            {
-                enqueueUartData(IntensityValue & 0xFF);
-                IntensityValue >>= 8;
 #ifdef USE_UART_DEBUG_COUNTERS
-                IntensityBitsSent += 8;
+            IntensityValuesSent++;
 #endif // def USE_UART_DEBUG_COUNTERS
-            }
-        } // end no translation
+            EnqueueIntensity(IntensityData[Index]);
+        }
+        NumAvailableIntensitySlotsToFill = 0;
+    }
 
-        else if (OutputUartConfig.TranslateIntensityData == TranslateIntensityData_t::OneToOne)
-        { // 1:1
-            for (uint32_t mask = TxIntensityDataStartingMask; 0 != mask; mask >>= 1)
-            {
-                // convert the intensity data into UART data
-                enqueueUartData(Intensity2Uart[(IntensityValue & mask) ? UartDataBitTranslationId_t::Uart_DATA_BIT_01_ID : UartDataBitTranslationId_t::Uart_DATA_BIT_00_ID]);
+    while (MoreDataToSend() && NumAvailableIntensitySlotsToFill)
+    {
 #ifdef USE_UART_DEBUG_COUNTERS
-                IntensityBitsSent += 1;
+        IntensityValuesSent++;
 #endif // def USE_UART_DEBUG_COUNTERS
-            }
-        } // end 1:1
 
-        else // 2:1
-        {
-            // Mask is used as a shift counter that is decremented by 2.
-            for (uint32_t NumBitsToShift = TxIntensityDataStartingMask - 2;
-                 0 < NumBitsToShift;
-                 NumBitsToShift -= 2)
-            {
-                // convert the intensity data into UART data
-                enqueueUartData(Intensity2Uart[(IntensityValue >> NumBitsToShift) & 0x3]);
-#ifdef USE_UART_DEBUG_COUNTERS
-                IntensityBitsSent += 2;
-#endif // def USE_UART_DEBUG_COUNTERS
-            }
-            // handle the last two bits
-            enqueueUartData(Intensity2Uart[IntensityValue & 0x3]);
-#ifdef USE_UART_DEBUG_COUNTERS
-            IntensityBitsSent += 2;
-#endif    // def USE_UART_DEBUG_COUNTERS
-        } // end 2:1
+        NumAvailableIntensitySlotsToFill--;
+
+        EnqueueIntensity(GetNextIntensityToSend());
 
         if (OutputUartConfig.NumInterIntensityBreakBits)
         {
@@ -142,6 +142,8 @@ private:
 
     bool     IRAM_ATTR      MoreDataToSend();
     uint32_t IRAM_ATTR      GetNextIntensityToSend();
+    uint32_t IRAM_ATTR      GetNextIntensities(uint8_t * pTarget, uint32_t MaxCount);
+    inline void IRAM_ATTR   EnqueueIntensity(uint32_t IntensityValue);
     void     IRAM_ATTR      StartNewDataFrame();
     uint32_t IRAM_ATTR      getUartFifoLength();
     void     IRAM_ATTR      enqueueUartData(uint8_t value);
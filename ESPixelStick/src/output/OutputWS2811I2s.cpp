@@ -0,0 +1,120 @@
+/*
+* OutputWS2811I2s.cpp - WS2811 driver code for ESPixelStick I2S parallel lanes
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2015, 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+#include "../ESPixelStick.h"
+#if defined(SUPPORT_OutputType_WS2811) && defined(SUPPORT_I2S_OUTPUT) && defined(ARDUINO_ARCH_ESP32)
+
+#include "OutputWS2811I2s.hpp"
+
+//----------------------------------------------------------------------------
+c_OutputWS2811I2s::c_OutputWS2811I2s (c_OutputMgr::e_OutputChannelIds OutputChannelId,
+    gpio_num_t outputGpio,
+    uart_port_t uart,
+    c_OutputMgr::e_OutputType outputType) :
+    c_OutputWS2811 (OutputChannelId, outputGpio, uart, outputType)
+{
+    // DEBUG_START;
+
+    // the output manager passes the lane number in place of a uart
+    LaneId = uint32_t (uart);
+
+    // DEBUG_END;
+
+} // c_OutputWS2811I2s
+
+//----------------------------------------------------------------------------
+c_OutputWS2811I2s::~c_OutputWS2811I2s ()
+{
+    // DEBUG_START;
+
+    OutputI2s.RemoveLane (LaneId);
+
+    // DEBUG_END;
+} // ~c_OutputWS2811I2s
+
+//----------------------------------------------------------------------------
+/* Use the current config to set up the output port
+*/
+void c_OutputWS2811I2s::Begin ()
+{
+    // DEBUG_START;
+
+    c_OutputWS2811::Begin ();
+
+    // DEBUG_V (String ("DataPin: ") + String (DataPin));
+    HasBeenInitialized = OutputI2s.AddLane (LaneId, DataPin, this);
+    OutputI2s.SetMinFrameDurationInUs (LaneId, FrameMinDurationInMicroSec);
+
+    // DEBUG_END;
+
+} // Begin
+
+//----------------------------------------------------------------------------
+bool c_OutputWS2811I2s::SetConfig (ArduinoJson::JsonObject& jsonConfig)
+{
+    // DEBUG_START;
+
+    bool response = c_OutputWS2811::SetConfig (jsonConfig);
+
+    if (HasBeenInitialized)
+    {
+        // pick up a new data pin
+        OutputI2s.AddLane (LaneId, DataPin, this);
+    }
+    OutputI2s.SetMinFrameDurationInUs (LaneId, FrameMinDurationInMicroSec);
+
+    // DEBUG_END;
+    return response;
+
+} // SetConfig
+
+//----------------------------------------------------------------------------
+void c_OutputWS2811I2s::SetOutputBufferSize (uint32_t NumChannelsAvailable)
+{
+    // DEBUG_START;
+
+    c_OutputWS2811::SetOutputBufferSize (NumChannelsAvailable);
+
+    // DEBUG_V(String("FrameMinDurationInMicroSec: ") + String(FrameMinDurationInMicroSec));
+    OutputI2s.SetMinFrameDurationInUs (LaneId, FrameMinDurationInMicroSec);
+
+    // DEBUG_END;
+
+} // SetBufferSize
+
+//----------------------------------------------------------------------------
+void c_OutputWS2811I2s::GetStatus (ArduinoJson::JsonObject& jsonStatus)
+{
+    c_OutputWS2811::GetStatus (jsonStatus);
+    OutputI2s.GetStatus (jsonStatus);
+
+} // GetStatus
+
+//----------------------------------------------------------------------------
+void c_OutputWS2811I2s::Render ()
+{
+    // DEBUG_START;
+
+    // the first lane to get here starts the frame for all of the lanes
+    OutputI2s.Render ();
+
+    // DEBUG_END;
+
+} // Render
+
+#endif // defined(SUPPORT_OutputType_WS2811) && defined(SUPPORT_I2S_OUTPUT) && defined(ARDUINO_ARCH_ESP32)
@@ -27,6 +27,14 @@
 #define DEFAULT_RMT_3_GPIO      gpio_num_t::GPIO_NUM_32
 #define DEFAULT_RMT_4_GPIO      gpio_num_t::GPIO_NUM_33
 
+#ifdef SUPPORT_I2S_OUTPUT
+// I2S parallel lanes (esp32_devkitc_i2s build)
+#define DEFAULT_I2S_0_GPIO      gpio_num_t::GPIO_NUM_21
+#define DEFAULT_I2S_1_GPIO      gpio_num_t::GPIO_NUM_22
+#define DEFAULT_I2S_2_GPIO      gpio_num_t::GPIO_NUM_25
+#define DEFAULT_I2S_3_GPIO      gpio_num_t::GPIO_NUM_26
+#endif // def SUPPORT_I2S_OUTPUT
+
 // SPI Output
 #define SUPPORT_SPI_OUTPUT
 #define DEFAULT_SPI_DATA_GPIO   gpio_num_t::GPIO_NUM_16
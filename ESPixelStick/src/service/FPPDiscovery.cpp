@@ -404,6 +404,7 @@ void c_FPPDiscovery::ProcessBlankPacket ()
     if (IsEnabled)
     {
         memset (OutputMgr.GetBufferAddress(), 0x0, OutputMgr.GetBufferUsedSize ());
+        OutputMgr.SetBufferDirty ();
     }
     // DEBUG_END;
 } // ProcessBlankPacket
@@ -500,7 +501,7 @@ void c_FPPDiscovery::BuildFseqResponse (String fname, c_FileMgr::FileId fseq, St
     JsonData[F ("ID")]              = int64String (read64 (fsqHeader.id, 0));
     JsonData[F ("StepTime")]        = String (fsqHeader.stepTime);
     JsonData[F ("NumFrames")]       = String (read32 (fsqHeader.TotalNumberOfFramesInSequence, 0));
-    JsonData[F ("CompressionType")] = fsqHeader.compressionType;
+    JsonData[F ("CompressionType")] = fsqHeader.compressionType & FSEQ_COMPRESSION_TYPE_MASK;
 
     static const int TIME_STR_CHAR_COUNT = 32;
     char timeStr[TIME_STR_CHAR_COUNT];
@@ -542,7 +543,8 @@ void c_FPPDiscovery::BuildFseqResponse (String fname, c_FileMgr::FileId fseq, St
         uint8_t* RangeDataBuffer = (uint8_t*)malloc (sizeof(FSEQRawRangeEntry) * fsqHeader.numSparseRanges);
         FSEQRawRangeEntry* CurrentFSEQRangeEntry = (FSEQRawRangeEntry*)RangeDataBuffer;
 
-        FileMgr.ReadSdFile (fseq, RangeDataBuffer, sizeof (FSEQRawRangeEntry), fsqHeader.numCompressedBlocks * 8 + 32);
+        uint32_t NumCompressedBlocks = fsqHeader.numCompressedBlocks + (uint32_t (fsqHeader.compressionType & FSEQ_COMPRESSED_BLOCK_COUNT_MASK) << 4);
+        FileMgr.ReadSdFile (fseq, RangeDataBuffer, sizeof (FSEQRawRangeEntry) * fsqHeader.numSparseRanges, NumCompressedBlocks * sizeof (FSEQRawCompressedBlockEntry) + sizeof (FSEQRawHeader));
 
         for (int CurrentRangeIndex = 0;
              CurrentRangeIndex < fsqHeader.numSparseRanges;
@@ -90,10 +90,27 @@ struct FSEQRawRangeEntry
 
 struct FSEQParsedRangeEntry
 {
-    uint32_t DataOffset;
+    uint32_t DataOffset;        // within a frame in the file
     uint32_t ChannelCount;
+    uint32_t DestinationOffset; // within the output buffer
 };
 
+// One entry per compressed block. Follows the fixed header.
+struct FSEQRawCompressedBlockEntry
+{
+    uint8_t FirstFrameId[4];
+    uint8_t CompressedLength[4];
+
+} __attribute__ ((packed));
+
+// The low nibble of compressionType holds the type. The high nibble
+// holds bits 8-11 of the number of compressed blocks (v2.1+).
+#define FSEQ_COMPRESSION_TYPE_MASK          0x0F
+#define FSEQ_COMPRESSED_BLOCK_COUNT_MASK    0xF0
+#define FSEQ_COMPRESSION_NONE               0
+#define FSEQ_COMPRESSION_ZSTD               1
+#define FSEQ_COMPRESSION_ZLIB               2
+
 struct FSEQRawHeader
 {
     uint8_t  header[4];    // PSEQ
@@ -124,7 +141,7 @@ struct FSEQParsedHeader
     uint8_t  stepTime;
     uint8_t  flags;
     uint8_t  compressionType;
-    uint8_t  numCompressedBlocks;
+    uint16_t numCompressedBlocks;  // includes the extension bits from compressionType
     uint8_t  numSparseRanges;
     uint8_t  flags2;
     uint64_t id;
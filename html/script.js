@@ -1180,6 +1180,7 @@ function wsConnect() {
                 //   DO_RESET        = '6',
                 //   DO_FACTORYRESET = '7',
                 //   PING            = 'P',
+                //   RESET_TIMING_STATS = 'R',
 
                 if (event.data.startsWith("X")) {
                     switch (event.data[1]) {
@@ -1571,6 +1572,12 @@ function ProcessReceivedJsonStatusMessage(data) {
         $('#chanlim').text(InputStatus.e131.unichanlim);
         $('#perr').text(InputStatus.e131.packet_errors);
         $('#clientip').text(int2ip(parseInt(InputStatus.e131.last_clientIP)));
+        if (InputStatus.e131.multicastlimited) {
+            $('#multicast').text("Unicast only (more than " + InputStatus.e131.multicastmaxgroups + " universes)");
+        }
+        else {
+            $('#multicast').text(InputStatus.e131.multicastgroups + " groups joined");
+        }
     }
     else {
         $('#E131Status').addClass("hidden")
@@ -1585,6 +1592,8 @@ function ProcessReceivedJsonStatusMessage(data) {
         $('#an_chanlim').text(InputStatus.Artnet.unichanlim);
         $('#an_perr').text(InputStatus.Artnet.packet_errors);
         $('#an_clientip').text(InputStatus.Artnet.last_clientIP);
+        $('#an_syncedframes').text(InputStatus.Artnet.syncedframes);
+        $('#an_synctimeouts').text(InputStatus.Artnet.synctimeouts);
     }
     else {
         $('#ArtnetStatus').addClass("hidden")
@@ -1596,6 +1605,9 @@ function ProcessReceivedJsonStatusMessage(data) {
         $('#ddppacketsreceived').text(InputStatus.ddp.packetsreceived);
         $('#ddpbytesreceived').text(InputStatus.ddp.bytesreceived);
         $('#ddperrors').text(InputStatus.ddp.errors);
+        $('#ddpframespushed').text(InputStatus.ddp.framespushed);
+        $('#ddppartialframes').text(InputStatus.ddp.partialframes);
+        $('#ddpincompleteframes').text(InputStatus.ddp.incompleteframes);
     }
     else {
         $('#ddpStatus').addClass("hidden")
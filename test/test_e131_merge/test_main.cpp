@@ -0,0 +1,175 @@
+/*
+* test_main.cpp - Host checks for the E1.31 HTP merge
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The word at a time merge must give the same result as taking the
+*   highest value of each channel one byte at a time.
+*
+*   Run with: pio test -e native -f test_e131_merge
+*
+*/
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "input/InputE131Merge.hpp"
+
+//----------------------------------------------------------------------------
+static uint32_t ReferenceMaxBytes (uint32_t a, uint32_t b)
+{
+    uint32_t Response = 0;
+    for (uint32_t Shift = 0; Shift < 32; Shift += 8)
+    {
+        uint32_t ByteA = (a >> Shift) & 0xff;
+        uint32_t ByteB = (b >> Shift) & 0xff;
+        Response |= ((ByteA > ByteB) ? ByteA : ByteB) << Shift;
+    }
+    return Response;
+
+} // ReferenceMaxBytes
+
+//----------------------------------------------------------------------------
+void setUp ()
+{
+} // setUp
+
+//----------------------------------------------------------------------------
+void tearDown ()
+{
+} // tearDown
+
+//----------------------------------------------------------------------------
+static void test_every_byte_pair ()
+{
+    // each pair of byte values in each byte lane, with different neighbours
+    for (uint32_t a = 0; a < 256; ++a)
+    {
+        for (uint32_t b = 0; b < 256; ++b)
+        {
+            for (uint32_t Lane = 0; Lane < 4; ++Lane)
+            {
+                uint32_t Shift = Lane * 8;
+                uint32_t WordA = (a << Shift) | (0x7f80ff00 & ~(0xffu << Shift));
+                uint32_t WordB = (b << Shift) | (0x80ff007f & ~(0xffu << Shift));
+                uint32_t Expected = ReferenceMaxBytes (WordA, WordB);
+
+                if (Expected != E131MaxBytes (WordA, WordB))
+                {
+                    char Msg[64];
+                    snprintf (Msg, sizeof (Msg), "a 0x%02x b 0x%02x lane %u", a, b, Lane);
+                    TEST_FAIL_MESSAGE (Msg);
+                }
+            }
+        }
+    }
+
+} // test_every_byte_pair
+
+//----------------------------------------------------------------------------
+static void test_random_words ()
+{
+    uint32_t Seed = 0x12345678;
+    for (uint32_t Count = 0; Count < 100000; ++Count)
+    {
+        Seed = (Seed * 1103515245) + 12345;
+        uint32_t a = Seed ^ (Seed << 13);
+        Seed = (Seed * 1103515245) + 12345;
+        uint32_t b = Seed ^ (Seed >> 7);
+
+        TEST_ASSERT_EQUAL_HEX32 (ReferenceMaxBytes (a, b), E131MaxBytes (a, b));
+        TEST_ASSERT_EQUAL_HEX32 (E131MaxBytes (a, b), E131MaxBytes (b, a));
+    }
+
+} // test_random_words
+
+//----------------------------------------------------------------------------
+static void test_merge_universe ()
+{
+    const uint32_t NumBytes = 512;
+    std::vector<uint8_t> Target (NumBytes);
+    std::vector<uint8_t> Source (NumBytes);
+    std::vector<uint8_t> Expected (NumBytes);
+
+    for (uint32_t Index = 0; Index < NumBytes; ++Index)
+    {
+        Target[Index]   = uint8_t (Index * 7);
+        Source[Index]   = uint8_t (Index * 13 + 5);
+        Expected[Index] = (Target[Index] > Source[Index]) ? Target[Index] : Source[Index];
+    }
+
+    std::vector<uint32_t> TargetWords (NumBytes / sizeof (uint32_t));
+    std::vector<uint32_t> SourceWords (NumBytes / sizeof (uint32_t));
+    memcpy (TargetWords.data (), Target.data (), NumBytes);
+    memcpy (SourceWords.data (), Source.data (), NumBytes);
+
+    E131MergeWordsHtp (TargetWords.data (), SourceWords.data (), TargetWords.size ());
+    TEST_ASSERT_EQUAL_MEMORY (Expected.data (), TargetWords.data (), NumBytes);
+
+} // test_merge_universe
+
+//----------------------------------------------------------------------------
+static void bench_merge ()
+{
+    const uint32_t NumWords   = 512 / sizeof (uint32_t);
+    const uint32_t Iterations = 20000;
+    std::vector<uint32_t> Target (NumWords, 0x10203040);
+    std::vector<uint32_t> Source (NumWords, 0x40302010);
+    volatile uint32_t Sink = 0;
+
+    auto Start = std::chrono::steady_clock::now ();
+    for (uint32_t Pass = 0; Pass < Iterations; ++Pass)
+    {
+        uint8_t * pTarget = (uint8_t *)Target.data ();
+        const uint8_t * pSource = (const uint8_t *)Source.data ();
+        Source[Pass % NumWords] = Pass;
+        for (uint32_t Index = 0; Index < (NumWords * sizeof (uint32_t)); ++Index)
+        {
+            pTarget[Index] = (pTarget[Index] > pSource[Index]) ? pTarget[Index] : pSource[Index];
+        }
+        Sink = Sink + Target[Pass % NumWords];
+    }
+    double BytesUs = std::chrono::duration<double, std::micro> (std::chrono::steady_clock::now () - Start).count ();
+
+    Start = std::chrono::steady_clock::now ();
+    for (uint32_t Pass = 0; Pass < Iterations; ++Pass)
+    {
+        Source[Pass % NumWords] = Pass;
+        E131MergeWordsHtp (Target.data (), Source.data (), NumWords);
+        Sink = Sink + Target[Pass % NumWords];
+    }
+    double WordsUs = std::chrono::duration<double, std::micro> (std::chrono::steady_clock::now () - Start).count ();
+
+    char Msg[128];
+    snprintf (Msg, sizeof (Msg), "byte at a time: %.2f us/universe, word at a time: %.2f us/universe",
+              BytesUs / Iterations, WordsUs / Iterations);
+    TEST_MESSAGE (Msg);
+
+} // bench_merge
+
+//----------------------------------------------------------------------------
+int main (int, char **)
+{
+    UNITY_BEGIN ();
+    RUN_TEST (test_every_byte_pair);
+    RUN_TEST (test_random_words);
+    RUN_TEST (test_merge_universe);
+    RUN_TEST (bench_merge);
+    return UNITY_END ();
+
+} // main
@@ -0,0 +1,660 @@
+// Generated by make_test_data.py. Do not edit.
+#pragma once
+
+#define TEST_FSEQ_NUM_CHANNELS 300
+#define TEST_FSEQ_NUM_FRAMES   160
+
+static const uint8_t FseqZlib[1625] =
+{
+    0x50, 0x53, 0x45, 0x51, 0x40, 0x00, 0x01, 0x02, 0x40, 0x00, 0x2c, 0x01, 0x00, 0x00, 0xa0, 0x00,
+    0x00, 0x00, 0x19, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x9c, 0xe5, 0x96, 0x11, 0x58, 0x43, 0x51, 0x18, 0x86, 0x93, 0xc9, 0x64, 0x92, 0x24, 0xc9,
+    0x24, 0x99, 0x24, 0x93, 0x49, 0x92, 0x4c, 0x26, 0x49, 0x92, 0x24, 0xc9, 0x24, 0x99, 0x4c, 0x26,
+    0xc9, 0x64, 0x32, 0x49, 0x92, 0xe4, 0x93, 0x49, 0x32, 0x99, 0x24, 0xc9, 0x64, 0x92, 0x24, 0xc9,
+    0x24, 0x99, 0xcc, 0xdb, 0x19, 0xf4, 0x5c, 0xb9, 0xfd, 0x3f, 0x7c, 0xf6, 0xfa, 0xf9, 0x9e, 0x73,
+    0xef, 0xff, 0x9d, 0x73, 0xde, 0x57, 0x8d, 0x66, 0xeb, 0xf4, 0xec, 0xbc, 0x7d, 0xd1, 0xb9, 0xec,
+    0xf6, 0xae, 0xae, 0xfb, 0x83, 0x9b, 0xdb, 0xbb, 0xfb, 0x87, 0xe1, 0xe3, 0x68, 0x3c, 0x79, 0x9a,
+    0xce, 0xe6, 0xcf, 0x2f, 0xaf, 0x5a, 0xbc, 0x69, 0xf5, 0xfe, 0xb1, 0xde, 0x7c, 0x7e, 0x7d, 0x6f,
+    0x7f, 0x76, 0xfb, 0x93, 0x9a, 0x84, 0xaa, 0x89, 0x65, 0x4d, 0x42, 0xb5, 0x7b, 0x54, 0x12, 0xaa,
+    0xdd, 0xa3, 0x92, 0x50, 0xed, 0x1e, 0x95, 0x84, 0x6a, 0xf7, 0xa8, 0x24, 0xf4, 0xcf, 0x9f, 0xff,
+    0x25, 0x74, 0x48, 0xb4, 0x14, 0x0d, 0xaa, 0x2c, 0x57, 0x34, 0xa8, 0x92, 0x50, 0x34, 0xa8, 0x92,
+    0x50, 0x34, 0xa8, 0x92, 0x50, 0x5c, 0xdf, 0x72, 0xa5, 0xb8, 0xbe, 0xd1, 0x58, 0x71, 0x7d, 0xdd,
+    0x9e, 0xe2, 0xfa, 0x76, 0x7b, 0x35, 0x9a, 0xe7, 0x6d, 0x45, 0x83, 0x2a, 0xcb, 0x15, 0x0d, 0xaa,
+    0x24, 0x14, 0x0d, 0xaa, 0x24, 0x14, 0x0d, 0xaa, 0x24, 0x14, 0xd7, 0xb7, 0xde, 0x28, 0xae, 0x6f,
+    0x3a, 0x53, 0x5c, 0x5f, 0x7f, 0xa0, 0xb8, 0xbe, 0xe6, 0xe1, 0x50, 0x1d, 0x96, 0x2b, 0x71, 0x2d,
+    0x76, 0x4a, 0x5c, 0x8b, 0x85, 0x12, 0xd7, 0x62, 0xa8, 0xc4, 0xb5, 0xe8, 0x28, 0x71, 0x2d, 0xb6,
+    0x8a, 0xeb, 0x4b, 0x0c, 0xaa, 0x24, 0x94, 0x49, 0x1c, 0xdf, 0x0f, 0x65, 0x36, 0x50, 0xe6, 0x93,
+    0x94, 0xb8, 0x16, 0x13, 0x65, 0x7e, 0x42, 0x99, 0xdf, 0x56, 0x66, 0x50, 0x4a, 0xbc, 0xb5, 0x23,
+    0x65, 0x46, 0x7b, 0x5c, 0xae, 0x4c, 0x13, 0xca, 0x74, 0xa7, 0xc4, 0xb5, 0x98, 0x2b, 0xd3, 0xb6,
+    0x32, 0xe7, 0x43, 0x99, 0x13, 0xa5, 0xc4, 0x5b, 0x3b, 0x55, 0xe2, 0x0c, 0x52, 0x18, 0x16, 0x7e,
+    0x95, 0xe2, 0xfa, 0x28, 0x0c, 0x73, 0x88, 0x11, 0x85, 0x61, 0x0e, 0x31, 0xa2, 0x30, 0xcc, 0x21,
+    0x46, 0x14, 0x86, 0x39, 0xc4, 0x88, 0xc2, 0x30, 0x87, 0x18, 0x51, 0x18, 0xe6, 0x10, 0x23, 0x0a,
+    0xc3, 0x1c, 0x62, 0x44, 0x61, 0x98, 0x43, 0x8c, 0x28, 0x0c, 0x73, 0x88, 0x11, 0x85, 0x61, 0x0e,
+    0x31, 0xa2, 0x30, 0xcc, 0x21, 0x46, 0x14, 0x86, 0x39, 0xc4, 0x88, 0xc2, 0x30, 0x87, 0x18, 0x51,
+    0x18, 0xe6, 0x10, 0x23, 0x0a, 0xc3, 0x1c, 0x62, 0x44, 0x61, 0x98, 0x43, 0x8c, 0x28, 0x0c, 0x73,
+    0x88, 0x11, 0x85, 0x61, 0x0e, 0x31, 0xa2, 0x30, 0xcc, 0x21, 0x46, 0x14, 0x86, 0x39, 0xc4, 0x88,
+    0xc2, 0x30, 0x87, 0x18, 0x51, 0x18, 0xe6, 0x10, 0x23, 0x0a, 0xc3, 0x1c, 0x62, 0x44, 0x61, 0x98,
+    0x43, 0x8c, 0x28, 0x0c, 0x73, 0x88, 0x11, 0x85, 0x61, 0x0e, 0x31, 0xa2, 0x30, 0xcc, 0x21, 0x46,
+    0x14, 0x86, 0x39, 0xc4, 0x88, 0xc2, 0x30, 0x87, 0x18, 0x51, 0x18, 0xe6, 0x10, 0x23, 0x0a, 0xc3,
+    0x1c, 0x62, 0x44, 0x61, 0x98, 0x43, 0x8c, 0x28, 0x0c, 0x73, 0x88, 0x11, 0x85, 0x61, 0x0e, 0x31,
+    0xa2, 0x30, 0xcc, 0x21, 0x46, 0x14, 0x86, 0x39, 0xc4, 0x88, 0xc2, 0x30, 0x87, 0x18, 0x51, 0x18,
+    0xe6, 0x10, 0x23, 0x0a, 0xc3, 0x1c, 0x62, 0x44, 0x61, 0x98, 0x43, 0x8c, 0x28, 0x0c, 0x73, 0x88,
+    0x11, 0x85, 0x61, 0x0e, 0x31, 0xa2, 0x30, 0xcc, 0x21, 0x46, 0x14, 0x86, 0x39, 0xc4, 0x88, 0xc2,
+    0x30, 0x87, 0x18, 0x51, 0x18, 0xe6, 0x10, 0x23, 0x0a, 0xc3, 0x1c, 0x62, 0x44, 0x61, 0x98, 0x43,
+    0x8c, 0x28, 0x0c, 0x73, 0x88, 0x11, 0x85, 0x61, 0x0e, 0x31, 0xa2, 0x30, 0xcc, 0x21, 0x46, 0x14,
+    0x86, 0x39, 0xc4, 0x88, 0xc2, 0x30, 0x87, 0x18, 0x51, 0x18, 0xe6, 0x10, 0x23, 0x0a, 0xc3, 0x1c,
+    0x62, 0x44, 0x61, 0x98, 0x43, 0x8c, 0x28, 0x0c, 0x73, 0x88, 0xd1, 0x2f, 0x6f, 0x54, 0x48, 0x2b,
+    0x78, 0x9c, 0xe5, 0x96, 0x1f, 0x54, 0xc4, 0x41, 0x14, 0x85, 0x93, 0x24, 0x49, 0x92, 0x24, 0x49,
+    0x92, 0x24, 0x49, 0x92, 0x24, 0x59, 0x49, 0x92, 0x24, 0x49, 0x56, 0x56, 0x56, 0x92, 0x95, 0x24,
+    0x59, 0x49, 0x56, 0x56, 0x56, 0x92, 0x2b, 0x49, 0x92, 0x24, 0x49, 0x92, 0xac, 0x24, 0x49, 0x92,
+    0x24, 0x49, 0xde, 0xd9, 0x73, 0xfa, 0x33, 0x0b, 0xf3, 0x9b, 0x0b, 0xd7, 0x3e, 0x9f, 0x7b, 0xde,
+    0x99, 0x37, 0xf3, 0xde, 0xf7, 0xcd, 0x5f, 0x5e, 0xdf, 0xde, 0x3f, 0x3e, 0xbf, 0x56, 0x56, 0xd7,
+    0xd6, 0x37, 0x36, 0xb7, 0xb6, 0x77, 0x76, 0xf7, 0xf6, 0x0f, 0x0e, 0x8f, 0x7a, 0xc7, 0x27, 0xa7,
+    0x3a, 0xef, 0x0f, 0x86, 0x17, 0xa3, 0xcb, 0xab, 0xf1, 0xf5, 0x64, 0x3a, 0xbb, 0xd1, 0xed, 0xdd,
+    0xfd, 0xc3, 0xe3, 0xd3, 0xf3, 0x7c, 0x29, 0xa1, 0x32, 0x71, 0x56, 0x49, 0xa8, 0x5a, 0xa3, 0x48,
+    0xa8, 0x5a, 0xa3, 0x48, 0xa8, 0x5a, 0xa3, 0x48, 0xa8, 0x5a, 0xa3, 0x48, 0xa8, 0x5a, 0xa3, 0x48,
+    0x68, 0xa9, 0x46, 0xd7, 0x71, 0xb5, 0x1a, 0xb5, 0x48, 0xa8, 0xd5, 0xa8, 0x45, 0x42, 0xad, 0x46,
+    0x75, 0xd7, 0x28, 0x12, 0x72, 0x12, 0x72, 0x6a, 0xa8, 0xfd, 0x7c, 0x93, 0xa9, 0xca, 0x44, 0xe7,
+    0x71, 0x39, 0x97, 0x90, 0x73, 0x6d, 0x39, 0x8d, 0x52, 0xab, 0x51, 0x8b, 0x84, 0x9c, 0xd6, 0xca,
+    0x79, 0x0c, 0x39, 0xcf, 0xa7, 0x22, 0xd1, 0x7d, 0x5c, 0xce, 0x6b, 0xcb, 0xf9, 0x1f, 0x72, 0x7e,
+    0x94, 0x8c, 0xb1, 0x18, 0xcb, 0xf9, 0x83, 0x72, 0x7e, 0xad, 0x9c, 0x7f, 0xae, 0xff, 0x44, 0xe3,
+    0xb8, 0x8c, 0xb1, 0xe8, 0xcb, 0x19, 0x24, 0x39, 0xa3, 0x27, 0x63, 0x2c, 0x66, 0x72, 0x86, 0x55,
+    0xce, 0x78, 0xcb, 0x59, 0x08, 0xfa, 0x4b, 0xb4, 0xfa, 0x2a, 0x63, 0x2c, 0x46, 0x72, 0x36, 0x8e,
+    0x9c, 0x1d, 0x25, 0x67, 0xab, 0xa9, 0xfd, 0x7c, 0x83, 0xa1, 0x9c, 0x3d, 0x28, 0x67, 0x73, 0xea,
+    0x37, 0x41, 0x61, 0x58, 0x25, 0x21, 0x07, 0x31, 0xfa, 0x49, 0x50, 0x18, 0x96, 0x10, 0x23, 0x0a,
+    0xc3, 0x12, 0x62, 0x44, 0x61, 0x58, 0x42, 0x8c, 0x28, 0x0c, 0x4b, 0x88, 0x11, 0x85, 0x61, 0x09,
+    0x31, 0xa2, 0x30, 0x2c, 0x21, 0x46, 0x14, 0x86, 0x25, 0xc4, 0x88, 0xc2, 0xb0, 0x84, 0x18, 0x51,
+    0x18, 0x96, 0x10, 0x23, 0x0a, 0xc3, 0x12, 0x62, 0x44, 0x61, 0x58, 0x42, 0x8c, 0x28, 0x0c, 0x4b,
+    0x88, 0x11, 0x85, 0x61, 0x09, 0x31, 0xa2, 0x30, 0x2c, 0x21, 0x46, 0x14, 0x86, 0x25, 0xc4, 0x88,
+    0xc2, 0xb0, 0x84, 0x18, 0x51, 0x18, 0x96, 0x10, 0x23, 0x0a, 0xc3, 0x12, 0x62, 0x44, 0x61, 0x58,
+    0x42, 0x8c, 0x28, 0x0c, 0x4b, 0x88, 0x11, 0x85, 0x61, 0x09, 0x31, 0xa2, 0x30, 0x2c, 0x21, 0x46,
+    0x14, 0x86, 0x25, 0xc4, 0x88, 0xc2, 0xb0, 0x84, 0x18, 0x51, 0x18, 0x96, 0x10, 0x23, 0x0a, 0xc3,
+    0x12, 0x62, 0x44, 0x61, 0x58, 0x42, 0x8c, 0x28, 0x0c, 0x4b, 0x88, 0x11, 0x85, 0x61, 0x09, 0x31,
+    0xa2, 0x30, 0x2c, 0x21, 0x46, 0x14, 0x86, 0x25, 0xc4, 0x88, 0xc2, 0xb0, 0x84, 0x18, 0x51, 0x18,
+    0x96, 0x10, 0x23, 0x0a, 0xc3, 0x12, 0x62, 0x44, 0x61, 0x58, 0x42, 0x8c, 0x28, 0x0c, 0x4b, 0x88,
+    0x11, 0x85, 0x61, 0x09, 0x31, 0xa2, 0x30, 0x2c, 0x21, 0x46, 0x14, 0x86, 0x25, 0xc4, 0x88, 0xc2,
+    0xb0, 0x84, 0x18, 0x51, 0x18, 0x96, 0x10, 0x23, 0x0a, 0xc3, 0x12, 0x62, 0x44, 0x61, 0x58, 0x42,
+    0x8c, 0x28, 0x0c, 0x4b, 0x88, 0x11, 0x85, 0x61, 0x09, 0x31, 0xa2, 0x30, 0x2c, 0x21, 0x46, 0x14,
+    0x86, 0x25, 0xc4, 0x88, 0xc2, 0xb0, 0x84, 0x18, 0x51, 0x18, 0x96, 0x10, 0x23, 0x0a, 0xc3, 0x12,
+    0x62, 0x44, 0x61, 0x58, 0x42, 0x8c, 0x28, 0x0c, 0x4b, 0x88, 0x11, 0x85, 0x61, 0x09, 0x31, 0xa2,
+    0x30, 0x2c, 0x21, 0x46, 0x14, 0x86, 0x25, 0xc4, 0x88, 0xc2, 0xb0, 0x84, 0x18, 0x51, 0x18, 0x96,
+    0x10, 0xa3, 0x6f, 0xf3, 0x0c, 0x44, 0xa7, 0x78, 0x9c, 0xe5, 0x96, 0x11, 0x74, 0x82, 0x61, 0x14,
+    0x86, 0x93, 0x64, 0x92, 0x24, 0xc9, 0x24, 0x99, 0x4c, 0x92, 0x49, 0x92, 0x4c, 0x26, 0x49, 0x92,
+    0x4c, 0x92, 0x64, 0x92, 0x4c, 0x92, 0x24, 0x99, 0x24, 0x49, 0x32, 0x49, 0x1e, 0x99, 0x24, 0x93,
+    0x5f, 0x92, 0x64, 0x92, 0x24, 0xc9, 0x24, 0x49, 0x26, 0xf9, 0xf6, 0xd9, 0xbf, 0xd3, 0xf7, 0x9f,
+    0x7b, 0xe1, 0xda, 0xeb, 0xdf, 0x7b, 0xee, 0x39, 0xf7, 0x9e, 0xf7, 0x7b, 0x1e, 0x3e, 0x36, 0x9f,
+    0xc5, 0x76, 0xf7, 0xb5, 0x3f, 0x1c, 0xbf, 0x4f, 0xe7, 0x9f, 0x4b, 0x8d, 0x9b, 0x46, 0xb3, 0x75,
+    0xdb, 0xbe, 0xbb, 0xef, 0x3c, 0x74, 0x7b, 0x8f, 0x4f, 0xfd, 0xc1, 0xf0, 0x79, 0x34, 0x7e, 0x99,
+    0xbc, 0x4e, 0x67, 0xf3, 0xb7, 0xc5, 0x72, 0xf5, 0xbe, 0xe6, 0x2f, 0x41, 0x39, 0x51, 0xaf, 0x48,
+    0x50, 0x4e, 0x14, 0x15, 0x09, 0x2a, 0x67, 0x94, 0x12, 0x54, 0xce, 0x28, 0x25, 0xa8, 0x9c, 0x51,
+    0x4a, 0x50, 0x39, 0xa3, 0x94, 0xa0, 0x62, 0xc6, 0xf5, 0x73, 0xac, 0x45, 0xa5, 0x04, 0xd6, 0xa2,
+    0x52, 0x02, 0x6b, 0x51, 0x29, 0x81, 0xb5, 0xa8, 0x94, 0xc0, 0x3e, 0x5f, 0xb1, 0xc5, 0x3e, 0xdf,
+    0x74, 0x86, 0x7d, 0xbe, 0x6e, 0x8f, 0xfc, 0x8c, 0xcc, 0x73, 0xac, 0x45, 0xa5, 0x04, 0xd6, 0xa2,
+    0x52, 0x02, 0x6b, 0x51, 0x29, 0x81, 0xb5, 0xa8, 0x94, 0xc0, 0x3e, 0xdf, 0xfe, 0x80, 0x7d, 0xbe,
+    0xc5, 0x12, 0xfb, 0x7c, 0xfd, 0x01, 0xd9, 0x19, 0xb9, 0xe7, 0x38, 0x6a, 0x71, 0xc1, 0x51, 0x8b,
+    0x0d, 0x8e, 0x5a, 0x4c, 0x70, 0xd4, 0xa2, 0x83, 0x7d, 0xbe, 0xd3, 0x19, 0xfb, 0x7c, 0x6b, 0xb0,
+    0xcf, 0x37, 0x1a, 0x93, 0x9b, 0x91, 0x7d, 0x8e, 0xa3, 0x16, 0x0d, 0x1c, 0xb5, 0xd8, 0xe1, 0xa8,
+    0xc5, 0x1c, 0x47, 0x2d, 0x1e, 0xb1, 0xcf, 0x57, 0xab, 0xe3, 0xf8, 0x6b, 0x0b, 0x1c, 0x7f, 0xed,
+    0x94, 0xcc, 0x8c, 0xfc, 0x73, 0x1c, 0xb5, 0x68, 0xe3, 0xa8, 0xc5, 0x11, 0x47, 0x2d, 0x56, 0x38,
+    0x6a, 0x31, 0xc4, 0x3e, 0x5f, 0xb3, 0x85, 0xe3, 0xaf, 0xdd, 0xe3, 0xf8, 0x6b, 0x17, 0x5c, 0xcf,
+    0x50, 0x61, 0xd8, 0xbf, 0x04, 0x8e, 0xbf, 0x36, 0x33, 0x43, 0x85, 0x61, 0x11, 0x62, 0xa4, 0xc2,
+    0xb0, 0x08, 0x31, 0x52, 0x61, 0x58, 0x84, 0x18, 0xa9, 0x30, 0x2c, 0x42, 0x8c, 0x54, 0x18, 0x16,
+    0x21, 0x46, 0x2a, 0x0c, 0x8b, 0x10, 0x23, 0x15, 0x86, 0x45, 0x88, 0x91, 0x0a, 0xc3, 0x22, 0xc4,
+    0x48, 0x85, 0x61, 0x11, 0x62, 0xa4, 0xc2, 0xb0, 0x08, 0x31, 0x52, 0x61, 0x58, 0x84, 0x18, 0xa9,
+    0x30, 0x2c, 0x42, 0x8c, 0x54, 0x18, 0x16, 0x21, 0x46, 0x2a, 0x0c, 0x8b, 0x10, 0x23, 0x15, 0x86,
+    0x45, 0x88, 0x91, 0x0a, 0xc3, 0x22, 0xc4, 0x48, 0x85, 0x61, 0x11, 0x62, 0xa4, 0xc2, 0xb0, 0x08,
+    0x31, 0x52, 0x61, 0x58, 0x84, 0x18, 0xa9, 0x30, 0x2c, 0x42, 0x8c, 0x54, 0x18, 0x16, 0x21, 0x46,
+    0x2a, 0x0c, 0x8b, 0x10, 0x23, 0x15, 0x86, 0x45, 0x88, 0x91, 0x0a, 0xc3, 0x22, 0xc4, 0x48, 0x85,
+    0x61, 0x11, 0x62, 0xf4, 0x0b, 0xe1, 0xbb, 0x22, 0x3b,
+};
+
+static const uint8_t FseqZlibSmallWindow[4631] =
+{
+    0x50, 0x53, 0x45, 0x51, 0x40, 0x00, 0x01, 0x02, 0x40, 0x00, 0x2c, 0x01, 0x00, 0x00, 0xa0, 0x00,
+    0x00, 0x00, 0x19, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x06, 0x07, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0xca, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x91, 0x8d, 0x92, 0x1f, 0x5c, 0xf3, 0x61, 0x14, 0x47, 0x93, 0x24, 0x49, 0x5e, 0x49, 0x92,
+    0x24, 0x49, 0x92, 0x64, 0x92, 0x24, 0xc9, 0x24, 0x49, 0x92, 0x24, 0x99, 0x4c, 0x26, 0x93, 0x64,
+    0x32, 0x49, 0x92, 0x49, 0x92, 0x1c, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x49, 0x92,
+    0x24, 0xf3, 0x77, 0xdf, 0xf6, 0xfe, 0x59, 0xb5, 0xdf, 0xce, 0xf5, 0x7b, 0x3e, 0xf7, 0x79, 0xce,
+    0xb9, 0xac, 0xae, 0xad, 0xff, 0xda, 0xd8, 0xdc, 0xda, 0xde, 0xd9, 0xdd, 0x6b, 0xed, 0x1f, 0x1c,
+    0xb6, 0x8f, 0x8e, 0x4f, 0x4e, 0xcf, 0x3a, 0xdd, 0x5e, 0xff, 0x7c, 0x30, 0xbc, 0xb8, 0x1c, 0x5d,
+    0x5d, 0x73, 0x73, 0xcb, 0xfd, 0xc3, 0xe3, 0xd3, 0xf3, 0xcb, 0xeb, 0xf8, 0xed, 0xfd, 0x63, 0xb2,
+    0xd2, 0x40, 0x30, 0x4f, 0xdc, 0x35, 0x10, 0x34, 0xee, 0x98, 0x23, 0x68, 0xdc, 0x31, 0x47, 0xd0,
+    0xb8, 0x63, 0x8e, 0xa0, 0x71, 0xc7, 0x1c, 0xc1, 0x92, 0x9f, 0xff, 0x23, 0x98, 0x12, 0xeb, 0x98,
+    0xa8, 0x8c, 0x63, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0xe0, 0xf9, 0xee, 0xee, 0xf1,
+    0x7c, 0xbd, 0x3e, 0x9e, 0x6f, 0xaf, 0x85, 0xe7, 0xfb, 0x98, 0xb0, 0xba, 0xb6, 0xb9, 0x85, 0x89,
+    0xca, 0x38, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x9e, 0xef, 0xe9, 0x19, 0xcf,
+    0x37, 0xbc, 0xc0, 0xf3, 0x1d, 0xb6, 0xf1, 0x7c, 0x6b, 0xd3, 0xa3, 0x9a, 0x8e, 0xa3, 0x07, 0x38,
+    0x1d, 0xc7, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0xf3, 0x8d, 0xdf, 0xf0, 0x7c,
+    0x05, 0x51, 0x21, 0xa8, 0x10, 0x64, 0x9c, 0xca, 0x02, 0x2a, 0x4f, 0xc2, 0x44, 0x85, 0xa0, 0xf2,
+    0x09, 0x2a, 0xdf, 0xa6, 0x22, 0x0a, 0xcf, 0xd7, 0xed, 0x51, 0x51, 0xfb, 0x39, 0x4e, 0xa5, 0x04,
+    0x95, 0x76, 0x98, 0xa8, 0x10, 0x54, 0x6a, 0x53, 0xb9, 0x0f, 0x2a, 0x17, 0x85, 0xe7, 0x1b, 0x0c,
+    0x29, 0xdc, 0xe0, 0x6c, 0x9c, 0xca, 0xc9, 0x52, 0x39, 0x72, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08,
+    0x3c, 0xdf, 0xd6, 0x36, 0x9e, 0xef, 0x75, 0x8c, 0xe7, 0x1b, 0x5d, 0xe1, 0xf9, 0xfe, 0x8c, 0xa3,
+    0x07, 0x38, 0x1d, 0xc7, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0xf3, 0xed, 0xb5,
+    0xf0, 0x7c, 0x1f, 0x13, 0x3c, 0xdf, 0xcd, 0x2d, 0x9a, 0xef, 0xef, 0x38, 0x26, 0x2a, 0xe3, 0x98,
+    0xa8, 0x10, 0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10, 0x78, 0xbe, 0xc3, 0x36, 0x9e, 0x6f, 0x6d, 0x1d,
+    0xcf, 0xf7, 0xf0, 0x88, 0xe5, 0xfb, 0x37, 0x8e, 0x89, 0xca, 0x38, 0x26, 0x2a, 0x04, 0x26, 0x2a,
+    0x04, 0x26, 0xaa, 0x70, 0xe7, 0x33, 0x82, 0x0a, 0x41, 0x65, 0x07, 0x92, 0xef, 0xff, 0x38, 0x26,
+    0x2a, 0xe3, 0x54, 0x3e, 0x41, 0xe5, 0xdb, 0x54, 0x44, 0xe1, 0xf9, 0xba, 0x3d, 0x2a, 0x6a, 0xa9,
+    0xc4, 0x60, 0x79, 0xbe, 0xb9, 0x71, 0x4c, 0x54, 0x16, 0x50, 0xa9, 0x4d, 0xe5, 0x3e, 0xa8, 0x5c,
+    0x14, 0x9e, 0x6f, 0x30, 0xa4, 0x72, 0x83, 0x54, 0xae, 0x96, 0xa5, 0xf9, 0xe6, 0xc7, 0x31, 0x51,
+    0x59, 0x80, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0xe7, 0x1b, 0x5d, 0xe1, 0xf9,
+    0x8e, 0x4f, 0xf0, 0x7c, 0x1b, 0x9b, 0x2c, 0xcb, 0xf7, 0x65, 0x1c, 0x13, 0x95, 0x05, 0x98, 0xa8,
+    0x10, 0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10, 0x78, 0xbe, 0x9b, 0x5b, 0x3c, 0x5f, 0xa7, 0x8b, 0xe7,
+    0xdb, 0xd9, 0x65, 0xc9, 0xcf, 0xbf, 0x8e, 0x63, 0xa2, 0xb2, 0x00, 0x13, 0x15, 0x02, 0x13, 0x15,
+    0x02, 0x13, 0x15, 0x02, 0xcf, 0xf7, 0xf0, 0x88, 0xe7, 0x3b, 0x1f, 0xe0, 0xf9, 0xf6, 0x0f, 0x68,
+    0xfe, 0xf9, 0xb7, 0x71, 0x4c, 0x54, 0x16, 0x60, 0xa2, 0x0a, 0x4f, 0x9a, 0x11, 0x54, 0x08, 0x2a,
+    0x3b, 0xf0, 0x7c, 0x97, 0x23, 0x2a, 0xaf, 0xa2, 0x71, 0xc7, 0xf7, 0x71, 0x2a, 0xdf, 0xa6, 0x22,
+    0x0a, 0x13, 0x15, 0x82, 0x8a, 0x5a, 0x2a, 0x31, 0xa8, 0xe4, 0xc3, 0xf3, 0x9d, 0x75, 0x68, 0xda,
+    0xf1, 0x63, 0x9c, 0xca, 0x7d, 0x50, 0xb9, 0x28, 0x4c, 0x54, 0x08, 0x2a, 0x37, 0x48, 0xe5, 0x6a,
+    0xa9, 0xdc, 0x39, 0x9e, 0xaf, 0x7f, 0x4e, 0xc3, 0x8e, 0x9f, 0xe3, 0x98, 0xa8, 0x10, 0x98, 0xa8,
+    0x10, 0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10, 0x78, 0xbe, 0x8d, 0x4d, 0x3c, 0xdf, 0xf3, 0x0b, 0x9e,
+    0xef, 0xe2, 0x92, 0xc5, 0x3b, 0x16, 0x8c, 0x63, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42,
+    0x60, 0xa2, 0x42, 0xe0, 0xf9, 0x76, 0x76, 0xf1, 0x7c, 0x6f, 0xef, 0x78, 0xbe, 0x6b, 0x58, 0xb8,
+    0x63, 0xd1, 0x38, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x9e,
+    0x6f, 0xff, 0x00, 0xcf, 0xb7, 0xb2, 0x8a, 0xe7, 0xbb, 0xbb, 0x67, 0xd1, 0x8e, 0x42, 0x89, 0x86,
+    0x4f, 0x50, 0x21, 0x30, 0x51, 0x21, 0x30, 0x51, 0x21, 0xa8, 0xbc, 0x8a, 0xca, 0x3f, 0xf0, 0x7c,
+    0x4f, 0xcf, 0x2c, 0xd8, 0xb1, 0x78, 0x1c, 0x13, 0x15, 0x82, 0x8a, 0x5a, 0x2a, 0x31, 0x30, 0x51,
+    0x21, 0xf0, 0x7c, 0x67, 0x1d, 0x2a, 0xc1, 0xf1, 0x7c, 0xe3, 0x37, 0x7e, 0xee, 0x68, 0x18, 0xc7,
+    0x44, 0x85, 0xa0, 0x72, 0x83, 0x54, 0xae, 0x16, 0x13, 0x15, 0x02, 0xcf, 0xd7, 0x3f, 0xc7, 0xf3,
+    0xb5, 0xf6, 0xf1, 0x7c, 0x93, 0x15, 0x7e, 0xec, 0x68, 0x1a, 0xc7, 0x44, 0x85, 0xc0, 0x44, 0x85,
+    0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0xf3, 0x5d, 0x5c, 0xe2, 0xf9, 0xda, 0x47, 0x78, 0xbe,
+    0xf5, 0x5f, 0x7c, 0xdf, 0xd1, 0x38, 0x8e, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81,
+    0x89, 0x0a, 0x81, 0xe7, 0xbb, 0x06, 0xcf, 0x77, 0x7a, 0x86, 0xe7, 0xdb, 0xda, 0xe6, 0xdb, 0x8e,
+    0xe6, 0x71, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x3c, 0xdf,
+    0xdd, 0x3d, 0x9e, 0xaf, 0xd7, 0xc7, 0xf3, 0xed, 0xb5, 0xf8, 0xba, 0x63, 0xc9, 0x38, 0x26, 0x2a,
+    0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x9e, 0xef, 0xe9, 0x19, 0xcf, 0x37,
+    0xbc, 0xc0, 0xf3, 0x1d, 0xb6, 0xf9, 0xb2, 0x63, 0xd9, 0x38, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04,
+    0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x9e, 0x6f, 0xfc, 0x86, 0xe7, 0x2b, 0x88, 0x0a, 0xc1, 0x3c,
+    0xb1, 0x74, 0x9c, 0xca, 0x02, 0x2a, 0x4f, 0xc2, 0x44, 0x85, 0xa0, 0xf2, 0x09, 0x2a, 0xdf, 0xa6,
+    0x22, 0x0a, 0xcf, 0xd7, 0xed, 0x31, 0x47, 0x2c, 0x1f, 0xa7, 0x52, 0x82, 0x4a, 0x3b, 0x4c, 0xd4,
+    0xe7, 0x91, 0x57, 0x6a, 0x53, 0xb9, 0x0f, 0x2a, 0x17, 0x85, 0xe7, 0x1b, 0x0c, 0xf9, 0x4f, 0xc8,
+    0x38, 0x95, 0x93, 0xa5, 0x72, 0xe4, 0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10, 0x78, 0xbe, 0xad, 0x6d,
+    0x3c, 0xdf, 0xeb, 0x18, 0xcf, 0x37, 0xba, 0xe2, 0x1f, 0x61, 0x5e, 0x31, 0x51, 0x21, 0x30, 0x51,
+    0x21, 0x30, 0x51, 0x21, 0x30, 0x51, 0x21, 0xf0, 0x7c, 0x7b, 0x2d, 0x3c, 0xdf, 0xc7, 0x04, 0xcf,
+    0x77, 0x73, 0xcb, 0x5f, 0x42, 0xbd, 0x62, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60,
+    0xa2, 0x42, 0xe0, 0xf9, 0x0e, 0xdb, 0x78, 0xbe, 0xb5, 0x75, 0x3c, 0xdf, 0xc3, 0x23, 0x7f, 0x08,
+    0xf7, 0x8a, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x2a, 0xdc, 0xf9, 0x8c,
+    0xa0, 0x42, 0x50, 0xd9, 0xc1, 0x8c, 0x28, 0x3c, 0x09, 0x13, 0x15, 0x82, 0xca, 0x27, 0xa8, 0x7c,
+    0x9b, 0x8a, 0x28, 0x3c, 0x5f, 0xb7, 0x47, 0x45, 0x2d, 0x95, 0x18, 0x7c, 0x12, 0x95, 0x76, 0x98,
+    0xa8, 0x10, 0x54, 0x6a, 0x53, 0xb9, 0x0f, 0x2a, 0x17, 0x85, 0xe7, 0x1b, 0x0c, 0xa9, 0xdc, 0x20,
+    0x95, 0xab, 0xe5, 0xf3, 0x06, 0x2b, 0x47, 0x8e, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a,
+    0x81, 0xe7, 0x7b, 0x1d, 0xe3, 0xf9, 0x46, 0x57, 0x78, 0xbe, 0xe3, 0x13, 0x3c, 0xdf, 0xc6, 0x26,
+    0x53, 0xe2, 0x00, 0x3d, 0xc0, 0xe9, 0x38, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04,
+    0x9e, 0xef, 0x63, 0x82, 0xe7, 0xbb, 0xb9, 0xc5, 0xf3, 0x75, 0xba, 0x78, 0xbe, 0x9d, 0xdd, 0xe9,
+    0x51, 0x1d, 0x1d, 0xa3, 0x07, 0x38, 0x1d, 0xc7, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85,
+    0xc0, 0xf3, 0xad, 0xad, 0xe3, 0xf9, 0x1e, 0x1e, 0xf1, 0x7c, 0xe7, 0x03, 0x3c, 0xdf, 0xfe, 0xf4,
+    0xa8, 0xa6, 0xe3, 0xe8, 0x01, 0x4e, 0xc7, 0x31, 0x51, 0x21, 0x30, 0x51, 0x85, 0x27, 0xcd, 0x08,
+    0x2a, 0x04, 0x95, 0x1d, 0x78, 0xbe, 0xcb, 0x11, 0x95, 0x57, 0x91, 0x71, 0x2a, 0x9f, 0xa0, 0xf2,
+    0x6d, 0x2a, 0xa2, 0x30, 0x51, 0x21, 0xa8, 0xa8, 0xa5, 0x12, 0x83, 0x4a, 0x3e, 0x3c, 0xdf, 0x59,
+    0xe7, 0x73, 0x9c, 0x4a, 0x6d, 0x2a, 0xf7, 0x41, 0xe5, 0xa2, 0x30, 0x51, 0x21, 0xa8, 0xdc, 0x20,
+    0x95, 0xab, 0xa5, 0x72, 0xe7, 0x78, 0xbe, 0xfe, 0x6c, 0x1c, 0x3d, 0xc0, 0xe9, 0x38, 0x26, 0x2a,
+    0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x9e, 0xef, 0xf8, 0x04, 0xcf, 0xb7, 0xb1, 0x89, 0xe7,
+    0x7b, 0x7e, 0xc1, 0xf3, 0xfd, 0x19, 0x47, 0x0f, 0x70, 0x3a, 0x8e, 0x89, 0x0a, 0x81, 0x89, 0x0a,
+    0x81, 0x89, 0x0a, 0x81, 0xe7, 0xeb, 0x74, 0xf1, 0x7c, 0x3b, 0xbb, 0x78, 0xbe, 0xb7, 0x77, 0x34,
+    0xdf, 0xdf, 0x71, 0x4c, 0x54, 0xc6, 0x31, 0x51, 0x21, 0x30, 0x51, 0x21, 0x30, 0x51, 0x21, 0xf0,
+    0x7c, 0xe7, 0x03, 0x3c, 0xdf, 0xfe, 0x01, 0x9e, 0x6f, 0x65, 0x15, 0xcb, 0xf7, 0x6f, 0x1c, 0x13,
+    0x55, 0x78, 0xd2, 0x8c, 0xa0, 0x42, 0x50, 0xd9, 0x81, 0xe7, 0xbb, 0x1c, 0x51, 0x79, 0x15, 0x95,
+    0x7f, 0x20, 0x3f, 0xff, 0x3f, 0x4e, 0x45, 0x14, 0x26, 0x2a, 0x04, 0x15, 0xb5, 0x54, 0x62, 0x50,
+    0xc9, 0x87, 0xe7, 0x3b, 0xeb, 0x50, 0x09, 0xce, 0xf2, 0x7c, 0x73, 0xe3, 0x54, 0x2e, 0x0a, 0x13,
+    0x15, 0x82, 0xca, 0x0d, 0x52, 0xb9, 0x5a, 0x2a, 0x77, 0x8e, 0xe7, 0xeb, 0x9f, 0xe3, 0xf9, 0x5a,
+    0xfb, 0x2c, 0xcd, 0x37, 0x3f, 0x8e, 0x89, 0xca, 0x02, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x4c,
+    0x54, 0x08, 0x3c, 0xdf, 0xf3, 0x0b, 0x9e, 0xef, 0xe2, 0x12, 0xcf, 0xd7, 0x3e, 0x62, 0x59, 0xbe,
+    0x2f, 0xe3, 0x98, 0xa8, 0x2c, 0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0xf3,
+    0xbd, 0xbd, 0xe3, 0xf9, 0xae, 0xc1, 0xf3, 0x9d, 0x9e, 0xb1, 0xe4, 0xe7, 0x5f, 0xc7, 0x31, 0x51,
+    0x59, 0x80, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0xe7, 0x5b, 0x59, 0xc5, 0xf3,
+    0xdd, 0xdd, 0xe3, 0xf9, 0x7a, 0x7d, 0x9a, 0x7f, 0xfe, 0x6d, 0x1c, 0x13, 0x95, 0x05, 0x98, 0xa8,
+    0x10, 0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10, 0x78, 0xbe, 0x5f, 0x1b, 0x78, 0xbe, 0xa7, 0x67, 0x3c,
+    0xdf, 0xf0, 0x82, 0xc6, 0x1d, 0xdf, 0xc7, 0x31, 0x51, 0x59, 0x80, 0x89, 0x0a, 0x81, 0x89, 0x0a,
+    0x81, 0x89, 0x0a, 0x81, 0xe7, 0xdb, 0xde, 0xc1, 0xf3, 0x8d, 0xdf, 0xf0, 0x7c, 0x4b, 0x76, 0xfc,
+    0x18, 0xc7, 0x44, 0x85, 0xa0, 0xb2, 0x80, 0xca, 0x93, 0x30, 0x51, 0x21, 0xf0, 0x7c, 0xad, 0x7d,
+    0x2a, 0xdf, 0xa6, 0x22, 0x8a, 0x86, 0x1d, 0x3f, 0xc7, 0x31, 0x51, 0x21, 0xa8, 0x94, 0xa0, 0xd2,
+    0x0e, 0x13, 0x15, 0x02, 0xcf, 0xd7, 0x3e, 0xa2, 0x72, 0x1f, 0x54, 0x2e, 0x8a, 0xc5, 0x3b, 0x16,
+    0x8c, 0x63, 0xa2, 0x42, 0xe0, 0x27, 0xbb, 0xb3, 0x4b, 0xe5, 0xc8, 0x31, 0x51, 0x21, 0xf0, 0x7c,
+    0xa7, 0x67, 0x78, 0xbe, 0xad, 0x6d, 0x3c, 0xdf, 0xeb, 0x98, 0x85, 0x3b, 0x16, 0x8d, 0x63, 0xa2,
+    0x42, 0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0xe0, 0xf9, 0x7a, 0x7d, 0x3c, 0xdf,
+    0x5e, 0x0b, 0xcf, 0xf7, 0x31, 0x61, 0xd1, 0x8e, 0x85, 0xe3, 0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10,
+    0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10, 0x78, 0xbe, 0xe1, 0x05, 0x9e, 0xef, 0xb0, 0x8d, 0xe7, 0x5b,
+    0x5b, 0x67, 0xc1, 0x8e, 0xc5, 0xe3, 0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10, 0x98,
+    0xa8, 0x10, 0x78, 0xbe, 0x82, 0xa8, 0x10, 0x54, 0x08, 0x7e, 0xee, 0x68, 0x18, 0xa7, 0xf2, 0x24,
+    0x4c, 0x54, 0x08, 0x2a, 0x9f, 0xa0, 0xf2, 0x6d, 0x2a, 0xa2, 0xf0, 0x7c, 0xdd, 0x1e, 0x15, 0xb5,
+    0xfc, 0xd8, 0xd1, 0x34, 0x4e, 0xa5, 0x1d, 0x26, 0x2a, 0x04, 0x95, 0xda, 0x54, 0xee, 0x83, 0xca,
+    0x45, 0xe1, 0xf9, 0x06, 0x43, 0x2a, 0x37, 0xc8, 0xf7, 0x1d, 0x8d, 0xe3, 0x54, 0x8e, 0x1c, 0x13,
+    0x15, 0x02, 0x13, 0x15, 0x02, 0x13, 0x15, 0x02, 0xcf, 0xf7, 0x3a, 0xc6, 0xf3, 0x8d, 0xae, 0xf0,
+    0x7c, 0xc7, 0x27, 0x7c, 0xdb, 0xd1, 0x3c, 0x8e, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a,
+    0x81, 0x89, 0x0a, 0x81, 0xe7, 0xfb, 0x98, 0xe0, 0xf9, 0x6e, 0x6e, 0xf1, 0x7c, 0x9d, 0x2e, 0x5f,
+    0x77, 0xfc, 0x06, 0x6f, 0x54, 0x48, 0x2b, 0x28, 0x91, 0x8d, 0x92, 0x11, 0x58, 0xa4, 0x61, 0x14,
+    0x46, 0x93, 0x64, 0x25, 0x59, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x19, 0x49, 0x92, 0x24, 0x49,
+    0x92, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x24, 0x49, 0x8e, 0x24,
+    0x49, 0x92, 0x24, 0xc9, 0xca, 0x48, 0xb2, 0x92, 0x24, 0xc9, 0x4a, 0xbe, 0xff, 0x5b, 0xdb, 0xee,
+    0xd4, 0xf6, 0xcf, 0xb9, 0x7e, 0xcf, 0x73, 0xbf, 0xef, 0x9c, 0xbb, 0x78, 0xf8, 0xf9, 0xf8, 0xf4,
+    0xfc, 0xeb, 0x65, 0x6d, 0xfd, 0xdb, 0xc6, 0xf7, 0xcd, 0xad, 0xed, 0x9d, 0xdd, 0xbd, 0xfd, 0x83,
+    0xce, 0xe1, 0xd1, 0xf1, 0xc9, 0x29, 0xe7, 0xdd, 0x5e, 0x7f, 0x30, 0x1c, 0x8d, 0x27, 0xd3, 0xd9,
+    0xfc, 0xe2, 0x92, 0xab, 0xeb, 0x9b, 0xdb, 0xbb, 0xfb, 0x1f, 0x8b, 0x0f, 0x04, 0xcb, 0xc4, 0x59,
+    0x0b, 0x41, 0xeb, 0x8e, 0x25, 0x82, 0xd6, 0x1d, 0x4b, 0x04, 0xad, 0x3b, 0x96, 0x08, 0x5a, 0x77,
+    0x2c, 0x11, 0xb4, 0xee, 0x58, 0x22, 0xf8, 0xb0, 0x63, 0xd5, 0x38, 0x26, 0x2a, 0x04, 0x26, 0x2a,
+    0x04, 0x26, 0x6a, 0xf5, 0x8e, 0x25, 0x82, 0x0a, 0x41, 0x65, 0x07, 0x9e, 0x6f, 0x36, 0x67, 0x99,
+    0x58, 0x39, 0x4e, 0xe5, 0x13, 0x54, 0xbe, 0x4d, 0x45, 0x14, 0x26, 0x2a, 0x04, 0x15, 0xb5, 0x54,
+    0x62, 0x50, 0xc9, 0xc7, 0x12, 0xb1, 0x7a, 0x9c, 0x4a, 0x6d, 0x2a, 0xf7, 0x41, 0xe5, 0xa2, 0x30,
+    0x51, 0x21, 0xa8, 0xdc, 0x20, 0x95, 0xab, 0xa5, 0x72, 0xe7, 0xfc, 0x23, 0x64, 0x1c, 0x13, 0x15,
+    0x02, 0x13, 0x15, 0x02, 0x13, 0x15, 0x02, 0x13, 0x15, 0x02, 0xcf, 0x77, 0x7a, 0x86, 0xe7, 0xdb,
+    0xdc, 0xc2, 0xf3, 0x2d, 0x1e, 0xf8, 0x4b, 0x98, 0x57, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x4c,
+    0x54, 0x08, 0x4c, 0x54, 0x08, 0x3c, 0x5f, 0xaf, 0x8f, 0xe7, 0xdb, 0xdd, 0xc3, 0xf3, 0x3d, 0x3d,
+    0xf3, 0x4e, 0xa8, 0x57, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08,
+    0x3c, 0xdf, 0x68, 0x8c, 0xe7, 0xeb, 0x1c, 0xe2, 0xf9, 0xd6, 0xd6, 0xf9, 0x43, 0xb8, 0x57, 0x4c,
+    0x54, 0xe1, 0x49, 0x6f, 0x04, 0x15, 0x82, 0xca, 0x0e, 0x3c, 0xdf, 0x6c, 0x4e, 0xe5, 0x55, 0x54,
+    0xfe, 0xc1, 0x1b, 0x51, 0xf8, 0x36, 0x15, 0x51, 0x98, 0xa8, 0x10, 0x54, 0xd4, 0x52, 0x89, 0x41,
+    0x25, 0x1f, 0x9e, 0xaf, 0xdb, 0xa3, 0x12, 0x9c, 0x57, 0xa2, 0x72, 0x1f, 0x54, 0x2e, 0x0a, 0x13,
+    0x15, 0x82, 0xca, 0x0d, 0x52, 0xb9, 0x5a, 0x2a, 0x77, 0x8e, 0xe7, 0x1b, 0x8e, 0xf0, 0x7c, 0x07,
+    0x1d, 0x5e, 0x6f, 0x50, 0x0f, 0xb0, 0x19, 0xc7, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85,
+    0xc0, 0xf3, 0x6d, 0x6e, 0xe1, 0xf9, 0x16, 0x0f, 0x78, 0xbe, 0xe9, 0x0c, 0xcf, 0x77, 0x7c, 0x42,
+    0x43, 0x0c, 0xd1, 0x03, 0x6c, 0xc6, 0x31, 0x51, 0x21, 0x30, 0x51, 0x21, 0x30, 0x51, 0x21, 0xf0,
+    0x7c, 0xbb, 0x7b, 0x78, 0xbe, 0xa7, 0x67, 0x3c, 0xdf, 0x25, 0x78, 0xbe, 0xf3, 0x6e, 0x73, 0x54,
+    0x93, 0x29, 0x7a, 0x80, 0xcd, 0x38, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x9e,
+    0xaf, 0x73, 0x88, 0xe7, 0x5b, 0x5b, 0xc7, 0xf3, 0xdd, 0xdc, 0xe2, 0xf9, 0x06, 0xcd, 0x51, 0x55,
+    0x44, 0x65, 0x1c, 0x13, 0x15, 0x02, 0x13, 0x15, 0x02, 0x13, 0x15, 0x82, 0xca, 0xab, 0xf0, 0x7c,
+    0xdf, 0x37, 0xf1, 0x7c, 0x3f, 0x16, 0x78, 0xbe, 0xe6, 0xa8, 0x32, 0x8e, 0x1e, 0x60, 0x33, 0x8e,
+    0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0xe7, 0xeb, 0xf6, 0xf0, 0x7c, 0x3b, 0xbb,
+    0x78, 0xbe, 0xc7, 0x27, 0x3c, 0xdf, 0xc5, 0xe5, 0xeb, 0x38, 0x7a, 0x80, 0xcd, 0x38, 0x26, 0x2a,
+    0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x9e, 0x6f, 0x38, 0xc2, 0xf3, 0x1d, 0x74, 0xf0, 0x7c,
+    0x2f, 0x6b, 0x78, 0xbe, 0xeb, 0xb7, 0x71, 0xf4, 0x00, 0x9b, 0x71, 0x4c, 0x54, 0x08, 0x4c, 0x54,
+    0x08, 0x4c, 0x54, 0x08, 0x3c, 0xdf, 0x74, 0x86, 0xe7, 0x3b, 0x3e, 0xc1, 0xf3, 0x6d, 0x7c, 0xc7,
+    0xf3, 0xfd, 0x19, 0x47, 0x0f, 0xb0, 0x19, 0xc7, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85,
+    0xc0, 0xf3, 0x5d, 0x82, 0xe7, 0x3b, 0xef, 0xe2, 0xf9, 0xb6, 0x77, 0xd0, 0x7c, 0xef, 0xe3, 0x98,
+    0xa8, 0x8c, 0x63, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0xe0, 0xf9, 0x6e, 0x6e, 0xf1,
+    0x7c, 0x83, 0x21, 0x9e, 0x6f, 0xff, 0x00, 0xcb, 0xf7, 0x77, 0x1c, 0x13, 0x95, 0x71, 0x4c, 0x54,
+    0x08, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x3c, 0xdf, 0x8f, 0x05, 0x9e, 0x6f, 0x32, 0xc5, 0xf3,
+    0x1d, 0x1d, 0x23, 0xf9, 0xfe, 0x8d, 0x63, 0xa2, 0x32, 0x8e, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81,
+    0x89, 0x0a, 0x81, 0xe7, 0x7b, 0x7c, 0xc2, 0xf3, 0x15, 0x44, 0x85, 0x60, 0x35, 0xb1, 0x34, 0x4e,
+    0x65, 0x01, 0x95, 0x27, 0x61, 0xa2, 0x42, 0x50, 0xf9, 0x04, 0x95, 0x6f, 0x53, 0x11, 0x85, 0xe7,
+    0xeb, 0x0f, 0x58, 0xa9, 0x76, 0x79, 0x9c, 0x4a, 0x09, 0x2a, 0xed, 0x30, 0x51, 0x21, 0xa8, 0xd4,
+    0xa6, 0x72, 0x1f, 0x54, 0x2e, 0x0a, 0xcf, 0x37, 0x9e, 0xb0, 0x2a, 0xdf, 0x87, 0x71, 0x2a, 0x27,
+    0x4b, 0xe5, 0xc8, 0x31, 0x51, 0x21, 0x30, 0x51, 0x21, 0xf0, 0x7c, 0xdb, 0x3b, 0x78, 0xbe, 0x9f,
+    0x8f, 0x78, 0xbe, 0xf9, 0x05, 0x2b, 0x7e, 0xfe, 0x71, 0x1c, 0x13, 0x95, 0x05, 0x98, 0xa8, 0x10,
+    0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10, 0x78, 0xbe, 0xfd, 0x03, 0x3c, 0xdf, 0xaf, 0x17, 0x3c, 0xdf,
+    0xd5, 0x35, 0xed, 0x3f, 0xff, 0x34, 0x8e, 0x89, 0xca, 0x02, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08,
+    0x4c, 0x54, 0x08, 0x3c, 0xdf, 0xd1, 0x31, 0x9e, 0xef, 0xdb, 0x06, 0x9e, 0xef, 0xee, 0x9e, 0xd6,
+    0x1d, 0x9f, 0xc7, 0x31, 0x51, 0x59, 0x80, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x2a, 0xdc,
+    0xf9, 0x1b, 0x41, 0x85, 0xa0, 0xb2, 0x83, 0xb6, 0x1d, 0xff, 0x8d, 0x63, 0xa2, 0x42, 0x50, 0xf9,
+    0x04, 0x95, 0x6f, 0x53, 0x11, 0x85, 0xe7, 0xeb, 0x0f, 0xa8, 0xa8, 0xa5, 0x12, 0x83, 0x96, 0x1d,
+    0xff, 0x8f, 0x63, 0xa2, 0x42, 0x50, 0xa9, 0x4d, 0xe5, 0x3e, 0xa8, 0x5c, 0x14, 0x9e, 0x6f, 0x3c,
+    0xa1, 0x72, 0x83, 0x54, 0xae, 0x96, 0xaf, 0x77, 0x7c, 0x31, 0x8e, 0x89, 0x0a, 0x81, 0x89, 0x0a,
+    0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0xe7, 0x9b, 0x5f, 0xe0, 0xf9, 0x4e, 0xcf, 0xf0, 0x7c,
+    0x9b, 0x5b, 0x7c, 0xb9, 0xe3, 0xab, 0x71, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08,
+    0x4c, 0x54, 0x08, 0x3c, 0xdf, 0xd5, 0x35, 0x9e, 0xaf, 0xd7, 0xc7, 0xf3, 0xed, 0xee, 0xf1, 0xd5,
+    0x8e, 0x2f, 0xc7, 0x31, 0x51, 0x21, 0x30, 0x51, 0x21, 0x30, 0x51, 0x21, 0x30, 0x51, 0x21, 0xf0,
+    0x7c, 0x77, 0xf7, 0x78, 0xbe, 0xd1, 0x18, 0xcf, 0xd7, 0x39, 0xe4, 0x8b, 0x1d, 0x5f, 0x8f, 0x63,
+    0xa2, 0x42, 0x60, 0xa2, 0x0a, 0x4f, 0x7a, 0x23, 0xa8, 0x10, 0x54, 0x76, 0xe0, 0xf9, 0x66, 0x73,
+    0x2a, 0xaf, 0xe2, 0xff, 0x1d, 0x2d, 0xe3, 0x54, 0xbe, 0x4d, 0x45, 0x14, 0x26, 0x2a, 0x04, 0x15,
+    0xb5, 0x54, 0x62, 0x50, 0xc9, 0x87, 0xe7, 0xeb, 0xf6, 0xf8, 0x6f, 0x47, 0xdb, 0x38, 0x95, 0xfb,
+    0xa0, 0x72, 0x51, 0x98, 0xa8, 0x10, 0x54, 0x6e, 0x90, 0xca, 0xd5, 0x52, 0xb9, 0x73, 0x3c, 0xdf,
+    0x70, 0xc4, 0xe7, 0x1d, 0xad, 0xe3, 0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10, 0x98,
+    0xa8, 0x10, 0x78, 0xbe, 0xcd, 0x2d, 0x3c, 0xdf, 0xe2, 0x01, 0xcf, 0x37, 0x9d, 0xf1, 0x69, 0x47,
+    0xfb, 0x38, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x9e, 0x6f,
+    0x77, 0x0f, 0xcf, 0xf7, 0xf4, 0x8c, 0xe7, 0xbb, 0x84, 0x8f, 0x3b, 0x56, 0x8c, 0x63, 0xa2, 0x42,
+    0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0xe0, 0xf9, 0x3a, 0x87, 0x78, 0xbe, 0xb5,
+    0x75, 0x3c, 0xdf, 0xcd, 0x2d, 0x1f, 0x76, 0x14, 0x3e, 0xb1, 0xba, 0x36, 0x15, 0x82, 0xca, 0x0e,
+    0x4c, 0x54, 0x08, 0x2a, 0xaf, 0xa2, 0xf2, 0x0f, 0x2a, 0x3f, 0x67, 0x99, 0x58, 0x39, 0x8e, 0x89,
+    0x0a, 0x41, 0x45, 0x2d, 0x95, 0x18, 0x98, 0xa8, 0x10, 0x78, 0xbe, 0x6e, 0x8f, 0x4a, 0x70, 0x2a,
+    0x27, 0xc2, 0x12, 0xb1, 0x7a, 0x1c, 0x13, 0x15, 0x82, 0xca, 0x0d, 0x52, 0xb9, 0x5a, 0x4c, 0x54,
+    0x08, 0x3c, 0xdf, 0x70, 0x84, 0xe7, 0x3b, 0xe8, 0xe0, 0xf9, 0x5e, 0xd6, 0xf8, 0x47, 0xc8, 0x38,
+    0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x9e, 0x6f, 0x3a, 0xc3,
+    0xf3, 0x1d, 0x9f, 0xe0, 0xf9, 0x36, 0xbe, 0xf3, 0x97, 0x30, 0xaf, 0x98, 0xa8, 0x10, 0x98, 0xa8,
+    0x10, 0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10, 0x78, 0xbe, 0x4b, 0xf0, 0x7c, 0xe7, 0x5d, 0x3c, 0xdf,
+    0xf6, 0x0e, 0xef, 0x84, 0x7a, 0xc5, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0x44,
+    0x85, 0xc0, 0xf3, 0xdd, 0xdc, 0xe2, 0xf9, 0x06, 0x43, 0x3c, 0xdf, 0xfe, 0x01, 0x7f, 0x08, 0xf7,
+    0x8a, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0xe7, 0xfb, 0xb1,
+    0xc0, 0xf3, 0x4d, 0xa6, 0x78, 0xbe, 0xa3, 0x63, 0xde, 0x88, 0x82, 0x57, 0x4c, 0x54, 0x08, 0x4c,
+    0x54, 0x08, 0x4c, 0x54, 0x08, 0x3c, 0xdf, 0xce, 0x2e, 0x9e, 0xef, 0xf1, 0x09, 0xcf, 0x57, 0x10,
+    0x15, 0x82, 0x57, 0xa2, 0x32, 0x4e, 0x65, 0x01, 0x95, 0x27, 0x61, 0xa2, 0x42, 0x50, 0xf9, 0x04,
+    0x95, 0x6f, 0x53, 0x11, 0x85, 0xe7, 0xeb, 0x0f, 0x78, 0xbd, 0xc1, 0x8a, 0x57, 0x2a, 0x25, 0xa8,
+    0xb4, 0xc3, 0x44, 0x85, 0xa0, 0x52, 0x9b, 0xca, 0x7d, 0x50, 0xb9, 0x28, 0x3c, 0xdf, 0x78, 0x42,
+    0x43, 0x5c, 0xa3, 0x07, 0xd8, 0x8c, 0x53, 0x39, 0x59, 0x2a, 0x47, 0x8e, 0x89, 0x0a, 0x81, 0xe7,
+    0x3b, 0xef, 0xe2, 0xf9, 0xb6, 0x77, 0xf0, 0x7c, 0x3f, 0x1f, 0xf1, 0x7c, 0xf3, 0x8b, 0xe6, 0xa8,
+    0xee, 0xee, 0xd1, 0x03, 0x6c, 0xc6, 0x31, 0x51, 0x21, 0x30, 0x51, 0x21, 0x30, 0x51, 0x21, 0xf0,
+    0x7c, 0x83, 0x21, 0x9e, 0x6f, 0xff, 0x00, 0xcf, 0xf7, 0xeb, 0x05, 0xcf, 0x77, 0xd5, 0x1c, 0x55,
+    0x33, 0x8e, 0x1e, 0x60, 0x33, 0x8e, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0xe7,
+    0x9b, 0x4c, 0xf1, 0x7c, 0x47, 0xc7, 0x78, 0xbe, 0x6f, 0x1b, 0x78, 0xbe, 0xe6, 0xa8, 0x32, 0x8e,
+    0x1e, 0x60, 0x33, 0x8e, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0xe7, 0x2b, 0x88,
+    0x0a, 0x41, 0x85, 0xa0, 0xb2, 0xe3, 0x75, 0x9c, 0xca, 0x93, 0x30, 0x51, 0x21, 0xa8, 0x7c, 0x82,
+    0xca, 0xb7, 0xa9, 0x88, 0xc2, 0xf3, 0xf5, 0x07, 0x54, 0xd4, 0x52, 0x88, 0xf1, 0x36, 0x4e, 0xa5,
+    0x1d, 0x26, 0x2a, 0x04, 0x95, 0xda, 0x54, 0xee, 0x83, 0xca, 0x45, 0xe1, 0xf9, 0xc6, 0x13, 0x2a,
+    0x37, 0x88, 0xe7, 0xfb, 0x33, 0x4e, 0xe5, 0xc8, 0x31, 0x51, 0x21, 0x30, 0x51, 0x21, 0x30, 0x51,
+    0x21, 0xf0, 0x7c, 0x3f, 0x1f, 0xf1, 0x7c, 0xf3, 0x0b, 0x3c, 0xdf, 0xe9, 0x19, 0x9a, 0xef, 0x7d,
+    0x1c, 0x13, 0x95, 0x71, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x3c, 0xdf, 0xaf,
+    0x17, 0x3c, 0xdf, 0xd5, 0x35, 0x9e, 0xaf, 0xd7, 0xc7, 0xf2, 0xfd, 0x1d, 0xc7, 0x44, 0x65, 0x1c,
+    0x13, 0x15, 0x02, 0x13, 0x15, 0x02, 0x13, 0x15, 0x02, 0xcf, 0xf7, 0x6d, 0x03, 0xcf, 0x77, 0x77,
+    0x8f, 0xe7, 0x1b, 0x8d, 0x91, 0x7c, 0xff, 0xc6, 0x31, 0x51, 0x19, 0xc7, 0x44, 0x85, 0xc0, 0x44,
+    0xe9, 0x45, 0xbd, 0x13, 0x54, 0x08, 0x2a, 0x3b, 0xf0, 0x7c, 0xb3, 0x39, 0xab, 0x5f, 0xb5, 0x34,
+    0x4e, 0xe5, 0x13, 0x54, 0xbe, 0x4d, 0x45, 0x14, 0x26, 0x2a, 0x04, 0x15, 0xb5, 0x54, 0x62, 0x50,
+    0xc9, 0xc7, 0xca, 0x7c, 0xcb, 0xe3, 0x54, 0x6a, 0x53, 0xb9, 0x0f, 0x2a, 0x17, 0x85, 0x89, 0x0a,
+    0x41, 0xe5, 0x06, 0xa9, 0x5c, 0x2d, 0x95, 0x3b, 0x67, 0x55, 0xbe, 0x0f, 0xe3, 0x98, 0xa8, 0x2c,
+    0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0xf3, 0x9d, 0x9e, 0xe1, 0xf9, 0x36,
+    0xb7, 0xf0, 0x7c, 0x8b, 0x07, 0x56, 0xfc, 0xfc, 0xe3, 0x38, 0x26, 0x2a, 0x0b, 0x30, 0x51, 0x21,
+    0x30, 0x51, 0x21, 0x30, 0x51, 0x21, 0xf0, 0x7c, 0xbd, 0x3e, 0x9e, 0x6f, 0x77, 0x0f, 0xcf, 0xf7,
+    0xf4, 0x4c, 0xfb, 0xcf, 0x3f, 0x8d, 0x63, 0xa2, 0xb2, 0x00, 0x13, 0x15, 0x02, 0x13, 0x15, 0x02,
+    0x13, 0x15, 0x02, 0xcf, 0x37, 0x1a, 0xe3, 0xf9, 0x3a, 0x87, 0x78, 0xbe, 0xb5, 0x75, 0x5a, 0x77,
+    0x7c, 0x1e, 0xc7, 0x44, 0x15, 0x9e, 0xf4, 0x46, 0x50, 0x21, 0xa8, 0xec, 0xc0, 0xf3, 0xcd, 0xe6,
+    0x54, 0x5e, 0x45, 0xe5, 0x1f, 0xb4, 0xed, 0xf8, 0x0d, 0xf3, 0x0c, 0x44, 0xa7, 0x28, 0x91, 0x8d,
+    0x92, 0x11, 0x5c, 0x64, 0x7d, 0x18, 0x46, 0x93, 0x24, 0x49, 0x92, 0x24, 0x59, 0x49, 0x92, 0x64,
+    0x25, 0x49, 0x92, 0x95, 0x24, 0x49, 0x92, 0x64, 0x64, 0x64, 0x24, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x49, 0x46, 0x92, 0xe4, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x23, 0x49, 0x32, 0x32, 0x92, 0x24,
+    0xf9, 0x77, 0x9f, 0xda, 0xf6, 0x9b, 0x76, 0xe7, 0xce, 0x79, 0xfd, 0x39, 0xbf, 0xff, 0xbd, 0xe7,
+    0xbc, 0xdc, 0xdc, 0xde, 0xdd, 0x3f, 0x3c, 0x3e, 0x4d, 0x9f, 0x5f, 0x66, 0xf3, 0xd7, 0xb7, 0xf7,
+    0x35, 0x36, 0x36, 0xb7, 0xb6, 0x77, 0x7e, 0xec, 0xee, 0xed, 0xff, 0x3c, 0x38, 0x3c, 0xfa, 0x75,
+    0x7c, 0x72, 0x7a, 0x76, 0xde, 0xe9, 0xf6, 0x2e, 0xfa, 0x83, 0xe1, 0x68, 0x7c, 0x39, 0xb9, 0xba,
+    0xa6, 0x21, 0x58, 0x24, 0xd6, 0x5b, 0x08, 0x16, 0x89, 0xfb, 0x16, 0x82, 0xd6, 0x37, 0x16, 0x08,
+    0x5a, 0xdf, 0x58, 0x20, 0x68, 0x7d, 0x63, 0x81, 0xa0, 0xf5, 0x8d, 0x05, 0x82, 0x96, 0x37, 0xfe,
+    0x9d, 0x63, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0xe0, 0xf9, 0xee,
+    0x1f, 0xf0, 0x7c, 0xfd, 0x01, 0x9e, 0xef, 0xe0, 0x90, 0xe5, 0x6f, 0x2c, 0x99, 0x63, 0xa2, 0x42,
+    0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0xe0, 0xf9, 0xa6, 0xcf, 0x78, 0xbe, 0xf1,
+    0x25, 0x9e, 0xef, 0xf8, 0x84, 0xa5, 0x6f, 0x2c, 0x9b, 0x63, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60,
+    0xa2, 0x42, 0x60, 0xa2, 0x42, 0xe0, 0xf9, 0xe6, 0xaf, 0x78, 0xbe, 0x6b, 0xf0, 0x7c, 0xe7, 0x1d,
+    0x96, 0xbd, 0xb1, 0x74, 0x8e, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a,
+    0x81, 0xe7, 0x5b, 0x5b, 0xc7, 0xf3, 0xdd, 0xdd, 0xe3, 0xf9, 0x2e, 0xfa, 0x2c, 0x79, 0x63, 0xf9,
+    0x1c, 0x13, 0x15, 0x02, 0x13, 0x15, 0x02, 0x13, 0x15, 0x02, 0x13, 0x15, 0x02, 0xcf, 0xb7, 0xb5,
+    0x8d, 0xe7, 0x7b, 0x9a, 0xe2, 0xf9, 0x46, 0x63, 0xfe, 0x7d, 0xa3, 0x65, 0x8e, 0x89, 0x0a, 0x81,
+    0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0xe7, 0xdb, 0xdd, 0xc3, 0xf3, 0xcd, 0xe6,
+    0x78, 0xbe, 0x65, 0x6f, 0xb4, 0xcd, 0x31, 0x51, 0x21, 0x28, 0x3c, 0xb0, 0x41, 0xe5, 0x93, 0x30,
+    0x51, 0x21, 0xf0, 0x7c, 0x07, 0x87, 0x54, 0x7e, 0x9b, 0x8a, 0x28, 0xfe, 0x7e, 0xa3, 0x75, 0x8e,
+    0x89, 0x0a, 0x81, 0x89, 0x0a, 0x41, 0xa5, 0x1d, 0x26, 0x2a, 0x04, 0x9e, 0xef, 0xf8, 0x04, 0xcf,
+    0xb7, 0xb9, 0x45, 0xe5, 0xa2, 0xf8, 0xeb, 0x8d, 0xf6, 0x39, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04,
+    0x95, 0x23, 0xc7, 0x44, 0x85, 0xc0, 0xf3, 0x9d, 0x77, 0xf0, 0x7c, 0x3f, 0x76, 0xf1, 0x7c, 0x2f,
+    0x33, 0xbe, 0xbf, 0xb1, 0x62, 0x8e, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x89,
+    0x0a, 0x81, 0xe7, 0xbb, 0xe8, 0xe3, 0xf9, 0x7e, 0x1e, 0xe0, 0xf9, 0xde, 0xde, 0xf9, 0xf6, 0xc6,
+    0xaa, 0x39, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x9e, 0x6f,
+    0x34, 0xc6, 0xf3, 0xfd, 0x3a, 0xc6, 0xf3, 0x6d, 0x6c, 0xb2, 0x48, 0xac, 0x9c, 0x63, 0xa2, 0x42,
+    0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0xe0, 0xf9, 0x0a, 0xa2, 0x42, 0x50, 0x21,
+    0x58, 0x20, 0x56, 0xcf, 0xa9, 0x7c, 0x12, 0x26, 0x2a, 0x04, 0x95, 0x9f, 0xa0, 0xf2, 0xdb, 0x54,
+    0x44, 0xe1, 0xf9, 0x7a, 0x17, 0x54, 0xd4, 0xf2, 0x3f, 0x21, 0x73, 0x2a, 0xed, 0x30, 0x51, 0x21,
+    0xa8, 0xd4, 0xa6, 0x72, 0x1f, 0x54, 0x2e, 0x0a, 0xcf, 0x37, 0x1c, 0x51, 0xb9, 0x41, 0xfe, 0x10,
+    0xe6, 0x95, 0xca, 0x91, 0x63, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0xe0, 0xf9, 0x5e,
+    0x66, 0x78, 0xbe, 0xc9, 0x15, 0x9e, 0xef, 0xf4, 0x8c, 0x2f, 0x42, 0xbd, 0x62, 0xa2, 0x42, 0x60,
+    0xa2, 0x42, 0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0xe0, 0xf9, 0xde, 0xde, 0xf1, 0x7c, 0x37, 0xb7,
+    0x78, 0xbe, 0x6e, 0x8f, 0xdf, 0x84, 0x7b, 0xc5, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85,
+    0xc0, 0x44, 0x85, 0xc0, 0xf3, 0x6d, 0x6c, 0xe2, 0xf9, 0x1e, 0x1e, 0xf1, 0x7c, 0x83, 0x21, 0x9f,
+    0x44, 0xc1, 0x2b, 0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x26, 0x4a, 0x2f, 0xea, 0x8b, 0xa0, 0x42,
+    0x50, 0x79, 0x03, 0xcf, 0x77, 0x39, 0xe1, 0x83, 0xd0, 0x03, 0x6c, 0xe6, 0x54, 0x7e, 0x82, 0xca,
+    0x6f, 0x53, 0x11, 0x85, 0xe7, 0xeb, 0x5d, 0x50, 0x51, 0x4b, 0x25, 0x06, 0x95, 0x7c, 0x7c, 0xdc,
+    0xa0, 0x1e, 0x60, 0x33, 0xa7, 0x52, 0x9b, 0xca, 0x7d, 0x50, 0xb9, 0x28, 0x3c, 0xdf, 0x70, 0x44,
+    0xe5, 0x06, 0xa9, 0x5c, 0x2d, 0x95, 0x3b, 0xa7, 0x21, 0x5e, 0xd1, 0x03, 0x6c, 0xe6, 0x98, 0xa8,
+    0x10, 0x98, 0xa8, 0x10, 0x98, 0xa8, 0x10, 0x78, 0xbe, 0xc9, 0x15, 0x9e, 0xef, 0xf4, 0x0c, 0xcf,
+    0xb7, 0xbd, 0x83, 0xe7, 0x9b, 0x3e, 0x37, 0x47, 0xb5, 0xb6, 0x8e, 0x1e, 0x60, 0x33, 0xc7, 0x44,
+    0x85, 0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0xf3, 0xdd, 0xdc, 0xe2, 0xf9, 0xba, 0x3d, 0x3c,
+    0xdf, 0xde, 0x3e, 0x9e, 0x6f, 0xde, 0x1c, 0x55, 0x33, 0x47, 0x0f, 0xb0, 0x99, 0x63, 0xa2, 0x42,
+    0x60, 0xa2, 0x42, 0x60, 0xa2, 0x42, 0xe0, 0xf9, 0x1e, 0x1e, 0xf1, 0x7c, 0x83, 0x21, 0x9e, 0xef,
+    0xf0, 0x08, 0xcf, 0xd7, 0x1c, 0x55, 0xe6, 0xe8, 0x01, 0x36, 0x73, 0x4c, 0x54, 0xe1, 0x93, 0x3e,
+    0x09, 0x2a, 0x04, 0x95, 0x37, 0xf0, 0x7c, 0x97, 0x13, 0x2a, 0x5f, 0x45, 0xe5, 0x3f, 0x3e, 0xe6,
+    0x54, 0x7e, 0x9b, 0x8a, 0x28, 0x4c, 0x54, 0x08, 0x2a, 0x6a, 0xa9, 0xc4, 0xa0, 0x92, 0x0f, 0xcf,
+    0xd7, 0xe9, 0x52, 0x08, 0xfe, 0x39, 0xa7, 0x72, 0x1f, 0x54, 0x2e, 0x0a, 0x13, 0x15, 0x82, 0xca,
+    0x0d, 0x52, 0xb9, 0x5a, 0x2a, 0x77, 0x8e, 0xe7, 0xeb, 0x0f, 0xf0, 0x7c, 0xbf, 0xe7, 0xe8, 0x01,
+    0x36, 0x73, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x3c, 0xdf, 0xf6, 0x0e, 0x9e,
+    0x6f, 0xfa, 0x8c, 0xe7, 0x1b, 0x5f, 0xa2, 0xf9, 0xbe, 0xe6, 0x98, 0xa8, 0xcc, 0x31, 0x51, 0x21,
+    0x30, 0x51, 0x21, 0x30, 0x51, 0x21, 0xf0, 0x7c, 0x7b, 0xfb, 0x78, 0xbe, 0xf9, 0x2b, 0x9e, 0xef,
+    0x1a, 0x2c, 0xdf, 0x9f, 0x39, 0x26, 0x2a, 0x73, 0x4c, 0x54, 0x08, 0x4c, 0x54, 0x08, 0x4c, 0x54,
+    0x08, 0x3c, 0xdf, 0xe1, 0x11, 0x9e, 0x6f, 0x6d, 0x1d, 0xcf, 0x77, 0x77, 0x8f, 0xe4, 0xd3, 0x23,
+    0xff, 0x3e, 0xc7, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xc0, 0x44, 0x85, 0xa0, 0xf2, 0x55, 0x78, 0xbe,
+    0xad, 0x6d, 0x3c, 0xdf, 0xd3, 0x94, 0xd5, 0xf9, 0x16, 0xe6, 0x98, 0xa8, 0x3c, 0x40, 0x45, 0x2d,
+    0x26, 0x2a, 0x04, 0x26, 0x2a, 0x04, 0x9e, 0xaf, 0xd3, 0xa5, 0x12, 0x1c, 0xcf, 0x37, 0x9b, 0xb3,
+    0x32, 0xdf, 0x7f, 0xe1, 0xbb, 0x22, 0x3b,
+};
+
+static const uint8_t FseqZstd[1956] =
+{
+    0x50, 0x53, 0x45, 0x51, 0x40, 0x00, 0x01, 0x02, 0x40, 0x00, 0x2c, 0x01, 0x00, 0x00, 0xa0, 0x00,
+    0x00, 0x00, 0x19, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xef, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0xb5, 0x2f, 0xfd, 0x04, 0x38, 0x15, 0x1f, 0x00, 0x36, 0x26, 0x55, 0x25, 0x90, 0xd5, 0x35,
+    0x03, 0xab, 0x10, 0x96, 0x69, 0x22, 0x42, 0x10, 0x8c, 0x65, 0x36, 0x7a, 0x12, 0x29, 0xca, 0x4a,
+    0xc7, 0x10, 0x84, 0x10, 0x62, 0xee, 0x19, 0x11, 0x04, 0x63, 0x32, 0x8b, 0x18, 0xc2, 0x24, 0x13,
+    0x33, 0x7f, 0x51, 0x00, 0x45, 0x00, 0x4a, 0x00, 0xff, 0xc2, 0xff, 0xe0, 0xff, 0x93, 0x0b, 0x3d,
+    0x7c, 0xcf, 0x5f, 0xb5, 0xf1, 0x5d, 0x43, 0x45, 0x11, 0x6a, 0xbd, 0xd2, 0xc4, 0x57, 0x16, 0x24,
+    0x01, 0xf4, 0x8f, 0xe9, 0xb8, 0xcb, 0xc1, 0xc7, 0xf3, 0x65, 0xac, 0xf4, 0x34, 0x74, 0xbc, 0x0c,
+    0x7c, 0x3c, 0x5f, 0x87, 0xb3, 0xf1, 0x34, 0x19, 0x4c, 0xc7, 0xb5, 0x54, 0x6e, 0x94, 0x89, 0x26,
+    0x89, 0x04, 0x40, 0x1e, 0x8e, 0x06, 0x63, 0xa1, 0x48, 0x00, 0x64, 0x18, 0xe2, 0x70, 0x59, 0x86,
+    0x8a, 0x9a, 0x0a, 0x12, 0x21, 0x1a, 0x08, 0xa0, 0x01, 0x9d, 0xd4, 0x98, 0x98, 0x83, 0x58, 0x49,
+    0x4d, 0xc2, 0x96, 0x96, 0x9f, 0xd6, 0x47, 0x2e, 0x34, 0x25, 0x25, 0xe7, 0x74, 0xf1, 0x37, 0x32,
+    0x32, 0x33, 0x9a, 0xd5, 0x7a, 0x3b, 0x3a, 0x5e, 0x06, 0x5e, 0x21, 0xbb, 0x15, 0x15, 0xb7, 0x9d,
+    0x54, 0xc6, 0xca, 0x58, 0xac, 0xa4, 0x26, 0x21, 0xc0, 0xc9, 0x56, 0xeb, 0x23, 0x17, 0x7a, 0x18,
+    0xf0, 0x74, 0xba, 0xf8, 0xab, 0x36, 0x8e, 0x46, 0xb3, 0x5a, 0xaf, 0x34, 0x71, 0x60, 0xb3, 0x90,
+    0x5d, 0x41, 0xc4, 0xc8, 0xcc, 0xe8, 0x95, 0xb1, 0xd2, 0xd3, 0xd0, 0xf1, 0x32, 0x90, 0x0a, 0x70,
+    0x72, 0xb3, 0x50, 0x71, 0xdb, 0x49, 0x78, 0x18, 0x10, 0x73, 0x10, 0x2b, 0xa9, 0x09, 0xad, 0x36,
+    0x5a, 0x7e, 0x5a, 0x1f, 0xb9, 0x5f, 0x69, 0x22, 0x25, 0xe7, 0x74, 0xb1, 0x57, 0x10, 0x31, 0x32,
+    0x33, 0x9a, 0xd5, 0x76, 0x9e, 0x86, 0x8e, 0x97, 0x81, 0x57, 0xc8, 0xca, 0xcd, 0x42, 0xc5, 0x6d,
+    0x27, 0x95, 0x71, 0x72, 0xb3, 0x50, 0x71, 0x1b, 0x59, 0xed, 0x0a, 0xa1, 0x32, 0x62, 0xb6, 0xfc,
+    0xb4, 0xb6, 0xe4, 0x9c, 0x2e, 0x9e, 0x19, 0xcd, 0x6a, 0xbd, 0xd2, 0xd4, 0x4b, 0xec, 0x76, 0x10,
+    0x7b, 0x59, 0xb9, 0xd0, 0xc3, 0x8a, 0x9a, 0xfe, 0x56, 0x53, 0x66, 0x46, 0xb3, 0x5a, 0xaf, 0x34,
+    0x31, 0xf2, 0x32, 0xf0, 0x0a, 0xd9, 0x15, 0x44, 0x74, 0xdc, 0x76, 0xa8, 0x8c, 0x95, 0x9e, 0x86,
+    0x8a, 0x0f, 0x57, 0x3b, 0x2e, 0xf4, 0x77, 0xa3, 0x4c, 0xb4, 0x9e, 0x34, 0x91, 0x92, 0x73, 0x0a,
+    0x82, 0xd2, 0xa8, 0x22, 0xca, 0x4b, 0xd2, 0xfe, 0x6f, 0x92, 0xcf, 0x48, 0x92, 0x74, 0x12, 0xc0,
+    0x30, 0x10, 0x86, 0x08, 0x41, 0x14, 0xd2, 0x30, 0x0c, 0x85, 0x41, 0x10, 0x22, 0x46, 0x2b, 0x62,
+    0xac, 0x11, 0x19, 0x49, 0x93, 0x87, 0xa4, 0x03, 0x51, 0xca, 0x61, 0x51, 0x96, 0xc3, 0xa3, 0x28,
+    0x87, 0x44, 0x55, 0x0e, 0x8d, 0xba, 0x1c, 0x12, 0xab, 0x72, 0x58, 0x94, 0xe5, 0xd0, 0xa8, 0xcb,
+    0x21, 0x51, 0x95, 0x43, 0xa3, 0x2e, 0x87, 0x44, 0x55, 0x1e, 0x16, 0x65, 0x39, 0x1c, 0x45, 0x39,
+    0x2c, 0xca, 0x72, 0x78, 0x14, 0xe5, 0xb0, 0x28, 0xcb, 0xf7, 0xf0, 0xe0, 0x48, 0x51, 0x0e, 0x23,
+    0x67, 0xc0, 0x53, 0x99, 0x76, 0x6f, 0x00, 0xdc, 0x65, 0xda, 0xae, 0xa3, 0x40, 0xf4, 0x61, 0x11,
+    0xef, 0x58, 0xa7, 0x48, 0x27, 0x7b, 0xa2, 0xdd, 0x1c, 0x5e, 0xa4, 0xd6, 0x12, 0xf0, 0xcc, 0x2e,
+    0xef, 0x2f, 0x15, 0x20, 0x9b, 0x06, 0xd5, 0xa0, 0x18, 0x14, 0xb0, 0xf1, 0xdf, 0x70, 0x51, 0x8e,
+    0x68, 0x5f, 0x19, 0xa0, 0xd4, 0xac, 0x15, 0x3d, 0x4a, 0xb1, 0x27, 0x1d, 0xa4, 0x33, 0xf8, 0xfd,
+    0x1c, 0x6b, 0x75, 0x6f, 0x6b, 0x99, 0x65, 0x5a, 0x06, 0x9b, 0xb1, 0x19, 0x8b, 0xb1, 0x98, 0xe7,
+    0x7e, 0x12, 0xd8, 0x2c, 0x87, 0xdc, 0x32, 0x99, 0xc2, 0x69, 0xf9, 0xd8, 0x76, 0xdc, 0x80, 0x0e,
+    0x45, 0x73, 0xb6, 0xec, 0x8c, 0x29, 0x0d, 0x31, 0xa1, 0xc5, 0x6a, 0x15, 0xaf, 0x4e, 0xd8, 0x11,
+    0xba, 0x3a, 0x1f, 0x5a, 0x6c, 0xe8, 0x4b, 0xf1, 0x76, 0x32, 0x82, 0xc5, 0xd3, 0xae, 0xa1, 0xc5,
+    0x52, 0x50, 0xb4, 0x01, 0x2e, 0x50, 0x03, 0x1a, 0xd0, 0x01, 0x0d, 0x6a, 0x50, 0x0b, 0xca, 0x48,
+    0xae, 0xf7, 0x67, 0x93, 0xe9, 0x4c, 0x65, 0x2a, 0xa7, 0x32, 0x75, 0x63, 0x41, 0x72, 0xdc, 0x29,
+    0x73, 0x9e, 0x33, 0xc7, 0x6c, 0x33, 0x95, 0x29, 0x28, 0x71, 0x44, 0xb1, 0x83, 0xc7, 0xa1, 0x9a,
+    0x29, 0x51, 0x4e, 0x57, 0x79, 0xd5, 0x96, 0xc3, 0x54, 0x87, 0x24, 0x48, 0x3c, 0xed, 0x92, 0x3c,
+    0xf6, 0x40, 0x53, 0x08, 0x29, 0x73, 0x1c, 0x2f, 0x6b, 0x66, 0x34, 0x2a, 0xaf, 0xf0, 0x02, 0x79,
+    0xec, 0xe1, 0x10, 0xd9, 0xaa, 0x8c, 0xcb, 0x21, 0x09, 0x98, 0xba, 0x15, 0x53, 0xa6, 0x6e, 0x0b,
+    0xda, 0xdf, 0x91, 0x59, 0x8c, 0x48, 0x40, 0xdd, 0x22, 0x7e, 0x4c, 0x09, 0x2b, 0x66, 0x33, 0x24,
+    0xd0, 0x36, 0xf3, 0x7c, 0xbb, 0xa9, 0x6d, 0x96, 0x28, 0xc1, 0x28, 0xb8, 0xd3, 0x04, 0x88, 0x23,
+    0x1a, 0xb0, 0x72, 0xcb, 0x21, 0x79, 0x25, 0x03, 0x4f, 0x82, 0xf3, 0xbb, 0x6a, 0x9b, 0x25, 0xf2,
+    0xfb, 0xfb, 0x16, 0xa7, 0x3b, 0x46, 0x14, 0x70, 0x94, 0xec, 0x5a, 0xc0, 0xbd, 0xee, 0x94, 0x5b,
+    0x8c, 0x28, 0x60, 0x54, 0x4d, 0xf4, 0x8c, 0x96, 0x21, 0x0d, 0x34, 0x72, 0x8b, 0x8d, 0xee, 0x66,
+    0x66, 0x1f, 0x51, 0xc0, 0xca, 0x2d, 0x0d, 0x25, 0xe4, 0x5e, 0x94, 0x0d, 0xc8, 0x95, 0x85, 0x14,
+    0xd4, 0xb3, 0x2c, 0x8e, 0xe9, 0x65, 0x4a, 0x73, 0x79, 0x8c, 0xb1, 0x24, 0x8e, 0x28, 0x03, 0xcb,
+    0x9f, 0xcc, 0xd4, 0x3b, 0xd8, 0x33, 0x3e, 0xca, 0xc4, 0xf2, 0x97, 0x8b, 0x1f, 0x39, 0xe7, 0x93,
+    0x3c, 0x34, 0x65, 0xbf, 0x3c, 0xe7, 0x3b, 0x82, 0x29, 0x12, 0x86, 0xc4, 0x9a, 0xe4, 0x24, 0x0a,
+    0x6b, 0x05, 0x53, 0x14, 0x86, 0xa4, 0x35, 0xcb, 0x49, 0x81, 0x49, 0xd8, 0x91, 0x9c, 0x73, 0x89,
+    0x35, 0xcb, 0x01, 0xd2, 0xd3, 0x32, 0x9f, 0x95, 0xca, 0x59, 0x66, 0x36, 0x00, 0x28, 0x50, 0xcf,
+    0xb2, 0x38, 0xd2, 0xcb, 0x29, 0xcd, 0xf5, 0x09, 0x26, 0x72, 0xf0, 0xe6, 0x93, 0xcb, 0x94, 0x27,
+    0x41, 0xbf, 0x83, 0x1d, 0xf3, 0x59, 0x26, 0x26, 0x7f, 0x92, 0x40, 0xde, 0x2a, 0x5c, 0x52, 0x65,
+    0x41, 0xb0, 0x26, 0x51, 0x12, 0xa8, 0x26, 0x53, 0x91, 0xaf, 0xd5, 0xd5, 0x9a, 0xc2, 0xb7, 0x4b,
+    0xd8, 0x9d, 0x7e, 0x4c, 0xde, 0x58, 0x6e, 0x44, 0x27, 0xa2, 0x62, 0x54, 0x2f, 0x5a, 0x52, 0x93,
+    0x2e, 0xdc, 0xe8, 0x6b, 0x6f, 0xf1, 0x3b, 0xfd, 0x91, 0x1a, 0x2b, 0xab, 0x54, 0xf9, 0x35, 0x94,
+    0x27, 0x7c, 0xb7, 0xf4, 0xb7, 0xf2, 0xdf, 0x2e, 0xff, 0x46, 0xe0, 0x33, 0x32, 0xc4, 0x37, 0x87,
+    0x3f, 0x9e, 0xd0, 0x45, 0xc5, 0xb3, 0x2e, 0x37, 0x0d, 0x1b, 0xe5, 0xfc, 0x35, 0xc3, 0x46, 0x5a,
+    0x8e, 0x9b, 0xa0, 0xfc, 0xb4, 0x8b, 0x0d, 0x63, 0x45, 0xb1, 0x7f, 0x8d, 0xcd, 0x16, 0x63, 0xa2,
+    0x9f, 0xc7, 0x7e, 0x9e, 0xba, 0x39, 0x74, 0x72, 0xd9, 0xcf, 0x7f, 0xa2, 0xc9, 0x03, 0x4b, 0x1a,
+    0x36, 0xd2, 0x72, 0x3e, 0x95, 0x27, 0x63, 0xaa, 0x18, 0xdd, 0x0a, 0x07, 0x63, 0x60, 0x89, 0x28,
+    0xb5, 0x2f, 0xfd, 0x04, 0x38, 0x35, 0x0d, 0x00, 0x22, 0x0b, 0x21, 0x28, 0x90, 0x47, 0xcd, 0x01,
+    0x7b, 0x35, 0x62, 0x4e, 0x02, 0x25, 0xb1, 0xa9, 0xcf, 0x78, 0xde, 0x7b, 0x3c, 0x75, 0x89, 0xcd,
+    0x9d, 0xc0, 0xe6, 0x4e, 0x60, 0x73, 0x27, 0x66, 0xf3, 0xd6, 0xe7, 0x6c, 0xe8, 0x73, 0x12, 0xa8,
+    0x19, 0x25, 0x02, 0x36, 0x2f, 0x17, 0xa3, 0xee, 0xab, 0x95, 0x55, 0x68, 0x7b, 0x2a, 0x25, 0xf5,
+    0xc9, 0xfe, 0x4a, 0xbe, 0xce, 0xf5, 0xd3, 0xc8, 0x29, 0xe2, 0xe3, 0xa5, 0x90, 0x52, 0x4d, 0xc7,
+    0xbb, 0x51, 0x17, 0x93, 0xf1, 0x2d, 0xb4, 0xb5, 0x4c, 0x3c, 0xfb, 0x64, 0x6f, 0xbe, 0x5e, 0xe7,
+    0x3a, 0x99, 0xd9, 0x68, 0xf0, 0x5d, 0x1a, 0x2c, 0x53, 0x85, 0xa1, 0x44, 0x59, 0x98, 0x38, 0x89,
+    0x42, 0x42, 0x8b, 0x20, 0x1c, 0x30, 0xc8, 0x82, 0x15, 0x11, 0x0c, 0x3c, 0x20, 0x81, 0x00, 0xc7,
+    0x03, 0xd0, 0x60, 0x38, 0x0b, 0x45, 0x02, 0x51, 0x3d, 0x6c, 0x34, 0x94, 0x43, 0x06, 0x13, 0x81,
+    0x21, 0xa8, 0x41, 0xfa, 0xfe, 0x7f, 0x06, 0xd1, 0x37, 0x0a, 0xcb, 0x01, 0x12, 0x40, 0x50, 0x60,
+    0x08, 0x82, 0x20, 0x08, 0x96, 0x00, 0x21, 0x10, 0x11, 0x82, 0x84, 0x49, 0x08, 0x21, 0x84, 0x28,
+    0x61, 0x44, 0x50, 0x04, 0xb1, 0xe8, 0x03, 0x51, 0xb9, 0xb1, 0x65, 0x45, 0x94, 0x0f, 0x29, 0x23,
+    0xb6, 0x9c, 0x68, 0xf9, 0x82, 0xca, 0x0c, 0x28, 0x13, 0x50, 0x46, 0x60, 0x19, 0x81, 0x32, 0x22,
+    0x94, 0x19, 0x50, 0x26, 0xa0, 0x8c, 0xc0, 0x32, 0x02, 0x65, 0x04, 0x94, 0x19, 0xa1, 0x4c, 0x40,
+    0x19, 0x81, 0x65, 0x04, 0xca, 0x08, 0x28, 0x33, 0xa0, 0x9c, 0x80, 0x32, 0x02, 0xcb, 0x08, 0x94,
+    0x11, 0x50, 0x66, 0x40, 0x99, 0x80, 0x72, 0x04, 0x96, 0x11, 0x28, 0x23, 0xa0, 0xcc, 0x80, 0x32,
+    0x01, 0x65, 0x44, 0x2c, 0x23, 0x50, 0x46, 0x40, 0x99, 0x01, 0x65, 0x02, 0xca, 0x08, 0x2c, 0x23,
+    0xa2, 0x8c, 0x80, 0x32, 0x03, 0xca, 0x04, 0x94, 0x11, 0x58, 0x46, 0xa0, 0x1c, 0x01, 0x65, 0x06,
+    0x94, 0x09, 0x28, 0x23, 0xb0, 0x8c, 0x40, 0x19, 0x01, 0xe5, 0x0c, 0x01, 0xca, 0xc7, 0xaa, 0x84,
+    0x38, 0x52, 0x0d, 0x65, 0xa3, 0xaa, 0x7c, 0xac, 0x3d, 0xf9, 0x29, 0x3a, 0x36, 0xf7, 0x8d, 0x7b,
+    0x88, 0x71, 0x6f, 0x90, 0x14, 0xd8, 0x6b, 0xb0, 0xad, 0x68, 0xdc, 0x21, 0xc6, 0x7d, 0x93, 0x08,
+    0x90, 0xbf, 0x90, 0x6f, 0x63, 0x78, 0xc6, 0x6d, 0x82, 0xc9, 0x1f, 0x02, 0x9f, 0x95, 0xb7, 0x5a,
+    0x04, 0xbf, 0x70, 0x5f, 0x9d, 0x5a, 0x9d, 0xd9, 0xa2, 0x63, 0x73, 0xbf, 0x71, 0x87, 0x18, 0xf7,
+    0x26, 0xd8, 0x16, 0x2c, 0xd3, 0x2d, 0x25, 0x6c, 0xdc, 0x43, 0x8c, 0x7b, 0x93, 0xc2, 0x10, 0xef,
+    0x76, 0xe8, 0x64, 0x11, 0xfc, 0xc2, 0xbd, 0x7a, 0x4a, 0x96, 0x0e, 0xdb, 0x55, 0x1f, 0xf8, 0x8d,
+    0x3b, 0xc4, 0xb8, 0xb7, 0x83, 0xa9, 0x07, 0x17, 0xb8, 0xcd, 0x0e, 0xbd, 0xf3, 0xef, 0x08, 0x53,
+    0xcb, 0x14, 0x5c, 0xc8, 0x37, 0x4c, 0x67, 0xa9, 0xc8, 0x3a, 0x52, 0x3d, 0x54, 0x15, 0x37, 0xdc,
+    0x20, 0x11, 0x28, 0xb5, 0x2f, 0xfd, 0x04, 0x38, 0xad, 0x0d, 0x00, 0x62, 0xc9, 0x1e, 0x24, 0x90,
+    0x57, 0x6b, 0x7b, 0xed, 0xce, 0x18, 0xc2, 0x32, 0x33, 0x22, 0x10, 0x18, 0xad, 0x6f, 0x43, 0xa4,
+    0xc6, 0x36, 0x44, 0x22, 0x12, 0xa3, 0x29, 0x22, 0x24, 0x33, 0x8b, 0x18, 0xc9, 0xcc, 0x88, 0x90,
+    0xcc, 0x91, 0xb5, 0xd3, 0x28, 0xb7, 0xc9, 0x51, 0xbc, 0xf7, 0xff, 0x1f, 0xbb, 0xac, 0x6a, 0x14,
+    0xef, 0xff, 0x3f, 0x35, 0x49, 0x51, 0x08, 0x7e, 0xff, 0xff, 0x14, 0x7a, 0x1c, 0xaf, 0xe3, 0xfe,
+    0xff, 0x1b, 0x66, 0x51, 0x6c, 0xfd, 0xff, 0x3f, 0x41, 0x8e, 0x99, 0x6d, 0x2f, 0xa7, 0x6b, 0x77,
+    0xcf, 0x39, 0x5b, 0x4f, 0x20, 0x0e, 0x9b, 0xa1, 0x40, 0x18, 0x68, 0x82, 0x2c, 0x00, 0xc0, 0x2e,
+    0xab, 0xa2, 0x26, 0x29, 0xa2, 0xd0, 0xe3, 0x34, 0xcc, 0xa2, 0x24, 0xc8, 0xb1, 0x51, 0x2e, 0x14,
+    0xe4, 0x28, 0xde, 0x10, 0xfc, 0xbc, 0x8e, 0xb3, 0xf5, 0x80, 0xe4, 0xa8, 0xf1, 0xbe, 0x50, 0xac,
+    0xff, 0x1d, 0x90, 0x33, 0x4a, 0x0a, 0xf3, 0x12, 0xa0, 0x22, 0x08, 0x42, 0xc0, 0x30, 0x08, 0x97,
+    0x30, 0x08, 0x82, 0x30, 0x08, 0x93, 0x10, 0x45, 0x08, 0x21, 0x84, 0x10, 0xa2, 0x84, 0x13, 0x62,
+    0xa0, 0x09, 0x50, 0x1e, 0xc9, 0xeb, 0x25, 0xab, 0xee, 0x64, 0xde, 0x4a, 0x86, 0x9d, 0xc9, 0xee,
+    0x30, 0xe9, 0xbd, 0xc9, 0xda, 0x3d, 0x99, 0x5b, 0xc9, 0xb0, 0x33, 0xd9, 0x3b, 0x24, 0x81, 0xef,
+    0x27, 0x4a, 0x23, 0xa4, 0x96, 0xcd, 0xf9, 0x5b, 0x16, 0x8e, 0x6d, 0xd5, 0x4f, 0x14, 0xd5, 0x39,
+    0x12, 0x64, 0xca, 0xfb, 0xd8, 0x84, 0xbb, 0x7d, 0x22, 0xff, 0x28, 0x38, 0x32, 0x0f, 0x77, 0x7e,
+    0xac, 0xe4, 0xa8, 0xfd, 0x44, 0xde, 0x73, 0xc7, 0x11, 0xc3, 0xde, 0xb1, 0xf0, 0xe5, 0x60, 0xb1,
+    0x68, 0xd9, 0xe4, 0x88, 0xf9, 0x70, 0x1e, 0x5b, 0xce, 0x26, 0x2c, 0x16, 0x1d, 0x90, 0x39, 0x62,
+    0xc0, 0xde, 0x63, 0xbd, 0x5d, 0x58, 0xac, 0x43, 0x2a, 0x38, 0xe2, 0x17, 0xe5, 0x63, 0xd9, 0x39,
+    0x0c, 0x8b, 0x3d, 0x04, 0x11, 0x8e, 0x2c, 0x82, 0xfc, 0x58, 0xd2, 0xf6, 0xb0, 0x58, 0xc2, 0x7c,
+    0x71, 0x84, 0x24, 0xde, 0x38, 0x36, 0x66, 0x44, 0x2c, 0xf6, 0x10, 0x78, 0x1c, 0xf9, 0x43, 0x9a,
+    0xc7, 0xa2, 0x5d, 0x22, 0x47, 0x2c, 0xc2, 0x9d, 0xc7, 0x22, 0x86, 0xcb, 0x91, 0x61, 0x3f, 0x8f,
+    0x75, 0x98, 0x9a, 0x23, 0xca, 0x23, 0xa0, 0xc7, 0x1e, 0xf2, 0x3d, 0x47, 0x96, 0x16, 0x55, 0xb6,
+    0x12, 0xa1, 0x73, 0xa0, 0xf4, 0x58, 0x87, 0x4e, 0x28, 0x89, 0xc8, 0x40, 0xda, 0x33, 0x62, 0x07,
+    0xab, 0x6e, 0xe9, 0x4b, 0x4e, 0x15, 0x57, 0x47, 0x71, 0x40, 0xf1, 0x8d, 0xb4, 0x83, 0xa5, 0x1f,
+    0xf2, 0xbe, 0x93, 0xba, 0x4a, 0x69, 0x54, 0x06, 0x14, 0xbf, 0x48, 0xbb, 0x50, 0xfa, 0x51, 0xee,
+    0x3b, 0xa9, 0x05, 0x57, 0x26, 0xfd, 0x86, 0x6d, 0xda, 0xa5, 0x9f, 0xf4, 0x0b, 0xb7, 0x5e, 0xbd,
+    0xfa, 0x52, 0x75, 0x4b, 0x3f, 0xe4, 0x4b, 0xbe, 0xd6, 0x55, 0xfd, 0x90, 0xfb, 0xf2, 0x89, 0x65,
+    0xf2, 0x1b, 0x83, 0x67, 0x7d, 0x18, 0xcd, 0xc7, 0x13, 0x3e, 0x59, 0x8a, 0xae, 0x9e, 0x51, 0x15,
+    0x33, 0x13, 0x4e, 0x11,
+};
+
+static const uint8_t FseqZstdLargeWindow[1956] =
+{
+    0x50, 0x53, 0x45, 0x51, 0x40, 0x00, 0x01, 0x02, 0x40, 0x00, 0x2c, 0x01, 0x00, 0x00, 0xa0, 0x00,
+    0x00, 0x00, 0x19, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xef, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0xb5, 0x2f, 0xfd, 0x04, 0x68, 0x15, 0x1f, 0x00, 0x36, 0x26, 0x55, 0x25, 0x90, 0xd5, 0x35,
+    0x03, 0xab, 0x10, 0x96, 0x69, 0x22, 0x42, 0x10, 0x8c, 0x65, 0x36, 0x7a, 0x12, 0x29, 0xca, 0x4a,
+    0xc7, 0x10, 0x84, 0x10, 0x62, 0xee, 0x19, 0x11, 0x04, 0x63, 0x32, 0x8b, 0x18, 0xc2, 0x24, 0x13,
+    0x33, 0x7f, 0x51, 0x00, 0x45, 0x00, 0x4a, 0x00, 0xff, 0xc2, 0xff, 0xe0, 0xff, 0x93, 0x0b, 0x3d,
+    0x7c, 0xcf, 0x5f, 0xb5, 0xf1, 0x5d, 0x43, 0x45, 0x11, 0x6a, 0xbd, 0xd2, 0xc4, 0x57, 0x16, 0x24,
+    0x01, 0xf4, 0x8f, 0xe9, 0xb8, 0xcb, 0xc1, 0xc7, 0xf3, 0x65, 0xac, 0xf4, 0x34, 0x74, 0xbc, 0x0c,
+    0x7c, 0x3c, 0x5f, 0x87, 0xb3, 0xf1, 0x34, 0x19, 0x4c, 0xc7, 0xb5, 0x54, 0x6e, 0x94, 0x89, 0x26,
+    0x89, 0x04, 0x40, 0x1e, 0x8e, 0x06, 0x63, 0xa1, 0x48, 0x00, 0x64, 0x18, 0xe2, 0x70, 0x59, 0x86,
+    0x8a, 0x9a, 0x0a, 0x12, 0x21, 0x1a, 0x08, 0xa0, 0x01, 0x9d, 0xd4, 0x98, 0x98, 0x83, 0x58, 0x49,
+    0x4d, 0xc2, 0x96, 0x96, 0x9f, 0xd6, 0x47, 0x2e, 0x34, 0x25, 0x25, 0xe7, 0x74, 0xf1, 0x37, 0x32,
+    0x32, 0x33, 0x9a, 0xd5, 0x7a, 0x3b, 0x3a, 0x5e, 0x06, 0x5e, 0x21, 0xbb, 0x15, 0x15, 0xb7, 0x9d,
+    0x54, 0xc6, 0xca, 0x58, 0xac, 0xa4, 0x26, 0x21, 0xc0, 0xc9, 0x56, 0xeb, 0x23, 0x17, 0x7a, 0x18,
+    0xf0, 0x74, 0xba, 0xf8, 0xab, 0x36, 0x8e, 0x46, 0xb3, 0x5a, 0xaf, 0x34, 0x71, 0x60, 0xb3, 0x90,
+    0x5d, 0x41, 0xc4, 0xc8, 0xcc, 0xe8, 0x95, 0xb1, 0xd2, 0xd3, 0xd0, 0xf1, 0x32, 0x90, 0x0a, 0x70,
+    0x72, 0xb3, 0x50, 0x71, 0xdb, 0x49, 0x78, 0x18, 0x10, 0x73, 0x10, 0x2b, 0xa9, 0x09, 0xad, 0x36,
+    0x5a, 0x7e, 0x5a, 0x1f, 0xb9, 0x5f, 0x69, 0x22, 0x25, 0xe7, 0x74, 0xb1, 0x57, 0x10, 0x31, 0x32,
+    0x33, 0x9a, 0xd5, 0x76, 0x9e, 0x86, 0x8e, 0x97, 0x81, 0x57, 0xc8, 0xca, 0xcd, 0x42, 0xc5, 0x6d,
+    0x27, 0x95, 0x71, 0x72, 0xb3, 0x50, 0x71, 0x1b, 0x59, 0xed, 0x0a, 0xa1, 0x32, 0x62, 0xb6, 0xfc,
+    0xb4, 0xb6, 0xe4, 0x9c, 0x2e, 0x9e, 0x19, 0xcd, 0x6a, 0xbd, 0xd2, 0xd4, 0x4b, 0xec, 0x76, 0x10,
+    0x7b, 0x59, 0xb9, 0xd0, 0xc3, 0x8a, 0x9a, 0xfe, 0x56, 0x53, 0x66, 0x46, 0xb3, 0x5a, 0xaf, 0x34,
+    0x31, 0xf2, 0x32, 0xf0, 0x0a, 0xd9, 0x15, 0x44, 0x74, 0xdc, 0x76, 0xa8, 0x8c, 0x95, 0x9e, 0x86,
+    0x8a, 0x0f, 0x57, 0x3b, 0x2e, 0xf4, 0x77, 0xa3, 0x4c, 0xb4, 0x9e, 0x34, 0x91, 0x92, 0x73, 0x0a,
+    0x82, 0xd2, 0xa8, 0x22, 0xca, 0x4b, 0xd2, 0xfe, 0x6f, 0x92, 0xcf, 0x48, 0x92, 0x74, 0x12, 0xc0,
+    0x30, 0x10, 0x86, 0x08, 0x41, 0x14, 0xd2, 0x30, 0x0c, 0x85, 0x41, 0x10, 0x22, 0x46, 0x2b, 0x62,
+    0xac, 0x11, 0x19, 0x49, 0x93, 0x87, 0xa4, 0x03, 0x51, 0xca, 0x61, 0x51, 0x96, 0xc3, 0xa3, 0x28,
+    0x87, 0x44, 0x55, 0x0e, 0x8d, 0xba, 0x1c, 0x12, 0xab, 0x72, 0x58, 0x94, 0xe5, 0xd0, 0xa8, 0xcb,
+    0x21, 0x51, 0x95, 0x43, 0xa3, 0x2e, 0x87, 0x44, 0x55, 0x1e, 0x16, 0x65, 0x39, 0x1c, 0x45, 0x39,
+    0x2c, 0xca, 0x72, 0x78, 0x14, 0xe5, 0xb0, 0x28, 0xcb, 0xf7, 0xf0, 0xe0, 0x48, 0x51, 0x0e, 0x23,
+    0x67, 0xc0, 0x53, 0x99, 0x76, 0x6f, 0x00, 0xdc, 0x65, 0xda, 0xae, 0xa3, 0x40, 0xf4, 0x61, 0x11,
+    0xef, 0x58, 0xa7, 0x48, 0x27, 0x7b, 0xa2, 0xdd, 0x1c, 0x5e, 0xa4, 0xd6, 0x12, 0xf0, 0xcc, 0x2e,
+    0xef, 0x2f, 0x15, 0x20, 0x9b, 0x06, 0xd5, 0xa0, 0x18, 0x14, 0xb0, 0xf1, 0xdf, 0x70, 0x51, 0x8e,
+    0x68, 0x5f, 0x19, 0xa0, 0xd4, 0xac, 0x15, 0x3d, 0x4a, 0xb1, 0x27, 0x1d, 0xa4, 0x33, 0xf8, 0xfd,
+    0x1c, 0x6b, 0x75, 0x6f, 0x6b, 0x99, 0x65, 0x5a, 0x06, 0x9b, 0xb1, 0x19, 0x8b, 0xb1, 0x98, 0xe7,
+    0x7e, 0x12, 0xd8, 0x2c, 0x87, 0xdc, 0x32, 0x99, 0xc2, 0x69, 0xf9, 0xd8, 0x76, 0xdc, 0x80, 0x0e,
+    0x45, 0x73, 0xb6, 0xec, 0x8c, 0x29, 0x0d, 0x31, 0xa1, 0xc5, 0x6a, 0x15, 0xaf, 0x4e, 0xd8, 0x11,
+    0xba, 0x3a, 0x1f, 0x5a, 0x6c, 0xe8, 0x4b, 0xf1, 0x76, 0x32, 0x82, 0xc5, 0xd3, 0xae, 0xa1, 0xc5,
+    0x52, 0x50, 0xb4, 0x01, 0x2e, 0x50, 0x03, 0x1a, 0xd0, 0x01, 0x0d, 0x6a, 0x50, 0x0b, 0xca, 0x48,
+    0xae, 0xf7, 0x67, 0x93, 0xe9, 0x4c, 0x65, 0x2a, 0xa7, 0x32, 0x75, 0x63, 0x41, 0x72, 0xdc, 0x29,
+    0x73, 0x9e, 0x33, 0xc7, 0x6c, 0x33, 0x95, 0x29, 0x28, 0x71, 0x44, 0xb1, 0x83, 0xc7, 0xa1, 0x9a,
+    0x29, 0x51, 0x4e, 0x57, 0x79, 0xd5, 0x96, 0xc3, 0x54, 0x87, 0x24, 0x48, 0x3c, 0xed, 0x92, 0x3c,
+    0xf6, 0x40, 0x53, 0x08, 0x29, 0x73, 0x1c, 0x2f, 0x6b, 0x66, 0x34, 0x2a, 0xaf, 0xf0, 0x02, 0x79,
+    0xec, 0xe1, 0x10, 0xd9, 0xaa, 0x8c, 0xcb, 0x21, 0x09, 0x98, 0xba, 0x15, 0x53, 0xa6, 0x6e, 0x0b,
+    0xda, 0xdf, 0x91, 0x59, 0x8c, 0x48, 0x40, 0xdd, 0x22, 0x7e, 0x4c, 0x09, 0x2b, 0x66, 0x33, 0x24,
+    0xd0, 0x36, 0xf3, 0x7c, 0xbb, 0xa9, 0x6d, 0x96, 0x28, 0xc1, 0x28, 0xb8, 0xd3, 0x04, 0x88, 0x23,
+    0x1a, 0xb0, 0x72, 0xcb, 0x21, 0x79, 0x25, 0x03, 0x4f, 0x82, 0xf3, 0xbb, 0x6a, 0x9b, 0x25, 0xf2,
+    0xfb, 0xfb, 0x16, 0xa7, 0x3b, 0x46, 0x14, 0x70, 0x94, 0xec, 0x5a, 0xc0, 0xbd, 0xee, 0x94, 0x5b,
+    0x8c, 0x28, 0x60, 0x54, 0x4d, 0xf4, 0x8c, 0x96, 0x21, 0x0d, 0x34, 0x72, 0x8b, 0x8d, 0xee, 0x66,
+    0x66, 0x1f, 0x51, 0xc0, 0xca, 0x2d, 0x0d, 0x25, 0xe4, 0x5e, 0x94, 0x0d, 0xc8, 0x95, 0x85, 0x14,
+    0xd4, 0xb3, 0x2c, 0x8e, 0xe9, 0x65, 0x4a, 0x73, 0x79, 0x8c, 0xb1, 0x24, 0x8e, 0x28, 0x03, 0xcb,
+    0x9f, 0xcc, 0xd4, 0x3b, 0xd8, 0x33, 0x3e, 0xca, 0xc4, 0xf2, 0x97, 0x8b, 0x1f, 0x39, 0xe7, 0x93,
+    0x3c, 0x34, 0x65, 0xbf, 0x3c, 0xe7, 0x3b, 0x82, 0x29, 0x12, 0x86, 0xc4, 0x9a, 0xe4, 0x24, 0x0a,
+    0x6b, 0x05, 0x53, 0x14, 0x86, 0xa4, 0x35, 0xcb, 0x49, 0x81, 0x49, 0xd8, 0x91, 0x9c, 0x73, 0x89,
+    0x35, 0xcb, 0x01, 0xd2, 0xd3, 0x32, 0x9f, 0x95, 0xca, 0x59, 0x66, 0x36, 0x00, 0x28, 0x50, 0xcf,
+    0xb2, 0x38, 0xd2, 0xcb, 0x29, 0xcd, 0xf5, 0x09, 0x26, 0x72, 0xf0, 0xe6, 0x93, 0xcb, 0x94, 0x27,
+    0x41, 0xbf, 0x83, 0x1d, 0xf3, 0x59, 0x26, 0x26, 0x7f, 0x92, 0x40, 0xde, 0x2a, 0x5c, 0x52, 0x65,
+    0x41, 0xb0, 0x26, 0x51, 0x12, 0xa8, 0x26, 0x53, 0x91, 0xaf, 0xd5, 0xd5, 0x9a, 0xc2, 0xb7, 0x4b,
+    0xd8, 0x9d, 0x7e, 0x4c, 0xde, 0x58, 0x6e, 0x44, 0x27, 0xa2, 0x62, 0x54, 0x2f, 0x5a, 0x52, 0x93,
+    0x2e, 0xdc, 0xe8, 0x6b, 0x6f, 0xf1, 0x3b, 0xfd, 0x91, 0x1a, 0x2b, 0xab, 0x54, 0xf9, 0x35, 0x94,
+    0x27, 0x7c, 0xb7, 0xf4, 0xb7, 0xf2, 0xdf, 0x2e, 0xff, 0x46, 0xe0, 0x33, 0x32, 0xc4, 0x37, 0x87,
+    0x3f, 0x9e, 0xd0, 0x45, 0xc5, 0xb3, 0x2e, 0x37, 0x0d, 0x1b, 0xe5, 0xfc, 0x35, 0xc3, 0x46, 0x5a,
+    0x8e, 0x9b, 0xa0, 0xfc, 0xb4, 0x8b, 0x0d, 0x63, 0x45, 0xb1, 0x7f, 0x8d, 0xcd, 0x16, 0x63, 0xa2,
+    0x9f, 0xc7, 0x7e, 0x9e, 0xba, 0x39, 0x74, 0x72, 0xd9, 0xcf, 0x7f, 0xa2, 0xc9, 0x03, 0x4b, 0x1a,
+    0x36, 0xd2, 0x72, 0x3e, 0x95, 0x27, 0x63, 0xaa, 0x18, 0xdd, 0x0a, 0x07, 0x63, 0x60, 0x89, 0x28,
+    0xb5, 0x2f, 0xfd, 0x04, 0x68, 0x35, 0x0d, 0x00, 0x22, 0x0b, 0x21, 0x28, 0x90, 0x47, 0xcd, 0x01,
+    0x7b, 0x35, 0x62, 0x4e, 0x02, 0x25, 0xb1, 0xa9, 0xcf, 0x78, 0xde, 0x7b, 0x3c, 0x75, 0x89, 0xcd,
+    0x9d, 0xc0, 0xe6, 0x4e, 0x60, 0x73, 0x27, 0x66, 0xf3, 0xd6, 0xe7, 0x6c, 0xe8, 0x73, 0x12, 0xa8,
+    0x19, 0x25, 0x02, 0x36, 0x2f, 0x17, 0xa3, 0xee, 0xab, 0x95, 0x55, 0x68, 0x7b, 0x2a, 0x25, 0xf5,
+    0xc9, 0xfe, 0x4a, 0xbe, 0xce, 0xf5, 0xd3, 0xc8, 0x29, 0xe2, 0xe3, 0xa5, 0x90, 0x52, 0x4d, 0xc7,
+    0xbb, 0x51, 0x17, 0x93, 0xf1, 0x2d, 0xb4, 0xb5, 0x4c, 0x3c, 0xfb, 0x64, 0x6f, 0xbe, 0x5e, 0xe7,
+    0x3a, 0x99, 0xd9, 0x68, 0xf0, 0x5d, 0x1a, 0x2c, 0x53, 0x85, 0xa1, 0x44, 0x59, 0x98, 0x38, 0x89,
+    0x42, 0x42, 0x8b, 0x20, 0x1c, 0x30, 0xc8, 0x82, 0x15, 0x11, 0x0c, 0x3c, 0x20, 0x81, 0x00, 0xc7,
+    0x03, 0xd0, 0x60, 0x38, 0x0b, 0x45, 0x02, 0x51, 0x3d, 0x6c, 0x34, 0x94, 0x43, 0x06, 0x13, 0x81,
+    0x21, 0xa8, 0x41, 0xfa, 0xfe, 0x7f, 0x06, 0xd1, 0x37, 0x0a, 0xcb, 0x01, 0x12, 0x40, 0x50, 0x60,
+    0x08, 0x82, 0x20, 0x08, 0x96, 0x00, 0x21, 0x10, 0x11, 0x82, 0x84, 0x49, 0x08, 0x21, 0x84, 0x28,
+    0x61, 0x44, 0x50, 0x04, 0xb1, 0xe8, 0x03, 0x51, 0xb9, 0xb1, 0x65, 0x45, 0x94, 0x0f, 0x29, 0x23,
+    0xb6, 0x9c, 0x68, 0xf9, 0x82, 0xca, 0x0c, 0x28, 0x13, 0x50, 0x46, 0x60, 0x19, 0x81, 0x32, 0x22,
+    0x94, 0x19, 0x50, 0x26, 0xa0, 0x8c, 0xc0, 0x32, 0x02, 0x65, 0x04, 0x94, 0x19, 0xa1, 0x4c, 0x40,
+    0x19, 0x81, 0x65, 0x04, 0xca, 0x08, 0x28, 0x33, 0xa0, 0x9c, 0x80, 0x32, 0x02, 0xcb, 0x08, 0x94,
+    0x11, 0x50, 0x66, 0x40, 0x99, 0x80, 0x72, 0x04, 0x96, 0x11, 0x28, 0x23, 0xa0, 0xcc, 0x80, 0x32,
+    0x01, 0x65, 0x44, 0x2c, 0x23, 0x50, 0x46, 0x40, 0x99, 0x01, 0x65, 0x02, 0xca, 0x08, 0x2c, 0x23,
+    0xa2, 0x8c, 0x80, 0x32, 0x03, 0xca, 0x04, 0x94, 0x11, 0x58, 0x46, 0xa0, 0x1c, 0x01, 0x65, 0x06,
+    0x94, 0x09, 0x28, 0x23, 0xb0, 0x8c, 0x40, 0x19, 0x01, 0xe5, 0x0c, 0x01, 0xca, 0xc7, 0xaa, 0x84,
+    0x38, 0x52, 0x0d, 0x65, 0xa3, 0xaa, 0x7c, 0xac, 0x3d, 0xf9, 0x29, 0x3a, 0x36, 0xf7, 0x8d, 0x7b,
+    0x88, 0x71, 0x6f, 0x90, 0x14, 0xd8, 0x6b, 0xb0, 0xad, 0x68, 0xdc, 0x21, 0xc6, 0x7d, 0x93, 0x08,
+    0x90, 0xbf, 0x90, 0x6f, 0x63, 0x78, 0xc6, 0x6d, 0x82, 0xc9, 0x1f, 0x02, 0x9f, 0x95, 0xb7, 0x5a,
+    0x04, 0xbf, 0x70, 0x5f, 0x9d, 0x5a, 0x9d, 0xd9, 0xa2, 0x63, 0x73, 0xbf, 0x71, 0x87, 0x18, 0xf7,
+    0x26, 0xd8, 0x16, 0x2c, 0xd3, 0x2d, 0x25, 0x6c, 0xdc, 0x43, 0x8c, 0x7b, 0x93, 0xc2, 0x10, 0xef,
+    0x76, 0xe8, 0x64, 0x11, 0xfc, 0xc2, 0xbd, 0x7a, 0x4a, 0x96, 0x0e, 0xdb, 0x55, 0x1f, 0xf8, 0x8d,
+    0x3b, 0xc4, 0xb8, 0xb7, 0x83, 0xa9, 0x07, 0x17, 0xb8, 0xcd, 0x0e, 0xbd, 0xf3, 0xef, 0x08, 0x53,
+    0xcb, 0x14, 0x5c, 0xc8, 0x37, 0x4c, 0x67, 0xa9, 0xc8, 0x3a, 0x52, 0x3d, 0x54, 0x15, 0x37, 0xdc,
+    0x20, 0x11, 0x28, 0xb5, 0x2f, 0xfd, 0x04, 0x68, 0xad, 0x0d, 0x00, 0x62, 0xc9, 0x1e, 0x24, 0x90,
+    0x57, 0x6b, 0x7b, 0xed, 0xce, 0x18, 0xc2, 0x32, 0x33, 0x22, 0x10, 0x18, 0xad, 0x6f, 0x43, 0xa4,
+    0xc6, 0x36, 0x44, 0x22, 0x12, 0xa3, 0x29, 0x22, 0x24, 0x33, 0x8b, 0x18, 0xc9, 0xcc, 0x88, 0x90,
+    0xcc, 0x91, 0xb5, 0xd3, 0x28, 0xb7, 0xc9, 0x51, 0xbc, 0xf7, 0xff, 0x1f, 0xbb, 0xac, 0x6a, 0x14,
+    0xef, 0xff, 0x3f, 0x35, 0x49, 0x51, 0x08, 0x7e, 0xff, 0xff, 0x14, 0x7a, 0x1c, 0xaf, 0xe3, 0xfe,
+    0xff, 0x1b, 0x66, 0x51, 0x6c, 0xfd, 0xff, 0x3f, 0x41, 0x8e, 0x99, 0x6d, 0x2f, 0xa7, 0x6b, 0x77,
+    0xcf, 0x39, 0x5b, 0x4f, 0x20, 0x0e, 0x9b, 0xa1, 0x40, 0x18, 0x68, 0x82, 0x2c, 0x00, 0xc0, 0x2e,
+    0xab, 0xa2, 0x26, 0x29, 0xa2, 0xd0, 0xe3, 0x34, 0xcc, 0xa2, 0x24, 0xc8, 0xb1, 0x51, 0x2e, 0x14,
+    0xe4, 0x28, 0xde, 0x10, 0xfc, 0xbc, 0x8e, 0xb3, 0xf5, 0x80, 0xe4, 0xa8, 0xf1, 0xbe, 0x50, 0xac,
+    0xff, 0x1d, 0x90, 0x33, 0x4a, 0x0a, 0xf3, 0x12, 0xa0, 0x22, 0x08, 0x42, 0xc0, 0x30, 0x08, 0x97,
+    0x30, 0x08, 0x82, 0x30, 0x08, 0x93, 0x10, 0x45, 0x08, 0x21, 0x84, 0x10, 0xa2, 0x84, 0x13, 0x62,
+    0xa0, 0x09, 0x50, 0x1e, 0xc9, 0xeb, 0x25, 0xab, 0xee, 0x64, 0xde, 0x4a, 0x86, 0x9d, 0xc9, 0xee,
+    0x30, 0xe9, 0xbd, 0xc9, 0xda, 0x3d, 0x99, 0x5b, 0xc9, 0xb0, 0x33, 0xd9, 0x3b, 0x24, 0x81, 0xef,
+    0x27, 0x4a, 0x23, 0xa4, 0x96, 0xcd, 0xf9, 0x5b, 0x16, 0x8e, 0x6d, 0xd5, 0x4f, 0x14, 0xd5, 0x39,
+    0x12, 0x64, 0xca, 0xfb, 0xd8, 0x84, 0xbb, 0x7d, 0x22, 0xff, 0x28, 0x38, 0x32, 0x0f, 0x77, 0x7e,
+    0xac, 0xe4, 0xa8, 0xfd, 0x44, 0xde, 0x73, 0xc7, 0x11, 0xc3, 0xde, 0xb1, 0xf0, 0xe5, 0x60, 0xb1,
+    0x68, 0xd9, 0xe4, 0x88, 0xf9, 0x70, 0x1e, 0x5b, 0xce, 0x26, 0x2c, 0x16, 0x1d, 0x90, 0x39, 0x62,
+    0xc0, 0xde, 0x63, 0xbd, 0x5d, 0x58, 0xac, 0x43, 0x2a, 0x38, 0xe2, 0x17, 0xe5, 0x63, 0xd9, 0x39,
+    0x0c, 0x8b, 0x3d, 0x04, 0x11, 0x8e, 0x2c, 0x82, 0xfc, 0x58, 0xd2, 0xf6, 0xb0, 0x58, 0xc2, 0x7c,
+    0x71, 0x84, 0x24, 0xde, 0x38, 0x36, 0x66, 0x44, 0x2c, 0xf6, 0x10, 0x78, 0x1c, 0xf9, 0x43, 0x9a,
+    0xc7, 0xa2, 0x5d, 0x22, 0x47, 0x2c, 0xc2, 0x9d, 0xc7, 0x22, 0x86, 0xcb, 0x91, 0x61, 0x3f, 0x8f,
+    0x75, 0x98, 0x9a, 0x23, 0xca, 0x23, 0xa0, 0xc7, 0x1e, 0xf2, 0x3d, 0x47, 0x96, 0x16, 0x55, 0xb6,
+    0x12, 0xa1, 0x73, 0xa0, 0xf4, 0x58, 0x87, 0x4e, 0x28, 0x89, 0xc8, 0x40, 0xda, 0x33, 0x62, 0x07,
+    0xab, 0x6e, 0xe9, 0x4b, 0x4e, 0x15, 0x57, 0x47, 0x71, 0x40, 0xf1, 0x8d, 0xb4, 0x83, 0xa5, 0x1f,
+    0xf2, 0xbe, 0x93, 0xba, 0x4a, 0x69, 0x54, 0x06, 0x14, 0xbf, 0x48, 0xbb, 0x50, 0xfa, 0x51, 0xee,
+    0x3b, 0xa9, 0x05, 0x57, 0x26, 0xfd, 0x86, 0x6d, 0xda, 0xa5, 0x9f, 0xf4, 0x0b, 0xb7, 0x5e, 0xbd,
+    0xfa, 0x52, 0x75, 0x4b, 0x3f, 0xe4, 0x4b, 0xbe, 0xd6, 0x55, 0xfd, 0x90, 0xfb, 0xf2, 0x89, 0x65,
+    0xf2, 0x1b, 0x83, 0x67, 0x7d, 0x18, 0xcd, 0xc7, 0x13, 0x3e, 0x59, 0x8a, 0xae, 0x9e, 0x51, 0x15,
+    0x33, 0x13, 0x4e, 0x11,
+};
+
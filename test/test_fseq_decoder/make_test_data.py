@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+#
+# make_test_data.py - Write the compressed FSEQ files used by test_fseq_decoder
+#
+# Needs the zstd command line tool. Run from this directory:
+#   python3 make_test_data.py > fseq_test_data.h
+#
+# The frame data must match TestChannelValue in test_main.cpp
+
+import struct
+import subprocess
+import zlib
+
+NUM_CHANNELS = 300
+NUM_FRAMES = 160
+FRAMES_PER_BLOCK = 64
+SPARE_BLOCK_ENTRIES = 1
+
+
+def channel_value(frame, channel):
+    # a chase over a gradient with a marker that moves at another speed
+    if (channel % 37) == (frame % 37):
+        return 0xaa
+    return (((channel + (frame * 3)) % 50) * 5) & 0xff
+
+
+def frame_data(first, count):
+    data = bytearray()
+    for frame in range(first, first + count):
+        data += bytes(channel_value(frame, channel) for channel in range(NUM_CHANNELS))
+    return bytes(data)
+
+
+def zstd(data, *options):
+    # --no-content-size makes the frame header look like the one from a streaming encoder
+    return subprocess.run(['zstd', '-q', '-c', '--no-content-size'] + list(options),
+                          input=data, stdout=subprocess.PIPE, check=True).stdout
+
+
+def zlib_window(data, window_bits):
+    encoder = zlib.compressobj(6, zlib.DEFLATED, window_bits)
+    return encoder.compress(data) + encoder.flush()
+
+
+def make_fseq(compression_type, compress):
+    blocks = []
+    for first in range(0, NUM_FRAMES, FRAMES_PER_BLOCK):
+        count = min(FRAMES_PER_BLOCK, NUM_FRAMES - first)
+        blocks.append((first, compress(frame_data(first, count))))
+
+    num_entries = len(blocks) + SPARE_BLOCK_ENTRIES
+    data_offset = 32 + (num_entries * 8)
+    header = b'PSEQ' + struct.pack('<HBBHIIBBBBBB8s',
+                                   data_offset, 1, 2, data_offset,
+                                   NUM_CHANNELS, NUM_FRAMES, 25, 0,
+                                   compression_type | ((num_entries >> 4) & 0xf0),
+                                   num_entries & 0xff, 0, 0, b'\0' * 8)
+    table = b''.join(struct.pack('<II', first, len(block)) for first, block in blocks)
+    table += b'\0' * (8 * SPARE_BLOCK_ENTRIES)
+    return header + table + b''.join(block for _, block in blocks)
+
+
+def print_array(name, data):
+    print('static const uint8_t %s[%u] =\n{' % (name, len(data)))
+    for offset in range(0, len(data), 16):
+        print('    ' + ', '.join('0x%02x' % value for value in data[offset:offset + 16]) + ',')
+    print('};\n')
+
+
+print('// Generated by make_test_data.py. Do not edit.')
+print('#pragma once\n')
+print('#define TEST_FSEQ_NUM_CHANNELS %u' % NUM_CHANNELS)
+print('#define TEST_FSEQ_NUM_FRAMES   %u\n' % NUM_FRAMES)
+print_array('FseqZlib', make_fseq(2, lambda data: zlib.compress(data, 6)))
+print_array('FseqZlibSmallWindow', make_fseq(2, lambda data: zlib_window(data, 10)))
+print_array('FseqZstd', make_fseq(1, lambda data: zstd(data, '-3', '--zstd=wlog=17')))
+print_array('FseqZstdLargeWindow', make_fseq(1, lambda data: zstd(data, '-3', '--zstd=wlog=23')))
@@ -0,0 +1,248 @@
+/*
+* test_main.cpp - Host checks for the compressed FSEQ decoder
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Every frame of the zstd and zlib files must decode to exactly the
+*   uncompressed frame. The files are generated by make_test_data.py.
+*
+*   Run with: pio test -e native -f test_fseq_decoder
+*
+*/
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "input/InputFPPRemotePlayFileDecoder.hpp"
+#include "fseq_test_data.h"
+
+static c_InputFPPRemotePlayFileDecoder Decoder;
+
+//----------------------------------------------------------------------------
+// Must match channel_value in make_test_data.py
+static uint8_t TestChannelValue (uint32_t FrameId, uint32_t ChannelId)
+{
+    if ((ChannelId % 37) == (FrameId % 37))
+    {
+        return 0xaa;
+    }
+    return uint8_t (((ChannelId + (FrameId * 3)) % 50) * 5);
+
+} // TestChannelValue
+
+//----------------------------------------------------------------------------
+static std::vector<uint8_t> MakeFrame (uint32_t FrameId)
+{
+    std::vector<uint8_t> Frame (TEST_FSEQ_NUM_CHANNELS);
+    for (uint32_t ChannelId = 0; ChannelId < TEST_FSEQ_NUM_CHANNELS; ++ChannelId)
+    {
+        Frame[ChannelId] = TestChannelValue (FrameId, ChannelId);
+    }
+    return Frame;
+
+} // MakeFrame
+
+//----------------------------------------------------------------------------
+static FSEQParsedHeader ParseHeader (const uint8_t * pFile)
+{
+    FSEQRawHeader Raw;
+    memcpy (&Raw, pFile, sizeof (Raw));
+
+    FSEQParsedHeader Header = {};
+    Header.dataOffset                    = read16 (Raw.dataOffset);
+    Header.minorVersion                  = Raw.minorVersion;
+    Header.majorVersion                  = Raw.majorVersion;
+    Header.VariableHdrOffset             = read16 (Raw.VariableHdrOffset);
+    Header.channelCount                  = read32 (Raw.channelCount, 0);
+    Header.TotalNumberOfFramesInSequence = read32 (Raw.TotalNumberOfFramesInSequence, 0);
+    Header.stepTime                      = Raw.stepTime;
+    Header.compressionType               = Raw.compressionType & FSEQ_COMPRESSION_TYPE_MASK;
+    Header.numCompressedBlocks           = Raw.numCompressedBlocks + (uint16_t (Raw.compressionType & FSEQ_COMPRESSED_BLOCK_COUNT_MASK) << 4);
+    return Header;
+
+} // ParseHeader
+
+//----------------------------------------------------------------------------
+static bool BeginFile (const uint8_t * pFile, uint32_t FileSize)
+{
+    auto ReadHandler = [pFile, FileSize] (uint8_t * Buffer, uint32_t NumBytes, uint32_t FileOffset)
+    {
+        uint32_t BytesToRead = (FileOffset < FileSize) ? std::min (NumBytes, FileSize - FileOffset) : 0;
+        memcpy (Buffer, &pFile[FileOffset], BytesToRead);
+        return BytesToRead;
+    };
+
+    FSEQParsedHeader Header = ParseHeader (pFile);
+    return Decoder.Begin (ReadHandler, FileSize, Header);
+
+} // BeginFile
+
+//----------------------------------------------------------------------------
+static void CheckFrames (const uint8_t * pFile, uint32_t FileSize, const std::vector<uint32_t> & FrameIds)
+{
+    TEST_ASSERT_TRUE_MESSAGE (BeginFile (pFile, FileSize), Decoder.GetErrorMsg ());
+
+    for (auto FrameId : FrameIds)
+    {
+        char Name[32];
+        snprintf (Name, sizeof (Name), "frame %u", FrameId);
+
+        const uint8_t * pFrame = Decoder.GetFrame (FrameId);
+        TEST_ASSERT_NOT_NULL_MESSAGE (pFrame, Name);
+        std::vector<uint8_t> Expected = MakeFrame (FrameId);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE (Expected.data (), pFrame, Expected.size (), Name);
+    }
+
+    Decoder.End ();
+
+} // CheckFrames
+
+//----------------------------------------------------------------------------
+static std::vector<uint32_t> AllFrames ()
+{
+    std::vector<uint32_t> FrameIds;
+    for (uint32_t FrameId = 0; FrameId < TEST_FSEQ_NUM_FRAMES; ++FrameId)
+    {
+        FrameIds.push_back (FrameId);
+    }
+    return FrameIds;
+
+} // AllFrames
+
+//----------------------------------------------------------------------------
+// Backwards in a block, into the next block, back to an earlier block and skipping windows
+static const std::vector<uint32_t> SeekFrames = {5, 3, 40, 70, 64, 0, 159, 100, 63, 64, 128, 127, 159};
+
+//----------------------------------------------------------------------------
+void setUp ()
+{
+} // setUp
+
+//----------------------------------------------------------------------------
+void tearDown ()
+{
+    Decoder.End ();
+
+} // tearDown
+
+//----------------------------------------------------------------------------
+static void test_zlib_matches_uncompressed ()
+{
+    CheckFrames (FseqZlib, sizeof (FseqZlib), AllFrames ());
+
+} // test_zlib_matches_uncompressed
+
+//----------------------------------------------------------------------------
+static void test_zstd_matches_uncompressed ()
+{
+    CheckFrames (FseqZstd, sizeof (FseqZstd), AllFrames ());
+
+} // test_zstd_matches_uncompressed
+
+//----------------------------------------------------------------------------
+static void test_zlib_history_follows_the_window ()
+{
+    TEST_ASSERT_TRUE (BeginFile (FseqZlib, sizeof (FseqZlib)));
+    uint32_t LargeWindowMemory = Decoder.GetMemoryUsed ();
+    Decoder.End ();
+
+    CheckFrames (FseqZlibSmallWindow, sizeof (FseqZlibSmallWindow), AllFrames ());
+    CheckFrames (FseqZlibSmallWindow, sizeof (FseqZlibSmallWindow), SeekFrames);
+
+    // windowBits 10 against windowBits 15
+    TEST_ASSERT_TRUE (BeginFile (FseqZlibSmallWindow, sizeof (FseqZlibSmallWindow)));
+    TEST_ASSERT_EQUAL_UINT32 (LargeWindowMemory - ((32 * 1024) - 1024), Decoder.GetMemoryUsed ());
+
+} // test_zlib_history_follows_the_window
+
+//----------------------------------------------------------------------------
+static void test_seeking ()
+{
+    CheckFrames (FseqZlib, sizeof (FseqZlib), SeekFrames);
+    CheckFrames (FseqZstd, sizeof (FseqZstd), SeekFrames);
+
+} // test_seeking
+
+//----------------------------------------------------------------------------
+static void test_large_zstd_window_is_rejected ()
+{
+    TEST_ASSERT_TRUE (BeginFile (FseqZstdLargeWindow, sizeof (FseqZstdLargeWindow)));
+    TEST_ASSERT_NULL (Decoder.GetFrame (0));
+    TEST_ASSERT_EQUAL_STRING_LEN ("zstd: ", Decoder.GetErrorMsg (), 6);
+
+} // test_large_zstd_window_is_rejected
+
+//----------------------------------------------------------------------------
+static void test_truncated_file_is_rejected ()
+{
+    TEST_ASSERT_FALSE (BeginFile (FseqZstd, sizeof (FseqZstd) - 1));
+    TEST_ASSERT_NOT_EQUAL (0, strlen (Decoder.GetErrorMsg ()));
+    TEST_ASSERT_FALSE (Decoder.IsActive ());
+
+} // test_truncated_file_is_rejected
+
+//----------------------------------------------------------------------------
+static void BenchFile (const char * Name, const uint8_t * pFile, uint32_t FileSize)
+{
+    const uint32_t Passes = 200;
+    volatile uint32_t Sink = 0;
+
+    TEST_ASSERT_TRUE (BeginFile (pFile, FileSize));
+
+    auto Start = std::chrono::steady_clock::now ();
+    for (uint32_t Pass = 0; Pass < Passes; ++Pass)
+    {
+        for (uint32_t FrameId = 0; FrameId < TEST_FSEQ_NUM_FRAMES; ++FrameId)
+        {
+            Sink = Sink + Decoder.GetFrame (FrameId)[FrameId % TEST_FSEQ_NUM_CHANNELS];
+        }
+    }
+    double ElapsedSec = std::chrono::duration<double> (std::chrono::steady_clock::now () - Start).count ();
+
+    char Msg[128];
+    snprintf (Msg, sizeof (Msg), "%s: %.0f frames/s of %u channels, peak RAM %u bytes",
+              Name, (double (Passes) * TEST_FSEQ_NUM_FRAMES) / ElapsedSec,
+              TEST_FSEQ_NUM_CHANNELS, Decoder.GetPeakMemoryUsed ());
+    TEST_MESSAGE (Msg);
+
+    Decoder.End ();
+
+} // BenchFile
+
+//----------------------------------------------------------------------------
+static void bench_decoders ()
+{
+    BenchFile ("zlib", FseqZlib, sizeof (FseqZlib));
+    BenchFile ("zstd", FseqZstd, sizeof (FseqZstd));
+
+} // bench_decoders
+
+//----------------------------------------------------------------------------
+int main (int, char **)
+{
+    UNITY_BEGIN ();
+    RUN_TEST (test_zlib_matches_uncompressed);
+    RUN_TEST (test_zstd_matches_uncompressed);
+    RUN_TEST (test_zlib_history_follows_the_window);
+    RUN_TEST (test_seeking);
+    RUN_TEST (test_large_zstd_window_is_rejected);
+    RUN_TEST (test_truncated_file_is_rejected);
+    RUN_TEST (bench_decoders);
+    return UNITY_END ();
+
+} // main
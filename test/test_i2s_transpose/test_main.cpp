@@ -0,0 +1,275 @@
+/*
+* test_main.cpp - Host checks for the I2S parallel output waveform
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Run with: pio test -e native -f test_i2s_transpose
+*
+*/
+
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+
+#include "output/OutputI2sTranspose.hpp"
+
+#define NUM_LANES 16
+
+// 4 MHz sample clock
+#define SAMPLE_TIME_NS 250
+
+//----------------------------------------------------------------------------
+/*
+    Build the waveform for one intensity per lane and return the samples in
+    the order they go out on the wire (the DMA half word swap undone).
+*/
+static void EncodeLanes (const uint8_t * LaneBytes, uint16_t ActiveLanes, uint16_t * Wire)
+{
+    uint16_t Planes[I2S_BITS_PER_INTENSITY];
+    uint16_t Dma[I2S_WORDS_PER_INTENSITY];
+
+    I2sTranspose16x8 (LaneBytes, Planes);
+    I2sEncodeIntensity (Planes, ActiveLanes, Dma);
+
+    for (uint32_t SampleIndex = 0; SampleIndex < I2S_WORDS_PER_INTENSITY; ++SampleIndex)
+    {
+        Wire[SampleIndex] = Dma[SampleIndex ^ 1];
+    }
+
+} // EncodeLanes
+
+//----------------------------------------------------------------------------
+/*
+    Reference waveform for one lane built one bit at a time
+*/
+static void ReferenceLane (uint8_t Value, bool Active, uint8_t * Levels)
+{
+    for (uint32_t BitIndex = 0; BitIndex < I2S_BITS_PER_INTENSITY; ++BitIndex)
+    {
+        bool One = 0 != (Value & (0x80 >> BitIndex));
+        uint8_t * pBit = &Levels[BitIndex * I2S_SAMPLES_PER_BIT];
+        pBit[0] = Active;
+        pBit[1] = Active && One;
+        pBit[2] = Active && One;
+        pBit[3] = 0;
+        pBit[4] = 0;
+    }
+
+} // ReferenceLane
+
+//----------------------------------------------------------------------------
+static void CheckLanes (const uint8_t * LaneBytes, uint16_t ActiveLanes)
+{
+    uint16_t Wire[I2S_WORDS_PER_INTENSITY];
+    EncodeLanes (LaneBytes, ActiveLanes, Wire);
+
+    for (uint32_t LaneId = 0; LaneId < NUM_LANES; ++LaneId)
+    {
+        uint8_t Expected[I2S_WORDS_PER_INTENSITY];
+        ReferenceLane (LaneBytes[LaneId], 0 != (ActiveLanes & (1 << LaneId)), Expected);
+
+        for (uint32_t SampleIndex = 0; SampleIndex < I2S_WORDS_PER_INTENSITY; ++SampleIndex)
+        {
+            char Msg[64];
+            snprintf (Msg, sizeof (Msg), "lane %u sample %u", LaneId, SampleIndex);
+            TEST_ASSERT_EQUAL_MESSAGE (Expected[SampleIndex], (Wire[SampleIndex] >> LaneId) & 1, Msg);
+        }
+    }
+
+} // CheckLanes
+
+//----------------------------------------------------------------------------
+void setUp ()
+{
+} // setUp
+
+//----------------------------------------------------------------------------
+void tearDown ()
+{
+} // tearDown
+
+//----------------------------------------------------------------------------
+static void test_bit_timing ()
+{
+    // WS2811 fast mode and WS2812B overlap: T0H 250 - 400 ns, T1H 650 - 750 ns, bit 1.25 us
+    TEST_ASSERT_EQUAL (40, I2S_WORDS_PER_INTENSITY);
+    TEST_ASSERT_EQUAL (0, I2S_WORDS_PER_INTENSITY % 2);
+    TEST_ASSERT_EQUAL (1250, I2S_SAMPLES_PER_BIT * SAMPLE_TIME_NS);
+
+    uint8_t LaneBytes[NUM_LANES] = {0xF0};
+    uint16_t Wire[I2S_WORDS_PER_INTENSITY];
+    EncodeLanes (LaneBytes, 0x0001, Wire);
+
+    uint32_t HighSamples[I2S_BITS_PER_INTENSITY] = {0};
+    for (uint32_t SampleIndex = 0; SampleIndex < I2S_WORDS_PER_INTENSITY; ++SampleIndex)
+    {
+        HighSamples[SampleIndex / I2S_SAMPLES_PER_BIT] += Wire[SampleIndex] & 1;
+    }
+
+    for (uint32_t BitIndex = 0; BitIndex < I2S_BITS_PER_INTENSITY; ++BitIndex)
+    {
+        uint32_t HighTimeNs = HighSamples[BitIndex] * SAMPLE_TIME_NS;
+        if (BitIndex < 4)
+        {
+            TEST_ASSERT_TRUE ((HighTimeNs >= 650) && (HighTimeNs <= 750));
+        }
+        else
+        {
+            TEST_ASSERT_TRUE ((HighTimeNs >= 250) && (HighTimeNs <= 400));
+        }
+    }
+
+} // test_bit_timing
+
+//----------------------------------------------------------------------------
+static void test_transpose_8x8 ()
+{
+    const uint8_t Lanes[8] = {0x01, 0x80, 0xFF, 0x00, 0xA5, 0x5A, 0x3C, 0xC3};
+    uint8_t Planes[8];
+
+    I2sTranspose8x8 ((uint32_t (Lanes[7]) << 24) | (uint32_t (Lanes[6]) << 16) | (uint32_t (Lanes[5]) << 8) | Lanes[4],
+                     (uint32_t (Lanes[3]) << 24) | (uint32_t (Lanes[2]) << 16) | (uint32_t (Lanes[1]) << 8) | Lanes[0],
+                     Planes);
+
+    for (uint32_t PlaneId = 0; PlaneId < 8; ++PlaneId)
+    {
+        uint8_t Expected = 0;
+        for (uint32_t LaneId = 0; LaneId < 8; ++LaneId)
+        {
+            Expected |= ((Lanes[LaneId] >> (7 - PlaneId)) & 1) << LaneId;
+        }
+        TEST_ASSERT_EQUAL (Expected, Planes[PlaneId]);
+    }
+
+} // test_transpose_8x8
+
+//----------------------------------------------------------------------------
+static void test_golden_8_lanes ()
+{
+    // lane 0 = 0x80, lane 1 = 0x01, lane 2 = 0xFF, lanes 3 to 7 = 0x00, lanes 8 to 15 unused
+    const uint8_t LaneBytes[NUM_LANES] = {0x80, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00};
+    const uint16_t ActiveLanes = 0x00FF;
+
+    // samples on the wire for the first and the last bit
+    const uint16_t ExpectedFirstBit[I2S_SAMPLES_PER_BIT] = {0x00FF, 0x0005, 0x0005, 0x0000, 0x0000};
+    const uint16_t ExpectedMiddleBit[I2S_SAMPLES_PER_BIT] = {0x00FF, 0x0004, 0x0004, 0x0000, 0x0000};
+    const uint16_t ExpectedLastBit[I2S_SAMPLES_PER_BIT]  = {0x00FF, 0x0006, 0x0006, 0x0000, 0x0000};
+
+    uint16_t Wire[I2S_WORDS_PER_INTENSITY];
+    EncodeLanes (LaneBytes, ActiveLanes, Wire);
+
+    TEST_ASSERT_EQUAL_HEX16_ARRAY (ExpectedFirstBit, &Wire[0], I2S_SAMPLES_PER_BIT);
+    for (uint32_t BitIndex = 1; BitIndex < 7; ++BitIndex)
+    {
+        TEST_ASSERT_EQUAL_HEX16_ARRAY (ExpectedMiddleBit, &Wire[BitIndex * I2S_SAMPLES_PER_BIT], I2S_SAMPLES_PER_BIT);
+    }
+    TEST_ASSERT_EQUAL_HEX16_ARRAY (ExpectedLastBit, &Wire[7 * I2S_SAMPLES_PER_BIT], I2S_SAMPLES_PER_BIT);
+
+    CheckLanes (LaneBytes, ActiveLanes);
+
+} // test_golden_8_lanes
+
+//----------------------------------------------------------------------------
+static void test_golden_16_lanes ()
+{
+    // lane N sends the value with only bit (N % 8) set. Lane 15 has run out of data.
+    uint8_t LaneBytes[NUM_LANES];
+    for (uint32_t LaneId = 0; LaneId < NUM_LANES; ++LaneId)
+    {
+        LaneBytes[LaneId] = uint8_t (1 << (LaneId % 8));
+    }
+    const uint16_t ActiveLanes = 0x7FFF;
+
+    uint16_t Wire[I2S_WORDS_PER_INTENSITY];
+    EncodeLanes (LaneBytes, ActiveLanes, Wire);
+
+    // bit 7 goes out first. It is set for lanes 7 and 15 but lane 15 is idle.
+    for (uint32_t BitIndex = 0; BitIndex < I2S_BITS_PER_INTENSITY; ++BitIndex)
+    {
+        uint16_t DataLanes = uint16_t ((0x0101 << (7 - BitIndex)) & ActiveLanes);
+        const uint16_t Expected[I2S_SAMPLES_PER_BIT] = {ActiveLanes, DataLanes, DataLanes, 0x0000, 0x0000};
+        TEST_ASSERT_EQUAL_HEX16_ARRAY (Expected, &Wire[BitIndex * I2S_SAMPLES_PER_BIT], I2S_SAMPLES_PER_BIT);
+    }
+
+    CheckLanes (LaneBytes, ActiveLanes);
+
+} // test_golden_16_lanes
+
+//----------------------------------------------------------------------------
+static void test_random_lanes_match_reference ()
+{
+    uint32_t Seed = 0xC0FFEE;
+    for (uint32_t Pass = 0; Pass < 2000; ++Pass)
+    {
+        uint8_t LaneBytes[NUM_LANES];
+        for (auto & Value : LaneBytes)
+        {
+            Seed = (Seed * 1103515245) + 12345;
+            Value = uint8_t (Seed >> 16);
+        }
+        Seed = (Seed * 1103515245) + 12345;
+        CheckLanes (LaneBytes, uint16_t (Seed >> 8));
+    }
+
+} // test_random_lanes_match_reference
+
+//----------------------------------------------------------------------------
+static void bench_encode ()
+{
+    // one DMA buffer worth of intensities for 16 lanes
+    const uint32_t NumIntensities = 32;
+    const uint32_t Iterations = 20000;
+    uint8_t  LaneBytes[NUM_LANES];
+    uint16_t Planes[I2S_BITS_PER_INTENSITY];
+    static uint16_t Buffer[NumIntensities * I2S_WORDS_PER_INTENSITY];
+    volatile uint16_t Sink = 0;
+
+    auto Start = std::chrono::steady_clock::now ();
+    for (uint32_t Pass = 0; Pass < Iterations; ++Pass)
+    {
+        for (uint32_t IntensityIndex = 0; IntensityIndex < NumIntensities; ++IntensityIndex)
+        {
+            for (uint32_t LaneId = 0; LaneId < NUM_LANES; ++LaneId)
+            {
+                LaneBytes[LaneId] = uint8_t (Pass + IntensityIndex + LaneId);
+            }
+            I2sTranspose16x8 (LaneBytes, Planes);
+            I2sEncodeIntensity (Planes, 0xFFFF, &Buffer[IntensityIndex * I2S_WORDS_PER_INTENSITY]);
+        }
+        Sink = Sink + Buffer[Pass % (sizeof (Buffer) / sizeof (Buffer[0]))];
+    }
+    double ElapsedUs = std::chrono::duration<double, std::micro> (std::chrono::steady_clock::now () - Start).count ();
+
+    // every intensity is 10 us on the wire
+    double IntensitiesPerUs = (double (NumIntensities) * Iterations) / ElapsedUs;
+    char Msg[128];
+    snprintf (Msg, sizeof (Msg), "16 lanes: %.2f intensities/us encoded, %.1f x real time", IntensitiesPerUs, IntensitiesPerUs * 10.0);
+    TEST_MESSAGE (Msg);
+
+} // bench_encode
+
+//----------------------------------------------------------------------------
+int main (int, char **)
+{
+    UNITY_BEGIN ();
+    RUN_TEST (test_bit_timing);
+    RUN_TEST (test_transpose_8x8);
+    RUN_TEST (test_golden_8_lanes);
+    RUN_TEST (test_golden_16_lanes);
+    RUN_TEST (test_random_lanes_match_reference);
+    RUN_TEST (bench_encode);
+    return UNITY_END ();
+
+} // main
@@ -0,0 +1,234 @@
+/*
+* test_main.cpp - Host checks for the pixel channel map
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Run with: pio test -e native -f test_pixel_channel_map
+*
+*/
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "output/OutputPixelLayout.hpp"
+
+struct TestLayout_t
+{
+    const char * Name;
+    uint32_t     NumIntensityBytesPerPixel;
+    uint32_t     PixelGroupSize;
+    uint32_t     zig_size;
+    uint8_t      ColorOffsets[4];
+    uint32_t     PixelCount;
+};
+
+static const TestLayout_t TestLayouts[] =
+{
+    {"rgb",                 3, 1,  1, {0, 1, 2, 3}, 170},
+    {"grb",                 3, 1,  1, {1, 0, 2, 3}, 170},
+    {"bgr zig 10",          3, 1, 10, {2, 1, 0, 3}, 170},
+    {"rgbw",                4, 1,  1, {0, 1, 2, 3}, 128},
+    {"wrgb zig 7",          4, 1,  7, {3, 0, 1, 2}, 128},
+    {"grb group 3",         3, 3,  1, {1, 0, 2, 3}, 300},
+    {"brg group 2 zig 5",   3, 2,  5, {2, 0, 1, 3}, 300},
+};
+
+static uint8_t Forward[256];
+
+//----------------------------------------------------------------------------
+static PixelLayout_t MakeLayout (const TestLayout_t & Test)
+{
+    return PixelLayout_t {Test.NumIntensityBytesPerPixel, Test.PixelGroupSize, Test.zig_size, Test.ColorOffsets};
+
+} // MakeLayout
+
+//----------------------------------------------------------------------------
+static uint32_t NumChannels (const TestLayout_t & Test)
+{
+    return (Test.PixelCount * Test.NumIntensityBytesPerPixel) / Test.PixelGroupSize;
+
+} // NumChannels
+
+//----------------------------------------------------------------------------
+void setUp ()
+{
+    for (uint32_t Index = 0; Index < sizeof (Forward); ++Index)
+    {
+        // something that is not the identity so a wrong table shows up
+        Forward[Index] = uint8_t ((Index * 7) + 3);
+    }
+
+} // setUp
+
+//----------------------------------------------------------------------------
+void tearDown ()
+{
+} // tearDown
+
+//----------------------------------------------------------------------------
+static void test_offsets_are_a_permutation ()
+{
+    for (auto & Test : TestLayouts)
+    {
+        PixelLayout_t Layout = MakeLayout (Test);
+        uint32_t BufferSize = Test.PixelCount * Test.NumIntensityBytesPerPixel;
+        std::vector<uint32_t> Hits (BufferSize, 0);
+
+        for (uint32_t ChannelId = 0; ChannelId < NumChannels (Test); ++ChannelId)
+        {
+            uint32_t Offset = PixelLayoutCalculateOffset (Layout, ChannelId);
+            for (uint32_t GroupIndex = 0; GroupIndex < Test.PixelGroupSize; ++GroupIndex)
+            {
+                uint32_t Target = Offset + (GroupIndex * Test.NumIntensityBytesPerPixel);
+                TEST_ASSERT_TRUE_MESSAGE (Target < BufferSize, Test.Name);
+                Hits[Target]++;
+            }
+        }
+
+        // every output byte is written exactly once
+        for (auto Count : Hits)
+        {
+            TEST_ASSERT_EQUAL_MESSAGE (1, Count, Test.Name);
+        }
+    }
+
+} // test_offsets_are_a_permutation
+
+//----------------------------------------------------------------------------
+static void test_map_matches_calculated_offsets ()
+{
+    for (auto & Test : TestLayouts)
+    {
+        PixelLayout_t Layout = MakeLayout (Test);
+        std::vector<uint16_t> Map (NumChannels (Test));
+        PixelLayoutBuildMap (Layout, Map.data (), Map.size ());
+
+        for (uint32_t ChannelId = 0; ChannelId < Map.size (); ++ChannelId)
+        {
+            TEST_ASSERT_EQUAL_MESSAGE (PixelLayoutCalculateOffset (Layout, ChannelId), Map[ChannelId], Test.Name);
+        }
+    }
+
+} // test_map_matches_calculated_offsets
+
+//----------------------------------------------------------------------------
+static void test_mapped_write_matches_calculated_write ()
+{
+    for (auto & Test : TestLayouts)
+    {
+        PixelLayout_t Layout = MakeLayout (Test);
+        uint32_t ChannelCount = NumChannels (Test);
+        uint32_t BufferSize = Test.PixelCount * Test.NumIntensityBytesPerPixel;
+
+        std::vector<uint16_t> Map (ChannelCount);
+        PixelLayoutBuildMap (Layout, Map.data (), Map.size ());
+
+        std::vector<uint8_t> Source (ChannelCount);
+        for (uint32_t Index = 0; Index < ChannelCount; ++Index)
+        {
+            Source[Index] = uint8_t (Index * 13);
+        }
+
+        std::vector<uint8_t> Calculated (BufferSize, 0);
+        std::vector<uint8_t> Mapped (BufferSize, 0);
+
+        // write the frame in uneven pieces the way universes arrive
+        const uint32_t PieceSize = 97;
+        for (uint32_t Start = 0; Start < ChannelCount; Start += PieceSize)
+        {
+            uint32_t Count = (ChannelCount - Start < PieceSize) ? (ChannelCount - Start) : PieceSize;
+            uint32_t CalculatedChanges = PixelLayoutWriteCalculated (Layout, Forward, Start, Count, &Source[Start], Calculated.data ());
+            uint32_t MappedChanges = PixelLayoutWriteMapped (Layout, Map.data (), Forward, Start, Count, &Source[Start], Mapped.data ());
+            TEST_ASSERT_EQUAL_MESSAGE (CalculatedChanges, MappedChanges, Test.Name);
+        }
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE (Calculated.data (), Mapped.data (), BufferSize, Test.Name);
+
+        // writing the same data again changes nothing
+        TEST_ASSERT_EQUAL_MESSAGE (0, PixelLayoutWriteMapped (Layout, Map.data (), Forward, 0, ChannelCount, Source.data (), Mapped.data ()), Test.Name);
+        TEST_ASSERT_EQUAL_MESSAGE (0, PixelLayoutWriteCalculated (Layout, Forward, 0, ChannelCount, Source.data (), Calculated.data ()), Test.Name);
+    }
+
+} // test_mapped_write_matches_calculated_write
+
+//----------------------------------------------------------------------------
+static void test_known_layout ()
+{
+    // grb, zig zag of 2: pixel 2 and 3 are swapped
+    const TestLayout_t Test = {"grb zig 2", 3, 1, 2, {1, 0, 2, 3}, 4};
+    PixelLayout_t Layout = MakeLayout (Test);
+    const uint32_t Expected[] = {1, 0, 2,  4, 3, 5,  10, 9, 11,  7, 6, 8};
+
+    for (uint32_t ChannelId = 0; ChannelId < (sizeof (Expected) / sizeof (Expected[0])); ++ChannelId)
+    {
+        TEST_ASSERT_EQUAL (Expected[ChannelId], PixelLayoutCalculateOffset (Layout, ChannelId));
+    }
+
+} // test_known_layout
+
+//----------------------------------------------------------------------------
+static void bench_write_paths ()
+{
+    // one full 8 universe port, grb with a zig zag
+    const TestLayout_t Test = {"grb zig 50", 3, 1, 50, {1, 0, 2, 3}, 1360};
+    PixelLayout_t Layout = MakeLayout (Test);
+    uint32_t ChannelCount = NumChannels (Test);
+    const uint32_t Iterations = 2000;
+
+    std::vector<uint16_t> Map (ChannelCount);
+    PixelLayoutBuildMap (Layout, Map.data (), Map.size ());
+
+    std::vector<uint8_t> Source (ChannelCount);
+    std::vector<uint8_t> Buffer (ChannelCount);
+    volatile uint32_t Sink = 0;
+
+    auto Start = std::chrono::steady_clock::now ();
+    for (uint32_t Pass = 0; Pass < Iterations; ++Pass)
+    {
+        Source[Pass % ChannelCount] = uint8_t (Pass);
+        Sink = Sink + PixelLayoutWriteCalculated (Layout, Forward, 0, ChannelCount, Source.data (), Buffer.data ());
+    }
+    double CalculatedUs = std::chrono::duration<double, std::micro> (std::chrono::steady_clock::now () - Start).count ();
+
+    Start = std::chrono::steady_clock::now ();
+    for (uint32_t Pass = 0; Pass < Iterations; ++Pass)
+    {
+        Source[Pass % ChannelCount] = uint8_t (Pass);
+        Sink = Sink + PixelLayoutWriteMapped (Layout, Map.data (), Forward, 0, ChannelCount, Source.data (), Buffer.data ());
+    }
+    double MappedUs = std::chrono::duration<double, std::micro> (std::chrono::steady_clock::now () - Start).count ();
+
+    double TotalBytes = double (ChannelCount) * Iterations;
+    char Msg[128];
+    snprintf (Msg, sizeof (Msg), "calculated: %.1f bytes/us, mapped: %.1f bytes/us",
+              TotalBytes / CalculatedUs, TotalBytes / MappedUs);
+    TEST_MESSAGE (Msg);
+
+} // bench_write_paths
+
+//----------------------------------------------------------------------------
+int main (int, char **)
+{
+    UNITY_BEGIN ();
+    RUN_TEST (test_known_layout);
+    RUN_TEST (test_offsets_are_a_permutation);
+    RUN_TEST (test_map_matches_calculated_offsets);
+    RUN_TEST (test_mapped_write_matches_calculated_write);
+    RUN_TEST (bench_write_paths);
+    return UNITY_END ();
+
+} // main
@@ -0,0 +1,249 @@
+/*
+* test_main.cpp - Host checks for the RMT intensity encoders
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The staged (table driven) encoder must produce exactly the same RMT
+*   slots as the per bit encoder used by the ISR.
+*
+*   Run with: pio test -e native -f test_rmt_encode
+*
+*/
+
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+
+#include "output/OutputRmtEncode.hpp"
+
+// Arbitrary but distinct slot values so that a mix up shows in the compare
+#define TEST_ZERO_BIT       0x00108020
+#define TEST_ONE_BIT        0x00208010
+#define TEST_INTER_VALUE    0x00018001
+#define TEST_END_OF_FRAME   0x0000FFFF
+
+static RmtExpansionRow_t Slots[256];
+
+//----------------------------------------------------------------------------
+static RmtEncodeConfig_t MakeConfig (uint32_t Width, bool MsbFirst, bool SendInterIntensityBits, bool SendEndOfFrameBits)
+{
+    RmtEncodeConfig_t Config;
+    Config.ZeroBitValue           = TEST_ZERO_BIT;
+    Config.OneBitValue            = TEST_ONE_BIT;
+    Config.InterIntensityValue    = TEST_INTER_VALUE;
+    Config.EndOfFrameValue        = TEST_END_OF_FRAME;
+    Config.IntensityDataWidth     = Width;
+    Config.MsbFirst               = MsbFirst;
+    Config.SendInterIntensityBits = SendInterIntensityBits;
+    Config.SendEndOfFrameBits     = SendEndOfFrameBits;
+    return Config;
+
+} // MakeConfig
+
+//----------------------------------------------------------------------------
+static std::vector<uint32_t> EncodeFrameBits (const RmtEncodeConfig_t & Config, const std::vector<uint32_t> & Values)
+{
+    std::vector<uint32_t> Output;
+    uint32_t Buffer[RMT_ENCODE_MAX_SLOTS_PER_VALUE];
+
+    for (size_t Index = 0; Index < Values.size (); ++Index)
+    {
+        uint32_t Count = RmtEncodeIntensityBits (Config, Values[Index], (Index + 1) == Values.size (), Buffer);
+        Output.insert (Output.end (), Buffer, Buffer + Count);
+    }
+    return Output;
+
+} // EncodeFrameBits
+
+//----------------------------------------------------------------------------
+static std::vector<uint32_t> EncodeFrameExpanded (const RmtEncodeConfig_t & Config, const std::vector<uint32_t> & Values)
+{
+    std::vector<uint32_t> Output;
+    uint32_t Buffer[RMT_ENCODE_MAX_SLOTS_PER_VALUE];
+
+    RmtBuildExpansionTable (Config.ZeroBitValue, Config.OneBitValue, Config.MsbFirst, Slots);
+
+    for (size_t Index = 0; Index < Values.size (); ++Index)
+    {
+        uint32_t Count = RmtEncodeIntensityExpanded (Config, Slots, Values[Index], (Index + 1) == Values.size (), Buffer);
+        Output.insert (Output.end (), Buffer, Buffer + Count);
+    }
+    return Output;
+
+} // EncodeFrameExpanded
+
+//----------------------------------------------------------------------------
+static std::vector<uint32_t> MakeValues (uint32_t Width)
+{
+    std::vector<uint32_t> Values;
+    uint32_t Mask = (uint32_t (1) << Width) - 1;
+    uint32_t Seed = 0x12345678;
+
+    // every byte value plus some random ones
+    for (uint32_t Value = 0; Value < 256; ++Value)
+    {
+        Values.push_back ((Value | (Value << 8)) & Mask);
+    }
+    for (uint32_t Count = 0; Count < 256; ++Count)
+    {
+        Seed = (Seed * 1103515245) + 12345;
+        Values.push_back ((Seed >> 7) & Mask);
+    }
+    return Values;
+
+} // MakeValues
+
+//----------------------------------------------------------------------------
+void setUp ()
+{
+} // setUp
+
+//----------------------------------------------------------------------------
+void tearDown ()
+{
+} // tearDown
+
+//----------------------------------------------------------------------------
+static void CheckEquivalence (uint32_t Width)
+{
+    std::vector<uint32_t> Values = MakeValues (Width);
+
+    for (int MsbFirst = 0; MsbFirst < 2; ++MsbFirst)
+    {
+        for (int Inter = 0; Inter < 2; ++Inter)
+        {
+            for (int EndOfFrame = 0; EndOfFrame < 2; ++EndOfFrame)
+            {
+                char Name[64];
+                snprintf (Name, sizeof (Name), "width %u msb %d inter %d eof %d", Width, MsbFirst, Inter, EndOfFrame);
+
+                RmtEncodeConfig_t Config = MakeConfig (Width, MsbFirst, Inter, EndOfFrame);
+                std::vector<uint32_t> Reference = EncodeFrameBits (Config, Values);
+                std::vector<uint32_t> Staged    = EncodeFrameExpanded (Config, Values);
+
+                uint32_t ExpectedSize = (Values.size () * (Width + Inter)) + ((EndOfFrame && !Inter) ? 1 : 0);
+                TEST_ASSERT_EQUAL_MESSAGE (ExpectedSize, Reference.size (), Name);
+                TEST_ASSERT_EQUAL_MESSAGE (Reference.size (), Staged.size (), Name);
+                TEST_ASSERT_EQUAL_MEMORY_MESSAGE (Reference.data (), Staged.data (), Reference.size () * sizeof (uint32_t), Name);
+
+                if (EndOfFrame)
+                {
+                    TEST_ASSERT_EQUAL_MESSAGE (TEST_END_OF_FRAME, Staged.back (), Name);
+                }
+            }
+        }
+    }
+
+} // CheckEquivalence
+
+//----------------------------------------------------------------------------
+static void test_8_bit_matches_per_bit_encoder ()
+{
+    CheckEquivalence (8);
+
+} // test_8_bit_matches_per_bit_encoder
+
+//----------------------------------------------------------------------------
+static void test_16_bit_matches_per_bit_encoder ()
+{
+    CheckEquivalence (16);
+
+} // test_16_bit_matches_per_bit_encoder
+
+//----------------------------------------------------------------------------
+static void test_golden_waveform ()
+{
+    const uint32_t Z = TEST_ZERO_BIT;
+    const uint32_t O = TEST_ONE_BIT;
+
+    // 0xA1 followed by the last value 0x03, msb first, stop bits and an end of frame
+    RmtEncodeConfig_t Config = MakeConfig (8, true, true, true);
+    const uint32_t ExpectedMsb[] = {O, Z, O, Z, Z, Z, Z, O, TEST_INTER_VALUE,
+                                    Z, Z, Z, Z, Z, Z, O, O, TEST_END_OF_FRAME};
+    std::vector<uint32_t> Bits   = EncodeFrameBits (Config, {0xA1, 0x03});
+    std::vector<uint32_t> Staged = EncodeFrameExpanded (Config, {0xA1, 0x03});
+    TEST_ASSERT_EQUAL (sizeof (ExpectedMsb) / sizeof (uint32_t), Bits.size ());
+    TEST_ASSERT_EQUAL_HEX32_ARRAY (ExpectedMsb, Bits.data (), Bits.size ());
+    TEST_ASSERT_EQUAL_HEX32_ARRAY (ExpectedMsb, Staged.data (), Staged.size ());
+
+    // 16 bit 0x8001 lsb first with no framing slots
+    Config = MakeConfig (16, false, false, false);
+    const uint32_t ExpectedLsb[] = {O, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, O};
+    Bits   = EncodeFrameBits (Config, {0x8001});
+    Staged = EncodeFrameExpanded (Config, {0x8001});
+    TEST_ASSERT_EQUAL (sizeof (ExpectedLsb) / sizeof (uint32_t), Bits.size ());
+    TEST_ASSERT_EQUAL_HEX32_ARRAY (ExpectedLsb, Bits.data (), Bits.size ());
+    TEST_ASSERT_EQUAL_HEX32_ARRAY (ExpectedLsb, Staged.data (), Staged.size ());
+
+} // test_golden_waveform
+
+//----------------------------------------------------------------------------
+static void bench_encoders ()
+{
+    RmtEncodeConfig_t Config = MakeConfig (8, true, false, false);
+    RmtBuildExpansionTable (Config.ZeroBitValue, Config.OneBitValue, Config.MsbFirst, Slots);
+
+    // one port of 680 RGB pixels
+    const uint32_t NumValues  = 680 * 3;
+    const uint32_t Iterations = 500;
+    std::vector<uint8_t>  Values (NumValues);
+    std::vector<uint32_t> Output (NumValues * RMT_ENCODE_MAX_SLOTS_PER_VALUE);
+    for (uint32_t Index = 0; Index < NumValues; ++Index)
+    {
+        Values[Index] = uint8_t (Index * 37);
+    }
+
+    auto Start = std::chrono::steady_clock::now ();
+    for (uint32_t Pass = 0; Pass < Iterations; ++Pass)
+    {
+        uint32_t * pTarget = Output.data ();
+        for (uint32_t Index = 0; Index < NumValues; ++Index)
+        {
+            pTarget += RmtEncodeIntensityBits (Config, Values[Index], (Index + 1) == NumValues, pTarget);
+        }
+    }
+    double BitsUs = std::chrono::duration<double, std::micro> (std::chrono::steady_clock::now () - Start).count ();
+
+    Start = std::chrono::steady_clock::now ();
+    for (uint32_t Pass = 0; Pass < Iterations; ++Pass)
+    {
+        uint32_t * pTarget = Output.data ();
+        for (uint32_t Index = 0; Index < NumValues; ++Index)
+        {
+            pTarget += RmtEncodeIntensityExpanded (Config, Slots, Values[Index], (Index + 1) == NumValues, pTarget);
+        }
+    }
+    double ExpandedUs = std::chrono::duration<double, std::micro> (std::chrono::steady_clock::now () - Start).count ();
+
+    double TotalValues = double (NumValues) * Iterations;
+    char Msg[128];
+    snprintf (Msg, sizeof (Msg), "per bit: %.1f intensities/us, table: %.1f intensities/us",
+              TotalValues / BitsUs, TotalValues / ExpandedUs);
+    TEST_MESSAGE (Msg);
+
+} // bench_encoders
+
+//----------------------------------------------------------------------------
+int main (int, char **)
+{
+    UNITY_BEGIN ();
+    RUN_TEST (test_golden_waveform);
+    RUN_TEST (test_8_bit_matches_per_bit_encoder);
+    RUN_TEST (test_16_bit_matches_per_bit_encoder);
+    RUN_TEST (bench_encoders);
+    return UNITY_END ();
+
+} // main
@@ -0,0 +1,178 @@
+/*
+* test_main.cpp - Host checks for the input timing histogram
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2022 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The buckets must cover every sample exactly once, be narrow enough to
+*   show frame jitter at 40 fps and keep their shape when they are halved.
+*
+*   Run with: pio test -e native -f test_timing_stats
+*
+*/
+
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+
+#include "input/InputTimingHistogram.hpp"
+
+static c_InputTimingHistogram Histogram;
+
+//----------------------------------------------------------------------------
+void setUp ()
+{
+    Histogram.Clear ();
+
+} // setUp
+
+//----------------------------------------------------------------------------
+void tearDown ()
+{
+} // tearDown
+
+//----------------------------------------------------------------------------
+static void test_buckets_are_contiguous ()
+{
+    TEST_ASSERT_EQUAL_UINT32 (0, c_InputTimingHistogram::GetBucketLowerBound (0));
+
+    for (uint32_t BucketId = 0; BucketId < (ITH_NUM_BUCKETS - 1); ++BucketId)
+    {
+        uint32_t LowerBound = c_InputTimingHistogram::GetBucketLowerBound (BucketId);
+        uint32_t NextBound  = c_InputTimingHistogram::GetBucketLowerBound (BucketId + 1);
+
+        char Name[32];
+        snprintf (Name, sizeof (Name), "bucket %u", BucketId);
+        TEST_ASSERT_TRUE_MESSAGE (LowerBound < NextBound, Name);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE (BucketId, c_InputTimingHistogram::GetBucketId (LowerBound), Name);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE (BucketId, c_InputTimingHistogram::GetBucketId (NextBound - 1), Name);
+    }
+
+    // everything past the regular buckets lands in the last one
+    TEST_ASSERT_EQUAL_UINT32 (ITH_NUM_BUCKETS - 1, c_InputTimingHistogram::GetBucketId (c_InputTimingHistogram::GetBucketLowerBound (ITH_NUM_BUCKETS)));
+    TEST_ASSERT_EQUAL_UINT32 (ITH_NUM_BUCKETS - 1, c_InputTimingHistogram::GetBucketId (uint32_t (-1)));
+
+} // test_buckets_are_contiguous
+
+//----------------------------------------------------------------------------
+static void test_frame_jitter_is_visible ()
+{
+    // 40 fps with +/- 8ms of jitter
+    uint32_t Early  = c_InputTimingHistogram::GetBucketId (25000 - 8000);
+    uint32_t OnTime = c_InputTimingHistogram::GetBucketId (25000);
+    uint32_t Late   = c_InputTimingHistogram::GetBucketId (25000 + 8000);
+    TEST_ASSERT_TRUE (Early < OnTime);
+    TEST_ASSERT_TRUE (OnTime < Late);
+
+    // no bucket past the linear ones is wider than 1/8 of its lower bound
+    for (uint32_t BucketId = 2 * ITH_SUB_BUCKETS; BucketId < (ITH_NUM_BUCKETS - 1); ++BucketId)
+    {
+        uint32_t LowerBound = c_InputTimingHistogram::GetBucketLowerBound (BucketId);
+        uint32_t Width      = c_InputTimingHistogram::GetBucketLowerBound (BucketId + 1) - LowerBound;
+        TEST_ASSERT_TRUE (Width <= (LowerBound / ITH_SUB_BUCKETS));
+    }
+
+} // test_frame_jitter_is_visible
+
+//----------------------------------------------------------------------------
+static void test_percentiles ()
+{
+    TEST_ASSERT_EQUAL_UINT32 (0, Histogram.GetPercentile (50));
+
+    // 90 frames on time, 10 late
+    for (uint32_t Count = 0; Count < 90; ++Count)
+    {
+        Histogram.Add (25000);
+    }
+    for (uint32_t Count = 0; Count < 10; ++Count)
+    {
+        Histogram.Add (40000);
+    }
+
+    uint32_t OnTimeBucket = c_InputTimingHistogram::GetBucketId (25000);
+    uint32_t P50 = Histogram.GetPercentile (50);
+    TEST_ASSERT_EQUAL_UINT32 (c_InputTimingHistogram::GetBucketLowerBound (OnTimeBucket + 1) - 1, P50);
+    TEST_ASSERT_TRUE (P50 >= 25000);
+
+    TEST_ASSERT_EQUAL_UINT32 (40000, Histogram.GetPercentile (99));
+    TEST_ASSERT_EQUAL_UINT32 (40000, Histogram.GetMax ());
+
+} // test_percentiles
+
+//----------------------------------------------------------------------------
+static void test_last_bucket_reports_the_max ()
+{
+    Histogram.Add (3000000);
+    TEST_ASSERT_EQUAL_UINT32 (3000000, Histogram.GetPercentile (50));
+
+} // test_last_bucket_reports_the_max
+
+//----------------------------------------------------------------------------
+static void test_overflow_halves_the_buckets ()
+{
+    uint32_t SmallBucket = c_InputTimingHistogram::GetBucketId (1000);
+    uint32_t LargeBucket = c_InputTimingHistogram::GetBucketId (25000);
+
+    for (uint32_t Count = 0; Count < 100; ++Count)
+    {
+        Histogram.Add (1000);
+    }
+    for (uint32_t Count = 0; Count < 0xffff; ++Count)
+    {
+        Histogram.Add (25000);
+    }
+    TEST_ASSERT_EQUAL_UINT16 (100, Histogram.GetBucket (SmallBucket));
+    TEST_ASSERT_EQUAL_UINT16 (0xffff, Histogram.GetBucket (LargeBucket));
+
+    // the next sample does not wrap the counter
+    Histogram.Add (25000);
+    TEST_ASSERT_EQUAL_UINT16 (50, Histogram.GetBucket (SmallBucket));
+    TEST_ASSERT_EQUAL_UINT16 ((0xffff >> 1) + 1, Histogram.GetBucket (LargeBucket));
+    TEST_ASSERT_EQUAL_UINT32 (25000, Histogram.GetMax ());
+
+} // test_overflow_halves_the_buckets
+
+//----------------------------------------------------------------------------
+static void bench_add ()
+{
+    const uint32_t Iterations = 10000000;
+
+    auto Start = std::chrono::steady_clock::now ();
+    uint32_t Sample = 12345;
+    for (uint32_t Count = 0; Count < Iterations; ++Count)
+    {
+        Sample = (Sample * 1103515245) + 12345;
+        Histogram.Add (Sample >> 12);
+    }
+    double ElapsedNs = std::chrono::duration<double, std::nano> (std::chrono::steady_clock::now () - Start).count ();
+
+    char Msg[64];
+    snprintf (Msg, sizeof (Msg), "Add: %.1f ns/sample, p99 %u us", ElapsedNs / Iterations, Histogram.GetPercentile (99));
+    TEST_MESSAGE (Msg);
+
+} // bench_add
+
+//----------------------------------------------------------------------------
+int main (int, char **)
+{
+    UNITY_BEGIN ();
+    RUN_TEST (test_buckets_are_contiguous);
+    RUN_TEST (test_frame_jitter_is_visible);
+    RUN_TEST (test_percentiles);
+    RUN_TEST (test_last_bucket_reports_the_max);
+    RUN_TEST (test_overflow_halves_the_buckets);
+    RUN_TEST (bench_add);
+    return UNITY_END ();
+
+} // main